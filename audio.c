@@ -1,53 +1,149 @@
 //*****************************************************************************
 // Audio Library for Tiva LaunchPad
 // Usage: Connect normalized left channel output to GPIO port E pin 3 and 
-// normalized right channel output to GPIO port E pin 2.
+// normalized right channel output to GPIO port E pin 2. Samples are 
+// captured by the uDMA controller into ping-pong blocks and handed to the 
+// main loop through a ring of stereo pairs, so call dma_config() before 
+// audio_config(), then fetch sample pairs with audio_read().
 // Author: Zachary Zhou
 //*****************************************************************************
 
 #include "audio.h"
 
+// Items per block: left and right samples interleaved
+#define BLOCK_ITEMS (2*AUDIO_BLOCK_SIZE)
+
+// Block n is written to half n & 1
+static uint16_t blocks[2][BLOCK_ITEMS];
+
+// Filled by the ISR, emptied by audio_read(); each item is a pair with the 
+// left sample in the lower halfword and the right in the upper
+static ring_t pair_ring;
+
+// Called by the ISR after each block
+static void (*block_callback)(void);
+
+//*****************************************************************************
+// Sets up one half of the ping-pong transfer from the SS0 FIFO.
 //*****************************************************************************
-// Configures the GPIO pins connected to the audio channels, an ADC module, 
-// and a sample sequencer.
+static void arm_block(uint32_t select, uint16_t *block) {
+    uDMAChannelTransferSet(UDMA_CH14_ADC0_0 | select, UDMA_MODE_PINGPONG, 
+                           (void *) (ADC0_BASE + ADC_O_SSFIFO0), block, BLOCK_ITEMS);
+}
+
+//*****************************************************************************
+// Configures the GPIO pins connected to the audio channels, ADC0's SS0 to 
+// convert both channels on every timer trigger, and the uDMA channel that 
+// empties SS0. 'block_ready' is called from the ISR after every block.
 //*****************************************************************************
-void audio_config(void) {
+void audio_config(void (*block_ready)(void)) {
+    const uint32_t CONTROL = UDMA_SIZE_16 | UDMA_SRC_INC_NONE | UDMA_DST_INC_16 | UDMA_ARB_1;
+    
+    ring_init(&pair_ring);
+    block_callback = block_ready;
+    
     // Enable the peripherals, then wait for them to be ready
     SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC0);
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC1);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
     while (!SysCtlPeripheralReady(SYSCTL_PERIPH_ADC0) || 
-           !SysCtlPeripheralReady(SYSCTL_PERIPH_ADC1) || 
            !SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOE) || 
            !SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER0));
     
-    // Enable SS0 to capture the values of channels 0 and 1 when timer 
-    // triggers occur TODO FIX COMMENT
+    // Each conversion requests a uDMA transfer; the sequencer's interrupt 
+    // fires only when a whole block has been moved
+    uDMAChannelAssign(UDMA_CH14_ADC0_0);
+    uDMAChannelAttributeDisable(UDMA_CH14_ADC0_0, UDMA_ATTR_ALL);
+    uDMAChannelControlSet(UDMA_CH14_ADC0_0 | UDMA_PRI_SELECT, CONTROL);
+    uDMAChannelControlSet(UDMA_CH14_ADC0_0 | UDMA_ALT_SELECT, CONTROL);
+    arm_block(UDMA_PRI_SELECT, blocks[0]);
+    arm_block(UDMA_ALT_SELECT, blocks[1]);
+    uDMAChannelEnable(UDMA_CH14_ADC0_0);
+    
+    // Enable SS0 to capture channel 0 (left), then channel 1 (right), on 
+    // every timer trigger, so each pair is converted by the same sequence 
+    // and the two streams cannot drift apart
     ADCSequenceDisable(ADC0_BASE, 0);
     ADCHardwareOversampleConfigure(ADC0_BASE, 16);
     ADCSequenceConfigure(ADC0_BASE, 0, ADC_TRIGGER_TIMER, 0);
-    ADCSequenceStepConfigure(ADC0_BASE, 0, 0, ADC_CTL_IE | ADC_CTL_END | ADC_CTL_CH0);
+    ADCSequenceStepConfigure(ADC0_BASE, 0, 0, ADC_CTL_IE | ADC_CTL_CH0);
+    ADCSequenceStepConfigure(ADC0_BASE, 0, 1, ADC_CTL_IE | ADC_CTL_END | ADC_CTL_CH1);
     ADCSequenceEnable(ADC0_BASE, 0);
+    ADCSequenceDMAEnable(ADC0_BASE, 0);
     IntEnable(INT_ADC0SS0);
-    ADCIntEnable(ADC0_BASE, 0);
-    
-    // Enable 
-    ADCSequenceDisable(ADC1_BASE, 0);
-    ADCHardwareOversampleConfigure(ADC1_BASE, 16);
-    ADCSequenceConfigure(ADC1_BASE, 0, ADC_TRIGGER_TIMER, 0);
-    ADCSequenceStepConfigure(ADC1_BASE, 0, 0, ADC_CTL_IE | ADC_CTL_END | ADC_CTL_CH1);
-    ADCSequenceEnable(ADC1_BASE, 0);
-    IntEnable(INT_ADC1SS0);
-    ADCIntEnable(ADC1_BASE, 0);
+    ADCIntEnableEx(ADC0_BASE, ADC_INT_DMA_SS0);
     
     // Configure pins as ADC inputs
     GPIOPinTypeADC(GPIO_PORTE_BASE, GPIO_PIN_2 | GPIO_PIN_3);
     
+    // The sample rate is set here and nowhere else
     TimerConfigure(TIMER0_BASE, TIMER_CFG_PERIODIC);
-    TimerLoadSet(TIMER0_BASE, TIMER_A, SysCtlClockGet() / (2 * 5000));
+    TimerLoadSet(TIMER0_BASE, TIMER_A, SysCtlClockGet() / AUDIO_SAMPLE_RATE);
     TimerControlTrigger(TIMER0_BASE, TIMER_A, true);
-    IntEnable(INT_TIMER0A);
-    //TimerIntEnable(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
     TimerEnable(TIMER0_BASE, TIMER_A);
 }
+
+//*****************************************************************************
+// Pushes a completed block into the ring. Each pair is pushed as one item, 
+// so if the ring fills, whole pairs are dropped and the channels never slip 
+// against each other.
+//*****************************************************************************
+static void deliver_block(const uint16_t *block) {
+    uint16_t i;
+    
+    for (i = 0; i < BLOCK_ITEMS; i += 2) {
+        ring_push(&pair_ring, ((uint32_t) block[i + 1] << 16) | block[i]);
+    }
+}
+
+//*****************************************************************************
+// ISR for completed blocks; whichever half has stopped is emptied into the 
+// ring and re-armed for the block after next while the uDMA controller 
+// fills the other half.
+//*****************************************************************************
+void ADC0SS0_Handler(void) {
+    ADCIntClearEx(ADC0_BASE, ADC_INT_DMA_SS0);
+    if (uDMAChannelModeGet(UDMA_CH14_ADC0_0 | UDMA_PRI_SELECT) == UDMA_MODE_STOP) {
+        deliver_block(blocks[0]);
+        arm_block(UDMA_PRI_SELECT, blocks[0]);
+    }
+    if (uDMAChannelModeGet(UDMA_CH14_ADC0_0 | UDMA_ALT_SELECT) == UDMA_MODE_STOP) {
+        deliver_block(blocks[1]);
+        arm_block(UDMA_ALT_SELECT, blocks[1]);
+    }
+    if (block_callback) block_callback();
+}
+
+//*****************************************************************************
+// Reads the next sample of each channel.
+//*****************************************************************************
+bool audio_read(uint16_t *left, uint16_t *right) {
+    uint32_t pair;
+    
+    if (!ring_pop(&pair_ring, &pair)) return false;
+    
+    *left = (uint16_t) pair;
+    *right = (uint16_t) (pair >> 16);
+    return true;
+}
+
+//*****************************************************************************
+// Sample pairs waiting in the ring.
+//*****************************************************************************
+uint32_t audio_pending(void) {
+    return ring_count(&pair_ring);
+}
+
+//*****************************************************************************
+// Sample pairs dropped because the ring was full.
+//*****************************************************************************
+uint32_t audio_overruns(void) {
+    return pair_ring.overruns;
+}
+
+//*****************************************************************************
+// Most sample pairs ever waiting in the ring at once.
+//*****************************************************************************
+uint32_t audio_high_water(void) {
+    return pair_ring.high_water;
+}
@@ -1,7 +1,10 @@
 //*****************************************************************************
 // Audio Library for Tiva LaunchPad
 // Usage: Connect normalized left channel output to GPIO port E pin 3 and 
-// normalized right channel output to GPIO port E pin 2.
+// normalized right channel output to GPIO port E pin 2. Samples are 
+// captured by the uDMA controller into ping-pong blocks and handed to the 
+// main loop through a ring of stereo pairs, so call dma_config() before 
+// audio_config(), then fetch sample pairs with audio_read().
 // Author: Zachary Zhou
 //*****************************************************************************
 
@@ -16,13 +19,53 @@
 #include "driverlib/gpio.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/timer.h"
+#include "driverlib/udma.h"
+#include "inc/hw_adc.h"
 #include "inc/hw_ints.h"
 #include "inc/hw_memmap.h"
+#include "ring.h"
 #include "TM4C123.h"
 
+#define AUDIO_SAMPLE_RATE 10000  // Samples per second on each channel
+
+// Sample pairs in each half of the ping-pong buffer; one interrupt is taken 
+// per block. A uDMA transfer moves at most 1024 items, i.e. 512 pairs.
+#define AUDIO_BLOCK_SIZE 128
+
+#if AUDIO_BLOCK_SIZE > 512
+#  error "AUDIO_BLOCK_SIZE must be at most 512"
+#endif
+
+//*****************************************************************************
+// Configures the GPIO pins connected to the audio channels appropriately. 
+// 'block_ready' is called from the capture ISR each time a block of samples 
+// has been added to the ring.
+//*****************************************************************************
+void audio_config(void (*block_ready)(void));
+
+//*****************************************************************************
+// Reads the next 12-bit sample of each channel, returning false if none is 
+// available yet. Both samples of a pair come from the same conversion 
+// sequence, and the pair travels through the ring as one item, so the 
+// channels stay aligned even after an overrun. Never masks interrupts.
+//*****************************************************************************
+bool audio_read(uint16_t *left, uint16_t *right);
+
+//*****************************************************************************
+// Sample pairs waiting to be read.
+//*****************************************************************************
+uint32_t audio_pending(void);
+
+//*****************************************************************************
+// Sample pairs dropped because the main loop fell more than RING_SIZE pairs 
+// behind.
+//*****************************************************************************
+uint32_t audio_overruns(void);
+
 //*****************************************************************************
-// Configures the GPIO pins connected to the audio channels appropriately.
+// Most sample pairs ever waiting in the ring at once; how close the main 
+// loop has come to an overrun.
 //*****************************************************************************
-void audio_config(void);
+uint32_t audio_high_water(void);
 
 #endif
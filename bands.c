@@ -0,0 +1,147 @@
+//*****************************************************************************
+// Band Selection Library
+// Usage: Convert each spectrum bin to integer power with bands_power() (or 
+//   bands_quantize() for a power already computed in floating point). Once 
+//   per frame, call bands_update_averages() and then bands_select() to find 
+//   the bands whose power stands furthest above their own moving average. 
+//   Everything after the conversion is integer arithmetic: averages are 
+//   shift-based exponential moving averages, ratios are compared by 
+//   cross-multiplication and the best bands are kept in a small heap.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "bands.h"
+
+//*****************************************************************************
+// Converts a power |X|^2 to integer power, saturating at BANDS_MAX_POWER.
+//*****************************************************************************
+uint32_t bands_quantize(float power) {
+    float scaled = power * (1 << BANDS_POWER_SHIFT);
+    
+    // Rounding can leave a computed power slightly negative
+    if (scaled <= 0.0f) return 0;
+    if (scaled >= (float) BANDS_MAX_POWER) return BANDS_MAX_POWER;
+    return (uint32_t) scaled;
+}
+
+//*****************************************************************************
+// Integer power of a complex spectrum bin.
+//*****************************************************************************
+uint32_t bands_power(float complex bin) {
+    float re = crealf(bin);
+    float im = cimagf(bin);
+    
+    return bands_quantize(re*re + im*im);
+}
+
+//*****************************************************************************
+// Saturated sum of two spectra.
+//*****************************************************************************
+void bands_combine(const uint32_t *left, const uint32_t *right, uint32_t *combined, uint16_t num_bands) {
+    uint16_t i;
+    
+    // Both inputs are at most BANDS_MAX_POWER, so the sum itself cannot wrap
+    for (i = 1; i < num_bands; i++) {
+        uint32_t sum = left[i] + right[i];
+        combined[i] = (sum > BANDS_MAX_POWER) ? BANDS_MAX_POWER : sum;
+    }
+}
+
+//*****************************************************************************
+// Folds one frame of 'power' into the scaled moving averages.
+//*****************************************************************************
+void bands_update_averages(const uint32_t *power, uint64_t *averages, uint16_t num_bands) {
+    uint16_t i;
+    
+    for (i = 1; i < num_bands; i++) {
+        if (averages[i] == 0) averages[i] = (uint64_t) power[i] << BANDS_EMA_SHIFT;
+        else averages[i] += power[i] - (averages[i] >> BANDS_EMA_SHIFT);
+    }
+}
+
+//*****************************************************************************
+// Returns true if band a's ratio of power to average is below band b's, 
+// i.e. power[a]/avg[a] < power[b]/avg[b] with both sides multiplied out. The 
+// denominators are offset by 1 so that a zero average is harmless; every 
+// factor is below 2^31, so the products fit in 64 bits.
+//*****************************************************************************
+static bool ratio_less(const uint32_t *power, const uint64_t *averages, uint16_t a, uint16_t b) {
+    uint32_t average_a = (uint32_t) (averages[a] >> BANDS_EMA_SHIFT) + 1;
+    uint32_t average_b = (uint32_t) (averages[b] >> BANDS_EMA_SHIFT) + 1;
+    
+    return (uint64_t) power[a] * average_b < (uint64_t) power[b] * average_a;
+}
+
+//*****************************************************************************
+// Restores the min-heap order (smallest ratio at the root) of the 'size' 
+// bands in 'heap' after the one at 'idx' may have grown.
+//*****************************************************************************
+static void sift_down(const uint32_t *power, const uint64_t *averages, uint16_t *heap, uint8_t size, uint8_t idx) {
+    while (1) {
+        uint8_t smallest = idx;
+        uint8_t child = 2*idx + 1;
+        uint16_t temp;
+        
+        if ((child < size) && ratio_less(power, averages, heap[child], heap[smallest])) smallest = child;
+        child++;
+        if ((child < size) && ratio_less(power, averages, heap[child], heap[smallest])) smallest = child;
+        if (smallest == idx) return;
+        
+        temp = heap[idx];
+        heap[idx] = heap[smallest];
+        heap[smallest] = temp;
+        idx = smallest;
+    }
+}
+
+//*****************************************************************************
+// Restores the min-heap order of 'heap' after the band at 'idx' was added.
+//*****************************************************************************
+static void sift_up(const uint32_t *power, const uint64_t *averages, uint16_t *heap, uint8_t idx) {
+    while (idx > 0) {
+        uint8_t parent = (idx - 1) / 2;
+        uint16_t temp;
+        
+        if (!ratio_less(power, averages, heap[idx], heap[parent])) return;
+        
+        temp = heap[idx];
+        heap[idx] = heap[parent];
+        heap[parent] = temp;
+        idx = parent;
+    }
+}
+
+//*****************************************************************************
+// Finds the 'k' bands with the largest ratio of power to average.
+//*****************************************************************************
+uint8_t bands_select(const uint32_t *power, const uint64_t *averages, uint16_t num_bands, uint16_t *best, uint8_t k) {
+    uint8_t size = 0;
+    uint16_t i, temp;
+    
+    if (k == 0) return 0;
+    
+    // 'best' is a min-heap of the k best bands so far; a band only needs to 
+    // beat the root, the weakest of them, to get in
+    for (i = 1; i < num_bands; i++) {
+        if (size < k) {
+            best[size] = i;
+            sift_up(power, averages, best, size);
+            size++;
+        }
+        else if (ratio_less(power, averages, best[0], i)) {
+            best[0] = i;
+            sift_down(power, averages, best, size, 0);
+        }
+    }
+    
+    // Heap sort: moving each root (the weakest band left) to the end leaves 
+    // 'best' in decreasing order of ratio
+    for (i = size; i > 1; i--) {
+        temp = best[0];
+        best[0] = best[i - 1];
+        best[i - 1] = temp;
+        sift_down(power, averages, best, i - 1, 0);
+    }
+    
+    return size;
+}
@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Band Selection Library
+// Usage: Convert each spectrum bin to integer power with bands_power() (or 
+//   bands_quantize() for a power already computed in floating point). Once 
+//   per frame, call bands_update_averages() and then bands_select() to find 
+//   the bands whose power stands furthest above their own moving average. 
+//   Everything after the conversion is integer arithmetic: averages are 
+//   shift-based exponential moving averages, ratios are compared by 
+//   cross-multiplication and the best bands are kept in a small heap.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __BANDS_H__
+#define __BANDS_H__
+
+#include <complex.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Power is |X|^2 in units of 2^-BANDS_POWER_SHIFT, saturated at 
+// BANDS_MAX_POWER so that the sum of two channels cannot overflow and 
+// ratio products fit in 64 bits
+#define BANDS_POWER_SHIFT 12
+#define BANDS_MAX_POWER   0x7FFFFFFFu
+
+// Moving averages weigh each new frame by 2^-BANDS_EMA_SHIFT, i.e. they 
+// follow roughly the last 2^BANDS_EMA_SHIFT frames
+#define BANDS_EMA_SHIFT 6
+
+//*****************************************************************************
+// Converts a power |X|^2 to integer power, saturating at BANDS_MAX_POWER.
+//*****************************************************************************
+uint32_t bands_quantize(float power);
+
+//*****************************************************************************
+// Integer power of a complex spectrum bin; no square root is taken.
+//*****************************************************************************
+uint32_t bands_power(float complex bin);
+
+//*****************************************************************************
+// Writes the saturated sum of 'left' and 'right' to 'combined' for indices 1 
+// to num_bands - 1.
+//*****************************************************************************
+void bands_combine(const uint32_t *left, const uint32_t *right, uint32_t *combined, uint16_t num_bands);
+
+//*****************************************************************************
+// Folds one frame of 'power' into 'averages' for indices 1 to 
+// num_bands - 1. Each average is kept scaled by 2^BANDS_EMA_SHIFT, so it 
+// settles exactly on a constant input and never drifts however long the 
+// organ runs. An average of zero (e.g. before the first frame) is seeded 
+// with the current power.
+//*****************************************************************************
+void bands_update_averages(const uint32_t *power, uint64_t *averages, uint16_t num_bands);
+
+//*****************************************************************************
+// Finds the (at most) 'k' bands among indices 1 to num_bands - 1 with the 
+// largest ratio of power to average and writes them to 'best' in decreasing 
+// order of ratio. Costs O(num_bands * log k). Returns the number of bands 
+// written.
+//*****************************************************************************
+uint8_t bands_select(const uint32_t *power, const uint64_t *averages, uint16_t num_bands, uint16_t *best, uint8_t k);
+
+#endif
@@ -0,0 +1,30 @@
+//*****************************************************************************
+// System Clock Utility for Tiva LaunchPad
+// Usage: Choose CLOCK_HZ in clock_hz.h and call clock_config() before 
+//   configuring any other peripheral, since their rates are derived from 
+//   SysCtlClockGet(). neopixels.s includes clock_hz.h as well and derives 
+//   the NeoPixel driver's delays from the same value.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "clock.h"
+
+// The PLL runs at 400 MHz and is divided by 2 before SYSDIV
+#if CLOCK_HZ == 80000000
+#  define CLOCK_SOURCE (SYSCTL_SYSDIV_2_5 | SYSCTL_USE_PLL)
+#elif CLOCK_HZ == 50000000
+#  define CLOCK_SOURCE (SYSCTL_SYSDIV_4 | SYSCTL_USE_PLL)
+#elif CLOCK_HZ == 40000000
+#  define CLOCK_SOURCE (SYSCTL_SYSDIV_5 | SYSCTL_USE_PLL)
+#elif CLOCK_HZ == 16000000
+#  define CLOCK_SOURCE (SYSCTL_SYSDIV_1 | SYSCTL_USE_OSC)
+#else
+#  error "CLOCK_HZ must be 16000000, 40000000, 50000000 or 80000000"
+#endif
+
+//*****************************************************************************
+// Runs the system clock at CLOCK_HZ from the 16 MHz crystal.
+//*****************************************************************************
+void clock_config(void) {
+    SysCtlClockSet(CLOCK_SOURCE | SYSCTL_OSC_MAIN | SYSCTL_XTAL_16MHZ);
+}
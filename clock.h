@@ -0,0 +1,23 @@
+//*****************************************************************************
+// System Clock Utility for Tiva LaunchPad
+// Usage: Choose CLOCK_HZ in clock_hz.h and call clock_config() before 
+//   configuring any other peripheral, since their rates are derived from 
+//   SysCtlClockGet(). neopixels.s includes clock_hz.h as well and derives 
+//   the NeoPixel driver's delays from the same value.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __CLOCK_H__
+#define __CLOCK_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driverlib/sysctl.h"
+#include "clock_hz.h"
+
+//*****************************************************************************
+// Runs the system clock at CLOCK_HZ from the 16 MHz crystal.
+//*****************************************************************************
+void clock_config(void);
+
+#endif
@@ -0,0 +1,16 @@
+//*****************************************************************************
+// System Clock Rate
+// Usage: Choose CLOCK_HZ below. This header holds preprocessor definitions 
+//   only, so that the C sources (through clock.h) and neopixels.s 
+//   (assembled with armasm --cpreproc) both take the clock from here.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __CLOCK_HZ_H__
+#define __CLOCK_HZ_H__
+
+// System clock in Hz: 16000000 (crystal, no PLL), or 40000000, 50000000 or 
+// 80000000 from the 400 MHz PLL
+#define CLOCK_HZ 80000000
+
+#endif
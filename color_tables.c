@@ -0,0 +1,134 @@
+//*****************************************************************************
+// Colour Lookup Tables
+// Generated by tools/gen_color_tables.c; do not edit by hand.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "neopixels.h"
+
+#if NUM_NEOPIXELS != 150
+#  error "Regenerate color_tables.c for NUM_NEOPIXELS"
+#endif
+
+const uint32_t color_wavelength_palette[COLOR_NUM_WAVELENGTHS] = {
+    0x610061, 0x640065, 0x67006A, 0x6A006E, 0x6C0073, 0x6F0077,
+    0x71007B, 0x73007F, 0x750084, 0x770088, 0x79008C, 0x7B0090,
+    0x7C0094, 0x7D0098, 0x7E009C, 0x7F00A0, 0x8000A4, 0x8100A8,
+    0x8100AC, 0x8200B0, 0x8200B4, 0x8200B8, 0x8200BC, 0x8200C0,
+    0x8200C4, 0x8100C7, 0x8100CB, 0x8000CF, 0x7F00D3, 0x7E00D6,
+    0x7D00DA, 0x7C00DE, 0x7A00E2, 0x7900E5, 0x7700E9, 0x7500EC,
+    0x7300F0, 0x7100F4, 0x6F00F7, 0x6C00FB, 0x6900FF, 0x6500FF,
+    0x6100FF, 0x5C00FF, 0x5800FF, 0x5400FF, 0x4F00FF, 0x4B00FF,
+    0x4600FF, 0x4100FF, 0x3C00FF, 0x3700FF, 0x3200FF, 0x2D00FF,
+    0x2800FF, 0x2200FF, 0x1D00FF, 0x1700FF, 0x1000FF, 0x0900FF,
+    0x0000FF, 0x000BFF, 0x0013FF, 0x001AFF, 0x0021FF, 0x0028FF,
+    0x002EFF, 0x0034FF, 0x003AFF, 0x0040FF, 0x0046FF, 0x004BFF,
+    0x0051FF, 0x0056FF, 0x005CFF, 0x0061FF, 0x0066FF, 0x006BFF,
+    0x0070FF, 0x0075FF, 0x007AFF, 0x007FFF, 0x0084FF, 0x0089FF,
+    0x008DFF, 0x0092FF, 0x0097FF, 0x009BFF, 0x00A0FF, 0x00A4FF,
+    0x00A9FF, 0x00ADFF, 0x00B2FF, 0x00B6FF, 0x00BBFF, 0x00BFFF,
+    0x00C4FF, 0x00C8FF, 0x00CCFF, 0x00D1FF, 0x00D5FF, 0x00D9FF,
+    0x00DDFF, 0x00E2FF, 0x00E6FF, 0x00EAFF, 0x00EEFF, 0x00F2FF,
+    0x00F6FF, 0x00FAFF, 0x00FFFF, 0x00FFF4, 0x00FFEA, 0x00FFDF,
+    0x00FFD5, 0x00FFCA, 0x00FFBF, 0x00FFB4, 0x00FFA9, 0x00FF9E,
+    0x00FF92, 0x00FF86, 0x00FF7A, 0x00FF6E, 0x00FF61, 0x00FF54,
+    0x00FF46, 0x00FF37, 0x00FF28, 0x00FF17, 0x00FF00, 0x08FF00,
+    0x0EFF00, 0x14FF00, 0x19FF00, 0x1EFF00, 0x23FF00, 0x28FF00,
+    0x2CFF00, 0x31FF00, 0x35FF00, 0x3AFF00, 0x3EFF00, 0x42FF00,
+    0x46FF00, 0x4AFF00, 0x4EFF00, 0x52FF00, 0x56FF00, 0x59FF00,
+    0x5DFF00, 0x61FF00, 0x65FF00, 0x68FF00, 0x6CFF00, 0x6FFF00,
+    0x73FF00, 0x77FF00, 0x7AFF00, 0x7EFF00, 0x81FF00, 0x84FF00,
+    0x88FF00, 0x8BFF00, 0x8FFF00, 0x92FF00, 0x95FF00, 0x99FF00,
+    0x9CFF00, 0x9FFF00, 0xA2FF00, 0xA6FF00, 0xA9FF00, 0xACFF00,
+    0xAFFF00, 0xB3FF00, 0xB6FF00, 0xB9FF00, 0xBCFF00, 0xBFFF00,
+    0xC2FF00, 0xC5FF00, 0xC9FF00, 0xCCFF00, 0xCFFF00, 0xD2FF00,
+    0xD5FF00, 0xD8FF00, 0xDBFF00, 0xDEFF00, 0xE1FF00, 0xE4FF00,
+    0xE7FF00, 0xEAFF00, 0xEDFF00, 0xF0FF00, 0xF3FF00, 0xF6FF00,
+    0xF9FF00, 0xFCFF00, 0xFFFF00, 0xFFFB00, 0xFFF800, 0xFFF500,
+    0xFFF200, 0xFFEF00, 0xFFEB00, 0xFFE800, 0xFFE500, 0xFFE200,
+    0xFFDF00, 0xFFDB00, 0xFFD800, 0xFFD500, 0xFFD200, 0xFFCE00,
+    0xFFCB00, 0xFFC800, 0xFFC400, 0xFFC100, 0xFFBE00, 0xFFBA00,
+    0xFFB700, 0xFFB300, 0xFFB000, 0xFFAC00, 0xFFA900, 0xFFA500,
+    0xFFA200, 0xFF9E00, 0xFF9B00, 0xFF9700, 0xFF9400, 0xFF9000,
+    0xFF8D00, 0xFF8900, 0xFF8500, 0xFF8100, 0xFF7E00, 0xFF7A00,
+    0xFF7600, 0xFF7200, 0xFF6F00, 0xFF6B00, 0xFF6700, 0xFF6300,
+    0xFF5F00, 0xFF5B00, 0xFF5700, 0xFF5300, 0xFF4E00, 0xFF4A00,
+    0xFF4600, 0xFF4200, 0xFF3D00, 0xFF3900, 0xFF3400, 0xFF2F00,
+    0xFF2A00, 0xFF2500, 0xFF2000, 0xFF1B00, 0xFF1500, 0xFF0F00,
+    0xFF0900, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xFF0000, 0xFF0000, 0xFD0000, 0xFB0000, 0xF90000,
+    0xF70000, 0xF60000, 0xF40000, 0xF20000, 0xF00000, 0xEE0000,
+    0xEC0000, 0xEB0000, 0xE90000, 0xE70000, 0xE50000, 0xE30000,
+    0xE20000, 0xE00000, 0xDE0000, 0xDC0000, 0xDA0000, 0xD80000,
+    0xD60000, 0xD50000, 0xD30000, 0xD10000, 0xCF0000, 0xCD0000,
+    0xCB0000, 0xC90000, 0xC70000, 0xC50000, 0xC40000, 0xC20000,
+    0xC00000, 0xBE0000, 0xBC0000, 0xBA0000, 0xB80000, 0xB60000,
+    0xB40000, 0xB20000, 0xB00000, 0xAE0000, 0xAC0000, 0xAA0000,
+    0xA80000, 0xA60000, 0xA40000, 0xA20000, 0xA00000, 0x9E0000,
+    0x9C0000, 0x9A0000, 0x980000, 0x960000, 0x940000, 0x920000,
+    0x900000, 0x8E0000, 0x8C0000, 0x8A0000, 0x880000, 0x860000,
+    0x840000, 0x820000, 0x7F0000, 0x7D0000, 0x7B0000, 0x790000,
+    0x770000, 0x750000, 0x730000, 0x700000, 0x6E0000, 0x6C0000,
+    0x6A0000, 0x680000, 0x650000, 0x630000, 0x610000,
+};
+
+const uint32_t color_led_palette[NUM_NEOPIXELS] = {
+    0x610061, 0x6A006E, 0x6F0077, 0x750084, 0x7B0090, 0x7D0098,
+    0x8000A4, 0x8200B0, 0x8200B8, 0x8200C4, 0x8000CF, 0x7E00D6,
+    0x7A00E2, 0x7500EC, 0x7100F4, 0x6900FF, 0x5C00FF, 0x5400FF,
+    0x4600FF, 0x3700FF, 0x2D00FF, 0x1D00FF, 0x0900FF, 0x000BFF,
+    0x0021FF, 0x0034FF, 0x0040FF, 0x0051FF, 0x0061FF, 0x006BFF,
+    0x007AFF, 0x0089FF, 0x0092FF, 0x00A0FF, 0x00ADFF, 0x00B6FF,
+    0x00C4FF, 0x00D1FF, 0x00D9FF, 0x00E6FF, 0x00F2FF, 0x00FAFF,
+    0x00FFEA, 0x00FFCA, 0x00FFB4, 0x00FF92, 0x00FF6E, 0x00FF54,
+    0x00FF28, 0x08FF00, 0x14FF00, 0x23FF00, 0x31FF00, 0x3AFF00,
+    0x46FF00, 0x52FF00, 0x59FF00, 0x65FF00, 0x6FFF00, 0x77FF00,
+    0x81FF00, 0x8BFF00, 0x92FF00, 0x9CFF00, 0xA6FF00, 0xACFF00,
+    0xB6FF00, 0xBFFF00, 0xC5FF00, 0xCFFF00, 0xD8FF00, 0xDEFF00,
+    0xE7FF00, 0xF0FF00, 0xF6FF00, 0xFFFF00, 0xFFF500, 0xFFEF00,
+    0xFFE500, 0xFFDB00, 0xFFD500, 0xFFCB00, 0xFFC100, 0xFFBA00,
+    0xFFB000, 0xFFA500, 0xFF9E00, 0xFF9400, 0xFF8900, 0xFF8100,
+    0xFF7600, 0xFF6B00, 0xFF6300, 0xFF5700, 0xFF4A00, 0xFF4200,
+    0xFF3400, 0xFF2500, 0xFF1B00, 0xFF0900, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000, 0xFF0000,
+    0xFF0000, 0xF90000, 0xF60000, 0xF00000, 0xEB0000, 0xE70000,
+    0xE20000, 0xDC0000, 0xD80000, 0xD30000, 0xCD0000, 0xC90000,
+    0xC40000, 0xBE0000, 0xBA0000, 0xB40000, 0xAE0000, 0xAA0000,
+    0xA40000, 0x9E0000, 0x9A0000, 0x940000, 0x8E0000, 0x8A0000,
+    0x840000, 0x7D0000, 0x790000, 0x730000, 0x6C0000, 0x680000,
+};
+
+const uint8_t color_output[256] = {
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,
+     12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,
+     24,  25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,
+     36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+     48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,
+     60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+     72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,
+     84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,
+     96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
+    156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+    168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+    180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203,
+    204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
+    216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227,
+    228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+    252, 253, 254, 255,
+};
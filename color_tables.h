@@ -0,0 +1,30 @@
+//*****************************************************************************
+// Colour Lookup Tables
+// Usage: Constant palettes and output curves, generated ahead of time by 
+//   tools/gen_color_tables.c so that they live in flash and no colour needs 
+//   pow() at run time.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __COLOR_TABLES_H__
+#define __COLOR_TABLES_H__
+
+#include <stdint.h>
+
+#define COLOR_MIN_WAVELENGTH  380  // nm
+#define COLOR_MAX_WAVELENGTH  780  // nm
+#define COLOR_NUM_WAVELENGTHS (COLOR_MAX_WAVELENGTH - COLOR_MIN_WAVELENGTH + 1)
+
+// 24-bit RGB code of each whole wavelength from COLOR_MIN_WAVELENGTH up
+extern const uint32_t color_wavelength_palette[COLOR_NUM_WAVELENGTHS];
+
+// Base colour of each of the NUM_NEOPIXELS LEDs, violet first
+extern const uint32_t color_led_palette[];
+
+// Output curve the drivers look up every byte in as flash_neopixels() sends 
+// it: gamma correction, then global brightness, in one table. Generated as 
+// the identity (gamma 1.0, full brightness), so colours are sent as set; 
+// the palettes already carry Bruton's 0.8 gamma.
+extern const uint8_t color_output[256];
+
+#endif
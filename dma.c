@@ -0,0 +1,24 @@
+//*****************************************************************************
+// uDMA Utility for Tiva LaunchPad
+// Usage: Call dma_config() once, before configuring any peripheral that 
+//   transfers data through the uDMA controller. It enables the controller 
+//   and hands it the channel control table shared by every channel.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "dma.h"
+
+// Primary and alternate control structures for all 32 channels; the 
+// controller requires the table to be 1024-byte aligned
+static tDMAControlTable control_table[64] __attribute__((aligned(1024)));
+
+//*****************************************************************************
+// Enables the uDMA controller and sets its channel control table.
+//*****************************************************************************
+void dma_config(void) {
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_UDMA));
+    
+    uDMAEnable();
+    uDMAControlBaseSet(control_table);
+}
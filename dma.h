@@ -0,0 +1,25 @@
+//*****************************************************************************
+// uDMA Utility for Tiva LaunchPad
+// Usage: Call dma_config() once, before configuring any peripheral that 
+//   transfers data through the uDMA controller. It enables the controller 
+//   and hands it the channel control table shared by every channel.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __DMA_H__
+#define __DMA_H__
+
+#define PART_TM4C123GH6PM
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driverlib/sysctl.h"
+#include "driverlib/udma.h"
+#include "TM4C123.h"
+
+//*****************************************************************************
+// Enables the uDMA controller and sets its channel control table.
+//*****************************************************************************
+void dma_config(void);
+
+#endif
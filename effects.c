@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Packed LED Effects Library
+// Usage: Byte layers (LED levels or colour channels) are processed four 
+//   bytes at a time with saturating packed arithmetic, so pad every layer 
+//   to EFFECTS_PADDED() bytes and align it to 4 bytes. On a Cortex-M4 the 
+//   SIMD instructions UQADD8 and UQSUB8 are used; everywhere else (e.g. x86 
+//   Linux) the same arithmetic is done with portable SWAR C, bit for bit. 
+//   tools/check_effects.c checks both against a scalar reference.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "effects.h"
+
+#if defined(__TARGET_FEATURE_DSPMUL) || defined(__ARM_FEATURE_DSP)
+#  define EFFECTS_USE_SIMD
+#  define PART_TM4C123GH6PM
+#  include "TM4C123.h"
+#endif
+
+#define LOW_BITS  0x7F7F7F7Fu  // All but the top bit of each byte
+#define HIGH_BITS 0x80808080u  // Top bit of each byte
+#define ONES      0x01010101u  // 1 in each byte
+
+//*****************************************************************************
+// Expands the top bit of each byte into a whole-byte mask.
+//*****************************************************************************
+#ifndef EFFECTS_USE_SIMD
+static uint32_t byte_mask(uint32_t top_bits) {
+    return (top_bits >> 7) * 0xFF;
+}
+#endif
+
+//*****************************************************************************
+// Bytewise saturating add and saturating subtract.
+//*****************************************************************************
+static uint32_t add8(uint32_t a, uint32_t b) {
+#ifdef EFFECTS_USE_SIMD
+    return __UQADD8(a, b);
+#else
+    uint32_t sum = ((a & LOW_BITS) + (b & LOW_BITS)) ^ ((a ^ b) & HIGH_BITS);
+    uint32_t carries = ((a & b) | ((a | b) & ~sum)) & HIGH_BITS;
+    return sum | byte_mask(carries);
+#endif
+}
+
+static uint32_t sub8(uint32_t a, uint32_t b) {
+#ifdef EFFECTS_USE_SIMD
+    return __UQSUB8(a, b);
+#else
+    uint32_t difference = ((a | HIGH_BITS) - (b & LOW_BITS)) ^ ((a ^ ~b) & HIGH_BITS);
+    uint32_t borrows = ((~a & b) | (~(a ^ b) & difference)) & HIGH_BITS;
+    return difference & ~byte_mask(borrows);
+#endif
+}
+
+//*****************************************************************************
+// Bytewise x - max(x >> shift, 1), saturating at 0.
+//*****************************************************************************
+static uint32_t fade8(uint32_t x, uint8_t shift) {
+    // Shifting the word drags bits across bytes; the mask drops them
+    uint32_t step = (x >> shift) & ((0xFFu >> shift) * ONES);
+    return sub8(sub8(x, step), sub8(ONES, step));
+}
+
+//*****************************************************************************
+// Layer functions; each handles one word per iteration.
+//*****************************************************************************
+void effects_fade(uint8_t *layer, uint16_t num_bytes, uint8_t shift) {
+    uint32_t *words = (uint32_t *) layer;
+    uint16_t i;
+    
+    for (i = 0; i < EFFECTS_PADDED(num_bytes)/4; i++) words[i] = fade8(words[i], shift);
+}
+
+void effects_add(uint8_t *dst, const uint8_t *src, uint16_t num_bytes) {
+    uint32_t *dst_words = (uint32_t *) dst;
+    const uint32_t *src_words = (const uint32_t *) src;
+    uint16_t i;
+    
+    for (i = 0; i < EFFECTS_PADDED(num_bytes)/4; i++) dst_words[i] = add8(dst_words[i], src_words[i]);
+}
+
+void effects_peak_hold(uint8_t *peaks, const uint8_t *levels, uint16_t num_bytes, uint8_t shift) {
+    uint32_t *peak_words = (uint32_t *) peaks;
+    const uint32_t *level_words = (const uint32_t *) levels;
+    uint16_t i;
+    
+    for (i = 0; i < EFFECTS_PADDED(num_bytes)/4; i++) {
+        // max(a, b) = b + (a - b saturated at 0)
+        uint32_t faded = fade8(peak_words[i], shift);
+        peak_words[i] = add8(sub8(faded, level_words[i]), level_words[i]);
+    }
+}
+
+//*****************************************************************************
+// Ripple functions.
+//*****************************************************************************
+void effects_ripple_start(effects_ripple_t *ripple, uint16_t center, uint8_t level) {
+    ripple->center = center;
+    ripple->radius = 0;
+    ripple->level = level;
+}
+
+void effects_ripple_step(effects_ripple_t *ripple, uint8_t *layer, uint16_t num_leds, uint8_t shift) {
+    bool drawn = false;
+    
+    if (!ripple->level) return;
+    
+    if (ripple->center + ripple->radius < num_leds) {
+        uint8_t *byte = &layer[ripple->center + ripple->radius];
+        if (*byte < ripple->level) *byte = ripple->level;
+        drawn = true;
+    }
+    if (ripple->radius <= ripple->center) {
+        uint8_t *byte = &layer[ripple->center - ripple->radius];
+        if (*byte < ripple->level) *byte = ripple->level;
+        drawn = true;
+    }
+    
+    // Both fronts off the strip or faded away
+    if (!drawn) {
+        ripple->level = 0;
+        return;
+    }
+    ripple->radius++;
+    ripple->level -= (ripple->level >> shift) ? (ripple->level >> shift) : 1;
+}
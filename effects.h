@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Packed LED Effects Library
+// Usage: Byte layers (LED levels or colour channels) are processed four 
+//   bytes at a time with saturating packed arithmetic, so pad every layer 
+//   to EFFECTS_PADDED() bytes and align it to 4 bytes. On a Cortex-M4 the 
+//   SIMD instructions UQADD8 and UQSUB8 are used; everywhere else (e.g. x86 
+//   Linux) the same arithmetic is done with portable SWAR C, bit for bit. 
+//   tools/check_effects.c checks both against a scalar reference.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __EFFECTS_H__
+#define __EFFECTS_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Size of a layer of 'n' bytes rounded up to whole words
+#define EFFECTS_PADDED(n) (((n) + 3) & ~3)
+
+// Ripple spreading outwards from 'center' by one LED per step
+typedef struct {
+    uint16_t center;
+    uint16_t radius;
+    uint8_t level;  // 0 once the ripple has died out
+} effects_ripple_t;
+
+//*****************************************************************************
+// Exponential fade: every byte loses 1/2^shift of itself, and at least 1, 
+// so that it reaches 0.
+//*****************************************************************************
+void effects_fade(uint8_t *layer, uint16_t num_bytes, uint8_t shift);
+
+//*****************************************************************************
+// Additive blend: dst = min(dst + src, 255).
+//*****************************************************************************
+void effects_add(uint8_t *dst, const uint8_t *src, uint16_t num_bytes);
+
+//*****************************************************************************
+// Peak-hold trail: fades 'peaks' as effects_fade(), then raises it to at 
+// least 'levels'.
+//*****************************************************************************
+void effects_peak_hold(uint8_t *peaks, const uint8_t *levels, uint16_t num_bytes, uint8_t shift);
+
+//*****************************************************************************
+// Starts a ripple at LED 'center' with brightness 'level'.
+//*****************************************************************************
+void effects_ripple_start(effects_ripple_t *ripple, uint16_t center, uint8_t level);
+
+//*****************************************************************************
+// Draws the ripple's two fronts into 'layer' (one byte per LED, 'num_leds' 
+// LEDs), raising the bytes they cover, then moves them out one LED and 
+// fades them by 1/2^shift. Does nothing once the ripple has died out.
+//*****************************************************************************
+void effects_ripple_step(effects_ripple_t *ripple, uint8_t *layer, uint16_t num_leds, uint8_t shift);
+
+#endif
@@ -4,71 +4,147 @@
 //*****************************************************************************
 
 #include "fft.h"
+#include "fft_tables.h"
 
-// Statically allocated array to hold output
-static double complex output[NUM_SAMPLES];
+// Twiddle table viewed as complex numbers
+#define TWIDDLE(k) (((const float complex *) fft_twiddles)[(k)])
 
 //*****************************************************************************
-// Reverses the bits of a number that can be encoded in at most 16 bits.
+// Helper function for fft(); permutes the samples into bit-reversed order.
 //*****************************************************************************
-static uint16_t reverse(uint16_t x) {
-    static uint16_t lut[NUM_SAMPLES];   // Lookup table
-    uint16_t x_reversed = 0x0000;       // Holds the value to be returned
-    uint16_t x_original = x;            // Stores the original value of 'x'
-    uint8_t i;
-    
-    // If lookup table already contains the value, return it
-    if ((lut[x] != 0) || (x == 0)) return lut[x];
-    
-    // Otherwise, compute the value and store it in the LUT
-    for (i = 0; i < (log(NUM_SAMPLES) / log(2)); i++) {
-        x_reversed <<= 1;
-        x_reversed |= x & 0x0001;
-        x >>= 1;
+static void bit_reverse_permute(float complex *data) {
+    uint16_t i, j;
+    for (i = 0; i < NUM_SAMPLES; i++) {
+        j = fft_bit_reverse[i];
+        if (i < j) {
+            float complex temp = data[i];
+            data[i] = data[j];
+            data[j] = temp;
+        }
     }
-    
-    // Store the value in the LUT
-    lut[x_original] = x_reversed;
-    
-    return x_reversed;
 }
 
 //*****************************************************************************
-// Helper function for fft().
+// Complex multiplication without the C99 NaN/infinity recovery path.
+//*****************************************************************************
+static float complex cmul(float complex a, float complex b) {
+    return (crealf(a)*crealf(b) - cimagf(a)*cimagf(b)) + 
+           (crealf(a)*cimagf(b) + cimagf(a)*crealf(b))*I;
+}
+
+//*****************************************************************************
+// Multiplies by -i, which only swaps and negates parts.
+//*****************************************************************************
+static float complex mul_neg_i(float complex z) {
+    return cimagf(z) - crealf(z)*I;
+}
+
+//*****************************************************************************
+// Radix-2 stage combining pairs of single points; every twiddle factor is 1.
 //*****************************************************************************
-static void bit_reverse_copy(double complex *samples) {
-    uint16_t i;
-    for (i = 0; i < NUM_SAMPLES; i++) output[reverse(i)] = samples[i];
+static void radix2_first_stage(float complex *data) {
+    for (uint16_t k = 0; k < NUM_SAMPLES; k += 2) {
+        float complex u = data[k];
+        float complex t = data[k + 1];
+        data[k] = u + t;
+        data[k + 1] = u - t;
+    }
 }
 
 //*****************************************************************************
-// Iterative implementation of the Cooley-Tukey radix-2 FFT algorithm.
+// Radix-4 stage combining four 'h'-point DFTs into 4h-point DFTs. Because 
+// the input is in (radix-2) bit-reversed order, the second and third 
+// quarters of each group hold the odd-even and even-odd subsequences.
 //*****************************************************************************
-double complex *fft(double complex *samples) {
-    bit_reverse_copy(samples);
+static void radix4_stage(float complex *data, uint16_t h) {
+    uint16_t stride = NUM_SAMPLES / (4 * h);
     
-    for (uint16_t s = 1; s <= log2(NUM_SAMPLES); s++) {
-        uint16_t m = pow(2, s);
-        
-        // Twiddle factor is a power of this
-        double complex w_m = cexp(-2 * PI * I / m);
-        
-        for (uint16_t k = 0; k < NUM_SAMPLES; k += m) {
-            // Twiddle factor
-            double complex w = 1;
+    for (uint16_t k = 0; k < NUM_SAMPLES; k += 4 * h) {
+        for (uint16_t j = 0; j < h; j++) {
+            float complex *x = &data[k + j];
+            
+            float complex a = x[0];
+            float complex b = cmul(x[h], TWIDDLE(2 * j * stride));
+            float complex c = cmul(x[2 * h], TWIDDLE(j * stride));
+            float complex d = cmul(x[3 * h], TWIDDLE(3 * j * stride));
+            
+            float complex s0 = a + b;
+            float complex s1 = a - b;
+            float complex s2 = c + d;
+            float complex s3 = mul_neg_i(c - d);
             
-            for (uint16_t j = 0; j < (m / 2); j++) {
-                // Butterfly operation
-                double complex t = w * output[k + j + (m / 2)];
-                double complex u = output[k + j];
-                output[k + j] = u + t;
-                output[k + j + (m / 2)] = u - t;
-                
-                // Adjust twiddle factor
-                w *= w_m;
-            }
+            x[0] = s0 + s2;
+            x[h] = s1 + s3;
+            x[2 * h] = s0 - s2;
+            x[3 * h] = s1 - s3;
         }
     }
+}
+
+//*****************************************************************************
+// Runs the butterflies on data that is already in bit-reversed order. Uses 
+// radix-4 stages throughout, preceded by one radix-2 stage when 
+// log2(NUM_SAMPLES) is odd.
+//*****************************************************************************
+void fft_bit_reversed(float complex *data) {
+    uint16_t h = 1;
+    
+    if (LOG2_NUM_SAMPLES % 2) {
+        radix2_first_stage(data);
+        h = 2;
+    }
     
-    return output;
+    for (; h < NUM_SAMPLES; h *= 4) radix4_stage(data, h);
+}
+
+//*****************************************************************************
+// Iterative, in-place Cooley-Tukey FFT. The caller owns 'data'; nothing is 
+// kept between calls.
+//*****************************************************************************
+void fft(float complex *data) {
+    bit_reverse_permute(data);
+    fft_bit_reversed(data);
+}
+
+//*****************************************************************************
+// Splits the spectrum of left + i*right using conjugate symmetry; bins k and 
+// NUM_SAMPLES - k are consumed together, so the split happens in place.
+//*****************************************************************************
+static void stereo_split(float complex *data) {
+    for (uint16_t k = 1; k < NUM_SAMPLES/2; k++) {
+        float complex x_k = data[k];
+        float complex x_n_k = conjf(data[NUM_SAMPLES - k]);
+        
+        // L[k] = (X[k] + X*[N - k]) / 2, R[k] = (X[k] - X*[N - k]) / 2i
+        data[k] = 0.5f * (x_k + x_n_k);
+        data[NUM_SAMPLES - k] = -0.5f * I * (x_k - x_n_k);
+    }
+}
+
+//*****************************************************************************
+// Transforms two real signals with a single complex FFT.
+//*****************************************************************************
+void fft_stereo(float complex *data) {
+    fft(data);
+    stereo_split(data);
+}
+
+//*****************************************************************************
+// Copies the NUM_SAMPLES samples of two circular histories, oldest first, 
+// into 'data' in bit-reversed order, applying the analysis window on the way.
+//*****************************************************************************
+void fft_stereo_load(float complex *data, const float *left, const float *right, 
+                     uint16_t oldest) {
+    for (uint16_t n = 0; n < NUM_SAMPLES; n++) {
+        uint16_t idx = (oldest + n) & (NUM_SAMPLES - 1);
+        data[fft_bit_reverse[n]] = fft_window[n] * (left[idx] + right[idx]*I);
+    }
+}
+
+//*****************************************************************************
+// Same as fft_stereo() for data loaded by fft_stereo_load().
+//*****************************************************************************
+void fft_stereo_bit_reversed(float complex *data) {
+    fft_bit_reversed(data);
+    stereo_split(data);
 }
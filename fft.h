@@ -14,11 +14,59 @@
 #  define PI 3.14159265358979323846
 #endif
 
-#define NUM_SAMPLES 128  // Must be a power of 2
+// Must be a power of 2 from 64 to 2048; host tools override it with 
+// -DNUM_SAMPLES to check every size
+#ifndef NUM_SAMPLES
+#  define NUM_SAMPLES 128
+#endif
+
+#if   NUM_SAMPLES == 64
+#  define LOG2_NUM_SAMPLES 6
+#elif NUM_SAMPLES == 128
+#  define LOG2_NUM_SAMPLES 7
+#elif NUM_SAMPLES == 256
+#  define LOG2_NUM_SAMPLES 8
+#elif NUM_SAMPLES == 512
+#  define LOG2_NUM_SAMPLES 9
+#elif NUM_SAMPLES == 1024
+#  define LOG2_NUM_SAMPLES 10
+#elif NUM_SAMPLES == 2048
+#  define LOG2_NUM_SAMPLES 11
+#else
+#  error "NUM_SAMPLES must be a power of 2 from 64 to 2048"
+#endif
 
 //*****************************************************************************
-// Iterative implementation of the Cooley-Tukey radix-2 FFT algorithm.
+// Iterative, in-place Cooley-Tukey FFT. Uses radix-4 stages throughout, 
+// preceded by one radix-2 stage when log2(NUM_SAMPLES) is odd. The caller 
+// owns 'data'; nothing is kept between calls.
 //*****************************************************************************
-double complex *fft(double complex *samples);
+void fft(float complex *data);
+
+//*****************************************************************************
+// Same as fft(), for data that is already in bit-reversed order.
+//*****************************************************************************
+void fft_bit_reversed(float complex *data);
+
+//*****************************************************************************
+// Transforms two real signals with a single complex FFT. On entry, 'data' 
+// holds the left channel in its real parts and the right channel in its 
+// imaginary parts. On exit, bin k (0 < k < NUM_SAMPLES/2) of each channel is 
+// available through STEREO_LEFT() and STEREO_RIGHT().
+//*****************************************************************************
+void fft_stereo(float complex *data);
+
+//*****************************************************************************
+// Builds an overlapping STFT frame: copies two circular sample histories of 
+// NUM_SAMPLES samples, starting from index 'oldest', into 'data' in 
+// bit-reversed order and applies the Hann window during the copy. The frame 
+// is then transformed with fft_stereo_bit_reversed().
+//*****************************************************************************
+void fft_stereo_load(float complex *data, const float *left, const float *right, 
+                     uint16_t oldest);
+void fft_stereo_bit_reversed(float complex *data);
+
+#define STEREO_LEFT(data, k)  ((data)[(k)])
+#define STEREO_RIGHT(data, k) ((data)[NUM_SAMPLES - (k)])
 
 #endif
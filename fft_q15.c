@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Fixed-Point Fast Fourier Transform Library
+// Usage: Pack Q15 samples into 32-bit words with Q15_COMPLEX() (real part in 
+//   the lower halfword, imaginary part in the upper halfword) and pass the 
+//   array to fft_q15(). On a Cortex-M4 the butterflies use the DSP dual-MAC 
+//   and SIMD instructions; everywhere else (e.g. x86 Linux) the same 
+//   arithmetic is done in portable C, bit for bit.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "fft_q15.h"
+#include "fft_tables.h"
+
+#if defined(__TARGET_FEATURE_DSPMUL) || defined(__ARM_FEATURE_DSP)
+#  define FFT_Q15_USE_DSP
+#  define PART_TM4C123GH6PM
+#  include "TM4C123.h"
+#endif
+
+//*****************************************************************************
+// Returns a value whose most significant set bit is that of the largest
+// magnitude among both halfwords of 'z' (ones' complement absolute value).
+//*****************************************************************************
+static uint16_t magnitude_bits(q15_complex_t z) {
+    int16_t re = Q15_REAL(z);
+    int16_t im = Q15_IMAG(z);
+    return (uint16_t) ((re ^ (re >> 15)) | (im ^ (im >> 15)));
+}
+
+//*****************************************************************************
+// Number of right shifts a stage must apply given the magnitude bits of its
+// inputs. A butterfly can grow a component by at most 1 + sqrt(2), so inputs
+// below 2^13 are safe unscaled and every stage's output stays below 20000.
+//*****************************************************************************
+static uint8_t stage_shift(uint16_t bits) {
+    if (bits >= 0x4000) return 2;
+    if (bits >= 0x2000) return 1;
+    return 0;
+}
+
+//*****************************************************************************
+// Butterfly on 'a' (top) and 'b' (bottom) with twiddle factor 'w', scaled
+// down by 2^shift. The product w*b is formed with two dual multiplies.
+//*****************************************************************************
+static void butterfly(q15_complex_t *a, q15_complex_t *b, q15_complex_t w,
+                      uint8_t shift) {
+    // Product is Q30; fold all but the final halving into its conversion so
+    // that it always fits in a halfword
+    uint8_t t_shift = 15 + ((shift > 0) ? shift - 1 : 0);
+    q15_complex_t u = *a;
+
+#ifdef FFT_Q15_USE_DSP
+    q15_complex_t t = __PKHBT(__SMUSD(*b, w) >> t_shift, __SMUADX(*b, w) >> t_shift, 16);
+    if (shift == 2) u = __SHADD16(u, 0);
+    if (shift == 0) {
+        *a = __QADD16(u, t);
+        *b = __QSUB16(u, t);
+    }
+    else {
+        *a = __SHADD16(u, t);
+        *b = __SHSUB16(u, t);
+    }
+#else
+    int32_t b_re = Q15_REAL(*b), b_im = Q15_IMAG(*b);
+    int32_t w_re = Q15_REAL(w), w_im = Q15_IMAG(w);
+    int32_t t_re = (b_re * w_re - b_im * w_im) >> t_shift;
+    int32_t t_im = (b_re * w_im + b_im * w_re) >> t_shift;
+    int32_t u_re = Q15_REAL(u), u_im = Q15_IMAG(u);
+    uint8_t out_shift = (shift > 0) ? 1 : 0;
+    
+    if (shift == 2) {
+        u_re >>= 1;
+        u_im >>= 1;
+    }
+    *a = Q15_COMPLEX((u_re + t_re) >> out_shift, (u_im + t_im) >> out_shift);
+    *b = Q15_COMPLEX((u_re - t_re) >> out_shift, (u_im - t_im) >> out_shift);
+#endif
+}
+
+//*****************************************************************************
+// In-place radix-2 FFT with block floating point scaling.
+//*****************************************************************************
+uint8_t fft_q15(q15_complex_t *data) {
+    uint16_t bits = 0;
+    uint8_t exponent = 0;
+    uint16_t i, j;
+    
+    // Bit-reversal permutation
+    for (i = 0; i < NUM_SAMPLES; i++) {
+        j = fft_bit_reverse[i];
+        if (i < j) {
+            q15_complex_t temp = data[i];
+            data[i] = data[j];
+            data[j] = temp;
+        }
+        bits |= magnitude_bits(data[i]);
+    }
+    
+    for (uint16_t half = 1; half < NUM_SAMPLES; half <<= 1) {
+        uint16_t stride = NUM_SAMPLES / (2 * half);
+        uint8_t shift = stage_shift(bits);
+        exponent += shift;
+        bits = 0;
+        
+        for (uint16_t k = 0; k < NUM_SAMPLES; k += 2 * half) {
+            for (j = 0; j < half; j++) {
+                q15_complex_t *a = &data[k + j];
+                q15_complex_t *b = &data[k + j + half];
+                butterfly(a, b, fft_q15_twiddles[j * stride], shift);
+                bits |= magnitude_bits(*a) | magnitude_bits(*b);
+            }
+        }
+    }
+    
+    return exponent;
+}
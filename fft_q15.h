@@ -0,0 +1,34 @@
+//*****************************************************************************
+// Fixed-Point Fast Fourier Transform Library
+// Usage: Pack Q15 samples into 32-bit words with Q15_COMPLEX() (real part in 
+//   the lower halfword, imaginary part in the upper halfword) and pass the 
+//   array to fft_q15(). On a Cortex-M4 the butterflies use the DSP dual-MAC 
+//   and SIMD instructions; everywhere else (e.g. x86 Linux) the same 
+//   arithmetic is done in portable C, bit for bit.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __FFT_Q15_H__
+#define __FFT_Q15_H__
+
+#include <stdint.h>
+#include "fft.h"
+
+// Q15 value packed as a complex number: imaginary part in bits 31-16, real
+// part in bits 15-0
+typedef uint32_t q15_complex_t;
+
+#define Q15_COMPLEX(re, im) \
+    ((q15_complex_t) (((uint32_t) (uint16_t) (im) << 16) | (uint16_t) (re)))
+#define Q15_REAL(z) ((int16_t) ((z) & 0xFFFF))
+#define Q15_IMAG(z) ((int16_t) ((z) >> 16))
+
+//*****************************************************************************
+// In-place radix-2 FFT with block floating point scaling. Each stage checks
+// the largest component produced by the previous one and shifts right by 0,
+// 1 or 2 bits so that no butterfly can overflow. Returns the total number of
+// shifts, i.e. the true DFT of the input is data[k] * 2^(return value).
+//*****************************************************************************
+uint8_t fft_q15(q15_complex_t *data);
+
+#endif
@@ -0,0 +1,4606 @@
+//*****************************************************************************
+// FFT Lookup Tables
+// Generated by tools/gen_fft_tables.c; do not edit by hand.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "fft_tables.h"
+
+#if NUM_SAMPLES == 64
+
+const float fft_twiddles[3*NUM_SAMPLES/4][2] = {
+    { 1.000000000f, -0.000000000f },
+    { 0.995184727f, -0.098017140f },
+    { 0.980785280f, -0.195090322f },
+    { 0.956940336f, -0.290284677f },
+    { 0.923879533f, -0.382683432f },
+    { 0.881921264f, -0.471396737f },
+    { 0.831469612f, -0.555570233f },
+    { 0.773010453f, -0.634393284f },
+    { 0.707106781f, -0.707106781f },
+    { 0.634393284f, -0.773010453f },
+    { 0.555570233f, -0.831469612f },
+    { 0.471396737f, -0.881921264f },
+    { 0.382683432f, -0.923879533f },
+    { 0.290284677f, -0.956940336f },
+    { 0.195090322f, -0.980785280f },
+    { 0.098017140f, -0.995184727f },
+    { 0.000000000f, -1.000000000f },
+    { -0.098017140f, -0.995184727f },
+    { -0.195090322f, -0.980785280f },
+    { -0.290284677f, -0.956940336f },
+    { -0.382683432f, -0.923879533f },
+    { -0.471396737f, -0.881921264f },
+    { -0.555570233f, -0.831469612f },
+    { -0.634393284f, -0.773010453f },
+    { -0.707106781f, -0.707106781f },
+    { -0.773010453f, -0.634393284f },
+    { -0.831469612f, -0.555570233f },
+    { -0.881921264f, -0.471396737f },
+    { -0.923879533f, -0.382683432f },
+    { -0.956940336f, -0.290284677f },
+    { -0.980785280f, -0.195090322f },
+    { -0.995184727f, -0.098017140f },
+    { -1.000000000f, -0.000000000f },
+    { -0.995184727f, 0.098017140f },
+    { -0.980785280f, 0.195090322f },
+    { -0.956940336f, 0.290284677f },
+    { -0.923879533f, 0.382683432f },
+    { -0.881921264f, 0.471396737f },
+    { -0.831469612f, 0.555570233f },
+    { -0.773010453f, 0.634393284f },
+    { -0.707106781f, 0.707106781f },
+    { -0.634393284f, 0.773010453f },
+    { -0.555570233f, 0.831469612f },
+    { -0.471396737f, 0.881921264f },
+    { -0.382683432f, 0.923879533f },
+    { -0.290284677f, 0.956940336f },
+    { -0.195090322f, 0.980785280f },
+    { -0.098017140f, 0.995184727f },
+};
+
+const uint32_t fft_q15_twiddles[NUM_SAMPLES/2] = {
+    0x00007FFF, 0xF3747F62, 0xE7077D8A, 0xDAD87A7D, 0xCF047642, 0xC3A970E3,
+    0xB8E36A6E, 0xAECC62F2, 0xA57E5A82, 0x9D0E5134, 0x9592471D, 0x8F1D3C57,
+    0x89BE30FC, 0x85832528, 0x827618F9, 0x809E0C8C, 0x80000000, 0x809EF374,
+    0x8276E707, 0x8583DAD8, 0x89BECF04, 0x8F1DC3A9, 0x9592B8E3, 0x9D0EAECC,
+    0xA57EA57E, 0xAECC9D0E, 0xB8E39592, 0xC3A98F1D, 0xCF0489BE, 0xDAD88583,
+    0xE7078276, 0xF374809E,
+};
+
+const float fft_window[NUM_SAMPLES] = {
+    0.000000000f, 0.004815273f, 0.019214720f, 0.043059664f, 0.076120467f,
+    0.118078736f, 0.168530388f, 0.226989547f, 0.292893219f, 0.365606716f,
+    0.444429767f, 0.528603263f, 0.617316568f, 0.709715323f, 0.804909678f,
+    0.901982860f, 1.000000000f, 1.098017140f, 1.195090322f, 1.290284677f,
+    1.382683432f, 1.471396737f, 1.555570233f, 1.634393284f, 1.707106781f,
+    1.773010453f, 1.831469612f, 1.881921264f, 1.923879533f, 1.956940336f,
+    1.980785280f, 1.995184727f, 2.000000000f, 1.995184727f, 1.980785280f,
+    1.956940336f, 1.923879533f, 1.881921264f, 1.831469612f, 1.773010453f,
+    1.707106781f, 1.634393284f, 1.555570233f, 1.471396737f, 1.382683432f,
+    1.290284677f, 1.195090322f, 1.098017140f, 1.000000000f, 0.901982860f,
+    0.804909678f, 0.709715323f, 0.617316568f, 0.528603263f, 0.444429767f,
+    0.365606716f, 0.292893219f, 0.226989547f, 0.168530388f, 0.118078736f,
+    0.076120467f, 0.043059664f, 0.019214720f, 0.004815273f,
+};
+
+const uint16_t fft_bit_reverse[NUM_SAMPLES] = {
+       0,   32,   16,   48,    8,   40,   24,   56,    4,   36,   20,   52,
+      12,   44,   28,   60,    2,   34,   18,   50,   10,   42,   26,   58,
+       6,   38,   22,   54,   14,   46,   30,   62,    1,   33,   17,   49,
+       9,   41,   25,   57,    5,   37,   21,   53,   13,   45,   29,   61,
+       3,   35,   19,   51,   11,   43,   27,   59,    7,   39,   23,   55,
+      15,   47,   31,   63,
+};
+
+#elif NUM_SAMPLES == 128
+
+const float fft_twiddles[3*NUM_SAMPLES/4][2] = {
+    { 1.000000000f, -0.000000000f },
+    { 0.998795456f, -0.049067674f },
+    { 0.995184727f, -0.098017140f },
+    { 0.989176510f, -0.146730474f },
+    { 0.980785280f, -0.195090322f },
+    { 0.970031253f, -0.242980180f },
+    { 0.956940336f, -0.290284677f },
+    { 0.941544065f, -0.336889853f },
+    { 0.923879533f, -0.382683432f },
+    { 0.903989293f, -0.427555093f },
+    { 0.881921264f, -0.471396737f },
+    { 0.857728610f, -0.514102744f },
+    { 0.831469612f, -0.555570233f },
+    { 0.803207531f, -0.595699304f },
+    { 0.773010453f, -0.634393284f },
+    { 0.740951125f, -0.671558955f },
+    { 0.707106781f, -0.707106781f },
+    { 0.671558955f, -0.740951125f },
+    { 0.634393284f, -0.773010453f },
+    { 0.595699304f, -0.803207531f },
+    { 0.555570233f, -0.831469612f },
+    { 0.514102744f, -0.857728610f },
+    { 0.471396737f, -0.881921264f },
+    { 0.427555093f, -0.903989293f },
+    { 0.382683432f, -0.923879533f },
+    { 0.336889853f, -0.941544065f },
+    { 0.290284677f, -0.956940336f },
+    { 0.242980180f, -0.970031253f },
+    { 0.195090322f, -0.980785280f },
+    { 0.146730474f, -0.989176510f },
+    { 0.098017140f, -0.995184727f },
+    { 0.049067674f, -0.998795456f },
+    { 0.000000000f, -1.000000000f },
+    { -0.049067674f, -0.998795456f },
+    { -0.098017140f, -0.995184727f },
+    { -0.146730474f, -0.989176510f },
+    { -0.195090322f, -0.980785280f },
+    { -0.242980180f, -0.970031253f },
+    { -0.290284677f, -0.956940336f },
+    { -0.336889853f, -0.941544065f },
+    { -0.382683432f, -0.923879533f },
+    { -0.427555093f, -0.903989293f },
+    { -0.471396737f, -0.881921264f },
+    { -0.514102744f, -0.857728610f },
+    { -0.555570233f, -0.831469612f },
+    { -0.595699304f, -0.803207531f },
+    { -0.634393284f, -0.773010453f },
+    { -0.671558955f, -0.740951125f },
+    { -0.707106781f, -0.707106781f },
+    { -0.740951125f, -0.671558955f },
+    { -0.773010453f, -0.634393284f },
+    { -0.803207531f, -0.595699304f },
+    { -0.831469612f, -0.555570233f },
+    { -0.857728610f, -0.514102744f },
+    { -0.881921264f, -0.471396737f },
+    { -0.903989293f, -0.427555093f },
+    { -0.923879533f, -0.382683432f },
+    { -0.941544065f, -0.336889853f },
+    { -0.956940336f, -0.290284677f },
+    { -0.970031253f, -0.242980180f },
+    { -0.980785280f, -0.195090322f },
+    { -0.989176510f, -0.146730474f },
+    { -0.995184727f, -0.098017140f },
+    { -0.998795456f, -0.049067674f },
+    { -1.000000000f, -0.000000000f },
+    { -0.998795456f, 0.049067674f },
+    { -0.995184727f, 0.098017140f },
+    { -0.989176510f, 0.146730474f },
+    { -0.980785280f, 0.195090322f },
+    { -0.970031253f, 0.242980180f },
+    { -0.956940336f, 0.290284677f },
+    { -0.941544065f, 0.336889853f },
+    { -0.923879533f, 0.382683432f },
+    { -0.903989293f, 0.427555093f },
+    { -0.881921264f, 0.471396737f },
+    { -0.857728610f, 0.514102744f },
+    { -0.831469612f, 0.555570233f },
+    { -0.803207531f, 0.595699304f },
+    { -0.773010453f, 0.634393284f },
+    { -0.740951125f, 0.671558955f },
+    { -0.707106781f, 0.707106781f },
+    { -0.671558955f, 0.740951125f },
+    { -0.634393284f, 0.773010453f },
+    { -0.595699304f, 0.803207531f },
+    { -0.555570233f, 0.831469612f },
+    { -0.514102744f, 0.857728610f },
+    { -0.471396737f, 0.881921264f },
+    { -0.427555093f, 0.903989293f },
+    { -0.382683432f, 0.923879533f },
+    { -0.336889853f, 0.941544065f },
+    { -0.290284677f, 0.956940336f },
+    { -0.242980180f, 0.970031253f },
+    { -0.195090322f, 0.980785280f },
+    { -0.146730474f, 0.989176510f },
+    { -0.098017140f, 0.995184727f },
+    { -0.049067674f, 0.998795456f },
+};
+
+const uint32_t fft_q15_twiddles[NUM_SAMPLES/2] = {
+    0x00007FFF, 0xF9B87FD9, 0xF3747F62, 0xED387E9D, 0xE7077D8A, 0xE0E67C2A,
+    0xDAD87A7D, 0xD4E17885, 0xCF047642, 0xC94673B6, 0xC3A970E3, 0xBE326DCA,
+    0xB8E36A6E, 0xB3C066D0, 0xAECC62F2, 0xAA0A5ED7, 0xA57E5A82, 0xA12955F6,
+    0x9D0E5134, 0x99304C40, 0x9592471D, 0x923641CE, 0x8F1D3C57, 0x8C4A36BA,
+    0x89BE30FC, 0x877B2B1F, 0x85832528, 0x83D61F1A, 0x827618F9, 0x816312C8,
+    0x809E0C8C, 0x80270648, 0x80000000, 0x8027F9B8, 0x809EF374, 0x8163ED38,
+    0x8276E707, 0x83D6E0E6, 0x8583DAD8, 0x877BD4E1, 0x89BECF04, 0x8C4AC946,
+    0x8F1DC3A9, 0x9236BE32, 0x9592B8E3, 0x9930B3C0, 0x9D0EAECC, 0xA129AA0A,
+    0xA57EA57E, 0xAA0AA129, 0xAECC9D0E, 0xB3C09930, 0xB8E39592, 0xBE329236,
+    0xC3A98F1D, 0xC9468C4A, 0xCF0489BE, 0xD4E1877B, 0xDAD88583, 0xE0E683D6,
+    0xE7078276, 0xED388163, 0xF374809E, 0xF9B88027,
+};
+
+const float fft_window[NUM_SAMPLES] = {
+    0.000000000f, 0.001204544f, 0.004815273f, 0.010823490f, 0.019214720f,
+    0.029968747f, 0.043059664f, 0.058455935f, 0.076120467f, 0.096010707f,
+    0.118078736f, 0.142271390f, 0.168530388f, 0.196792469f, 0.226989547f,
+    0.259048875f, 0.292893219f, 0.328441045f, 0.365606716f, 0.404300696f,
+    0.444429767f, 0.485897256f, 0.528603263f, 0.572444907f, 0.617316568f,
+    0.663110147f, 0.709715323f, 0.757019820f, 0.804909678f, 0.853269526f,
+    0.901982860f, 0.950932326f, 1.000000000f, 1.049067674f, 1.098017140f,
+    1.146730474f, 1.195090322f, 1.242980180f, 1.290284677f, 1.336889853f,
+    1.382683432f, 1.427555093f, 1.471396737f, 1.514102744f, 1.555570233f,
+    1.595699304f, 1.634393284f, 1.671558955f, 1.707106781f, 1.740951125f,
+    1.773010453f, 1.803207531f, 1.831469612f, 1.857728610f, 1.881921264f,
+    1.903989293f, 1.923879533f, 1.941544065f, 1.956940336f, 1.970031253f,
+    1.980785280f, 1.989176510f, 1.995184727f, 1.998795456f, 2.000000000f,
+    1.998795456f, 1.995184727f, 1.989176510f, 1.980785280f, 1.970031253f,
+    1.956940336f, 1.941544065f, 1.923879533f, 1.903989293f, 1.881921264f,
+    1.857728610f, 1.831469612f, 1.803207531f, 1.773010453f, 1.740951125f,
+    1.707106781f, 1.671558955f, 1.634393284f, 1.595699304f, 1.555570233f,
+    1.514102744f, 1.471396737f, 1.427555093f, 1.382683432f, 1.336889853f,
+    1.290284677f, 1.242980180f, 1.195090322f, 1.146730474f, 1.098017140f,
+    1.049067674f, 1.000000000f, 0.950932326f, 0.901982860f, 0.853269526f,
+    0.804909678f, 0.757019820f, 0.709715323f, 0.663110147f, 0.617316568f,
+    0.572444907f, 0.528603263f, 0.485897256f, 0.444429767f, 0.404300696f,
+    0.365606716f, 0.328441045f, 0.292893219f, 0.259048875f, 0.226989547f,
+    0.196792469f, 0.168530388f, 0.142271390f, 0.118078736f, 0.096010707f,
+    0.076120467f, 0.058455935f, 0.043059664f, 0.029968747f, 0.019214720f,
+    0.010823490f, 0.004815273f, 0.001204544f,
+};
+
+const uint16_t fft_bit_reverse[NUM_SAMPLES] = {
+       0,   64,   32,   96,   16,   80,   48,  112,    8,   72,   40,  104,
+      24,   88,   56,  120,    4,   68,   36,  100,   20,   84,   52,  116,
+      12,   76,   44,  108,   28,   92,   60,  124,    2,   66,   34,   98,
+      18,   82,   50,  114,   10,   74,   42,  106,   26,   90,   58,  122,
+       6,   70,   38,  102,   22,   86,   54,  118,   14,   78,   46,  110,
+      30,   94,   62,  126,    1,   65,   33,   97,   17,   81,   49,  113,
+       9,   73,   41,  105,   25,   89,   57,  121,    5,   69,   37,  101,
+      21,   85,   53,  117,   13,   77,   45,  109,   29,   93,   61,  125,
+       3,   67,   35,   99,   19,   83,   51,  115,   11,   75,   43,  107,
+      27,   91,   59,  123,    7,   71,   39,  103,   23,   87,   55,  119,
+      15,   79,   47,  111,   31,   95,   63,  127,
+};
+
+#elif NUM_SAMPLES == 256
+
+const float fft_twiddles[3*NUM_SAMPLES/4][2] = {
+    { 1.000000000f, -0.000000000f },
+    { 0.999698819f, -0.024541229f },
+    { 0.998795456f, -0.049067674f },
+    { 0.997290457f, -0.073564564f },
+    { 0.995184727f, -0.098017140f },
+    { 0.992479535f, -0.122410675f },
+    { 0.989176510f, -0.146730474f },
+    { 0.985277642f, -0.170961889f },
+    { 0.980785280f, -0.195090322f },
+    { 0.975702130f, -0.219101240f },
+    { 0.970031253f, -0.242980180f },
+    { 0.963776066f, -0.266712757f },
+    { 0.956940336f, -0.290284677f },
+    { 0.949528181f, -0.313681740f },
+    { 0.941544065f, -0.336889853f },
+    { 0.932992799f, -0.359895037f },
+    { 0.923879533f, -0.382683432f },
+    { 0.914209756f, -0.405241314f },
+    { 0.903989293f, -0.427555093f },
+    { 0.893224301f, -0.449611330f },
+    { 0.881921264f, -0.471396737f },
+    { 0.870086991f, -0.492898192f },
+    { 0.857728610f, -0.514102744f },
+    { 0.844853565f, -0.534997620f },
+    { 0.831469612f, -0.555570233f },
+    { 0.817584813f, -0.575808191f },
+    { 0.803207531f, -0.595699304f },
+    { 0.788346428f, -0.615231591f },
+    { 0.773010453f, -0.634393284f },
+    { 0.757208847f, -0.653172843f },
+    { 0.740951125f, -0.671558955f },
+    { 0.724247083f, -0.689540545f },
+    { 0.707106781f, -0.707106781f },
+    { 0.689540545f, -0.724247083f },
+    { 0.671558955f, -0.740951125f },
+    { 0.653172843f, -0.757208847f },
+    { 0.634393284f, -0.773010453f },
+    { 0.615231591f, -0.788346428f },
+    { 0.595699304f, -0.803207531f },
+    { 0.575808191f, -0.817584813f },
+    { 0.555570233f, -0.831469612f },
+    { 0.534997620f, -0.844853565f },
+    { 0.514102744f, -0.857728610f },
+    { 0.492898192f, -0.870086991f },
+    { 0.471396737f, -0.881921264f },
+    { 0.449611330f, -0.893224301f },
+    { 0.427555093f, -0.903989293f },
+    { 0.405241314f, -0.914209756f },
+    { 0.382683432f, -0.923879533f },
+    { 0.359895037f, -0.932992799f },
+    { 0.336889853f, -0.941544065f },
+    { 0.313681740f, -0.949528181f },
+    { 0.290284677f, -0.956940336f },
+    { 0.266712757f, -0.963776066f },
+    { 0.242980180f, -0.970031253f },
+    { 0.219101240f, -0.975702130f },
+    { 0.195090322f, -0.980785280f },
+    { 0.170961889f, -0.985277642f },
+    { 0.146730474f, -0.989176510f },
+    { 0.122410675f, -0.992479535f },
+    { 0.098017140f, -0.995184727f },
+    { 0.073564564f, -0.997290457f },
+    { 0.049067674f, -0.998795456f },
+    { 0.024541229f, -0.999698819f },
+    { 0.000000000f, -1.000000000f },
+    { -0.024541229f, -0.999698819f },
+    { -0.049067674f, -0.998795456f },
+    { -0.073564564f, -0.997290457f },
+    { -0.098017140f, -0.995184727f },
+    { -0.122410675f, -0.992479535f },
+    { -0.146730474f, -0.989176510f },
+    { -0.170961889f, -0.985277642f },
+    { -0.195090322f, -0.980785280f },
+    { -0.219101240f, -0.975702130f },
+    { -0.242980180f, -0.970031253f },
+    { -0.266712757f, -0.963776066f },
+    { -0.290284677f, -0.956940336f },
+    { -0.313681740f, -0.949528181f },
+    { -0.336889853f, -0.941544065f },
+    { -0.359895037f, -0.932992799f },
+    { -0.382683432f, -0.923879533f },
+    { -0.405241314f, -0.914209756f },
+    { -0.427555093f, -0.903989293f },
+    { -0.449611330f, -0.893224301f },
+    { -0.471396737f, -0.881921264f },
+    { -0.492898192f, -0.870086991f },
+    { -0.514102744f, -0.857728610f },
+    { -0.534997620f, -0.844853565f },
+    { -0.555570233f, -0.831469612f },
+    { -0.575808191f, -0.817584813f },
+    { -0.595699304f, -0.803207531f },
+    { -0.615231591f, -0.788346428f },
+    { -0.634393284f, -0.773010453f },
+    { -0.653172843f, -0.757208847f },
+    { -0.671558955f, -0.740951125f },
+    { -0.689540545f, -0.724247083f },
+    { -0.707106781f, -0.707106781f },
+    { -0.724247083f, -0.689540545f },
+    { -0.740951125f, -0.671558955f },
+    { -0.757208847f, -0.653172843f },
+    { -0.773010453f, -0.634393284f },
+    { -0.788346428f, -0.615231591f },
+    { -0.803207531f, -0.595699304f },
+    { -0.817584813f, -0.575808191f },
+    { -0.831469612f, -0.555570233f },
+    { -0.844853565f, -0.534997620f },
+    { -0.857728610f, -0.514102744f },
+    { -0.870086991f, -0.492898192f },
+    { -0.881921264f, -0.471396737f },
+    { -0.893224301f, -0.449611330f },
+    { -0.903989293f, -0.427555093f },
+    { -0.914209756f, -0.405241314f },
+    { -0.923879533f, -0.382683432f },
+    { -0.932992799f, -0.359895037f },
+    { -0.941544065f, -0.336889853f },
+    { -0.949528181f, -0.313681740f },
+    { -0.956940336f, -0.290284677f },
+    { -0.963776066f, -0.266712757f },
+    { -0.970031253f, -0.242980180f },
+    { -0.975702130f, -0.219101240f },
+    { -0.980785280f, -0.195090322f },
+    { -0.985277642f, -0.170961889f },
+    { -0.989176510f, -0.146730474f },
+    { -0.992479535f, -0.122410675f },
+    { -0.995184727f, -0.098017140f },
+    { -0.997290457f, -0.073564564f },
+    { -0.998795456f, -0.049067674f },
+    { -0.999698819f, -0.024541229f },
+    { -1.000000000f, -0.000000000f },
+    { -0.999698819f, 0.024541229f },
+    { -0.998795456f, 0.049067674f },
+    { -0.997290457f, 0.073564564f },
+    { -0.995184727f, 0.098017140f },
+    { -0.992479535f, 0.122410675f },
+    { -0.989176510f, 0.146730474f },
+    { -0.985277642f, 0.170961889f },
+    { -0.980785280f, 0.195090322f },
+    { -0.975702130f, 0.219101240f },
+    { -0.970031253f, 0.242980180f },
+    { -0.963776066f, 0.266712757f },
+    { -0.956940336f, 0.290284677f },
+    { -0.949528181f, 0.313681740f },
+    { -0.941544065f, 0.336889853f },
+    { -0.932992799f, 0.359895037f },
+    { -0.923879533f, 0.382683432f },
+    { -0.914209756f, 0.405241314f },
+    { -0.903989293f, 0.427555093f },
+    { -0.893224301f, 0.449611330f },
+    { -0.881921264f, 0.471396737f },
+    { -0.870086991f, 0.492898192f },
+    { -0.857728610f, 0.514102744f },
+    { -0.844853565f, 0.534997620f },
+    { -0.831469612f, 0.555570233f },
+    { -0.817584813f, 0.575808191f },
+    { -0.803207531f, 0.595699304f },
+    { -0.788346428f, 0.615231591f },
+    { -0.773010453f, 0.634393284f },
+    { -0.757208847f, 0.653172843f },
+    { -0.740951125f, 0.671558955f },
+    { -0.724247083f, 0.689540545f },
+    { -0.707106781f, 0.707106781f },
+    { -0.689540545f, 0.724247083f },
+    { -0.671558955f, 0.740951125f },
+    { -0.653172843f, 0.757208847f },
+    { -0.634393284f, 0.773010453f },
+    { -0.615231591f, 0.788346428f },
+    { -0.595699304f, 0.803207531f },
+    { -0.575808191f, 0.817584813f },
+    { -0.555570233f, 0.831469612f },
+    { -0.534997620f, 0.844853565f },
+    { -0.514102744f, 0.857728610f },
+    { -0.492898192f, 0.870086991f },
+    { -0.471396737f, 0.881921264f },
+    { -0.449611330f, 0.893224301f },
+    { -0.427555093f, 0.903989293f },
+    { -0.405241314f, 0.914209756f },
+    { -0.382683432f, 0.923879533f },
+    { -0.359895037f, 0.932992799f },
+    { -0.336889853f, 0.941544065f },
+    { -0.313681740f, 0.949528181f },
+    { -0.290284677f, 0.956940336f },
+    { -0.266712757f, 0.963776066f },
+    { -0.242980180f, 0.970031253f },
+    { -0.219101240f, 0.975702130f },
+    { -0.195090322f, 0.980785280f },
+    { -0.170961889f, 0.985277642f },
+    { -0.146730474f, 0.989176510f },
+    { -0.122410675f, 0.992479535f },
+    { -0.098017140f, 0.995184727f },
+    { -0.073564564f, 0.997290457f },
+    { -0.049067674f, 0.998795456f },
+    { -0.024541229f, 0.999698819f },
+};
+
+const uint32_t fft_q15_twiddles[NUM_SAMPLES/2] = {
+    0x00007FFF, 0xFCDC7FF6, 0xF9B87FD9, 0xF6957FA7, 0xF3747F62, 0xF0557F0A,
+    0xED387E9D, 0xEA1E7E1E, 0xE7077D8A, 0xE3F47CE4, 0xE0E67C2A, 0xDDDC7B5D,
+    0xDAD87A7D, 0xD7D9798A, 0xD4E17885, 0xD1EF776C, 0xCF047642, 0xCC217505,
+    0xC94673B6, 0xC6737255, 0xC3A970E3, 0xC0E96F5F, 0xBE326DCA, 0xBB856C24,
+    0xB8E36A6E, 0xB64C68A7, 0xB3C066D0, 0xB14064E9, 0xAECC62F2, 0xAC6560EC,
+    0xAA0A5ED7, 0xA7BD5CB4, 0xA57E5A82, 0xA34C5843, 0xA12955F6, 0x9F14539B,
+    0x9D0E5134, 0x9B174EC0, 0x99304C40, 0x975949B4, 0x9592471D, 0x93DC447B,
+    0x923641CE, 0x90A13F17, 0x8F1D3C57, 0x8DAB398D, 0x8C4A36BA, 0x8AFB33DF,
+    0x89BE30FC, 0x88942E11, 0x877B2B1F, 0x86762827, 0x85832528, 0x84A32224,
+    0x83D61F1A, 0x831C1C0C, 0x827618F9, 0x81E215E2, 0x816312C8, 0x80F60FAB,
+    0x809E0C8C, 0x8059096B, 0x80270648, 0x800A0324, 0x80000000, 0x800AFCDC,
+    0x8027F9B8, 0x8059F695, 0x809EF374, 0x80F6F055, 0x8163ED38, 0x81E2EA1E,
+    0x8276E707, 0x831CE3F4, 0x83D6E0E6, 0x84A3DDDC, 0x8583DAD8, 0x8676D7D9,
+    0x877BD4E1, 0x8894D1EF, 0x89BECF04, 0x8AFBCC21, 0x8C4AC946, 0x8DABC673,
+    0x8F1DC3A9, 0x90A1C0E9, 0x9236BE32, 0x93DCBB85, 0x9592B8E3, 0x9759B64C,
+    0x9930B3C0, 0x9B17B140, 0x9D0EAECC, 0x9F14AC65, 0xA129AA0A, 0xA34CA7BD,
+    0xA57EA57E, 0xA7BDA34C, 0xAA0AA129, 0xAC659F14, 0xAECC9D0E, 0xB1409B17,
+    0xB3C09930, 0xB64C9759, 0xB8E39592, 0xBB8593DC, 0xBE329236, 0xC0E990A1,
+    0xC3A98F1D, 0xC6738DAB, 0xC9468C4A, 0xCC218AFB, 0xCF0489BE, 0xD1EF8894,
+    0xD4E1877B, 0xD7D98676, 0xDAD88583, 0xDDDC84A3, 0xE0E683D6, 0xE3F4831C,
+    0xE7078276, 0xEA1E81E2, 0xED388163, 0xF05580F6, 0xF374809E, 0xF6958059,
+    0xF9B88027, 0xFCDC800A,
+};
+
+const float fft_window[NUM_SAMPLES] = {
+    0.000000000f, 0.000301181f, 0.001204544f, 0.002709543f, 0.004815273f,
+    0.007520465f, 0.010823490f, 0.014722358f, 0.019214720f, 0.024297870f,
+    0.029968747f, 0.036223934f, 0.043059664f, 0.050471819f, 0.058455935f,
+    0.067007201f, 0.076120467f, 0.085790244f, 0.096010707f, 0.106775699f,
+    0.118078736f, 0.129913009f, 0.142271390f, 0.155146435f, 0.168530388f,
+    0.182415187f, 0.196792469f, 0.211653572f, 0.226989547f, 0.242791153f,
+    0.259048875f, 0.275752917f, 0.292893219f, 0.310459455f, 0.328441045f,
+    0.346827157f, 0.365606716f, 0.384768409f, 0.404300696f, 0.424191809f,
+    0.444429767f, 0.465002380f, 0.485897256f, 0.507101808f, 0.528603263f,
+    0.550388670f, 0.572444907f, 0.594758686f, 0.617316568f, 0.640104963f,
+    0.663110147f, 0.686318260f, 0.709715323f, 0.733287243f, 0.757019820f,
+    0.780898760f, 0.804909678f, 0.829038111f, 0.853269526f, 0.877589325f,
+    0.901982860f, 0.926435436f, 0.950932326f, 0.975458771f, 1.000000000f,
+    1.024541229f, 1.049067674f, 1.073564564f, 1.098017140f, 1.122410675f,
+    1.146730474f, 1.170961889f, 1.195090322f, 1.219101240f, 1.242980180f,
+    1.266712757f, 1.290284677f, 1.313681740f, 1.336889853f, 1.359895037f,
+    1.382683432f, 1.405241314f, 1.427555093f, 1.449611330f, 1.471396737f,
+    1.492898192f, 1.514102744f, 1.534997620f, 1.555570233f, 1.575808191f,
+    1.595699304f, 1.615231591f, 1.634393284f, 1.653172843f, 1.671558955f,
+    1.689540545f, 1.707106781f, 1.724247083f, 1.740951125f, 1.757208847f,
+    1.773010453f, 1.788346428f, 1.803207531f, 1.817584813f, 1.831469612f,
+    1.844853565f, 1.857728610f, 1.870086991f, 1.881921264f, 1.893224301f,
+    1.903989293f, 1.914209756f, 1.923879533f, 1.932992799f, 1.941544065f,
+    1.949528181f, 1.956940336f, 1.963776066f, 1.970031253f, 1.975702130f,
+    1.980785280f, 1.985277642f, 1.989176510f, 1.992479535f, 1.995184727f,
+    1.997290457f, 1.998795456f, 1.999698819f, 2.000000000f, 1.999698819f,
+    1.998795456f, 1.997290457f, 1.995184727f, 1.992479535f, 1.989176510f,
+    1.985277642f, 1.980785280f, 1.975702130f, 1.970031253f, 1.963776066f,
+    1.956940336f, 1.949528181f, 1.941544065f, 1.932992799f, 1.923879533f,
+    1.914209756f, 1.903989293f, 1.893224301f, 1.881921264f, 1.870086991f,
+    1.857728610f, 1.844853565f, 1.831469612f, 1.817584813f, 1.803207531f,
+    1.788346428f, 1.773010453f, 1.757208847f, 1.740951125f, 1.724247083f,
+    1.707106781f, 1.689540545f, 1.671558955f, 1.653172843f, 1.634393284f,
+    1.615231591f, 1.595699304f, 1.575808191f, 1.555570233f, 1.534997620f,
+    1.514102744f, 1.492898192f, 1.471396737f, 1.449611330f, 1.427555093f,
+    1.405241314f, 1.382683432f, 1.359895037f, 1.336889853f, 1.313681740f,
+    1.290284677f, 1.266712757f, 1.242980180f, 1.219101240f, 1.195090322f,
+    1.170961889f, 1.146730474f, 1.122410675f, 1.098017140f, 1.073564564f,
+    1.049067674f, 1.024541229f, 1.000000000f, 0.975458771f, 0.950932326f,
+    0.926435436f, 0.901982860f, 0.877589325f, 0.853269526f, 0.829038111f,
+    0.804909678f, 0.780898760f, 0.757019820f, 0.733287243f, 0.709715323f,
+    0.686318260f, 0.663110147f, 0.640104963f, 0.617316568f, 0.594758686f,
+    0.572444907f, 0.550388670f, 0.528603263f, 0.507101808f, 0.485897256f,
+    0.465002380f, 0.444429767f, 0.424191809f, 0.404300696f, 0.384768409f,
+    0.365606716f, 0.346827157f, 0.328441045f, 0.310459455f, 0.292893219f,
+    0.275752917f, 0.259048875f, 0.242791153f, 0.226989547f, 0.211653572f,
+    0.196792469f, 0.182415187f, 0.168530388f, 0.155146435f, 0.142271390f,
+    0.129913009f, 0.118078736f, 0.106775699f, 0.096010707f, 0.085790244f,
+    0.076120467f, 0.067007201f, 0.058455935f, 0.050471819f, 0.043059664f,
+    0.036223934f, 0.029968747f, 0.024297870f, 0.019214720f, 0.014722358f,
+    0.010823490f, 0.007520465f, 0.004815273f, 0.002709543f, 0.001204544f,
+    0.000301181f,
+};
+
+const uint16_t fft_bit_reverse[NUM_SAMPLES] = {
+       0,  128,   64,  192,   32,  160,   96,  224,   16,  144,   80,  208,
+      48,  176,  112,  240,    8,  136,   72,  200,   40,  168,  104,  232,
+      24,  152,   88,  216,   56,  184,  120,  248,    4,  132,   68,  196,
+      36,  164,  100,  228,   20,  148,   84,  212,   52,  180,  116,  244,
+      12,  140,   76,  204,   44,  172,  108,  236,   28,  156,   92,  220,
+      60,  188,  124,  252,    2,  130,   66,  194,   34,  162,   98,  226,
+      18,  146,   82,  210,   50,  178,  114,  242,   10,  138,   74,  202,
+      42,  170,  106,  234,   26,  154,   90,  218,   58,  186,  122,  250,
+       6,  134,   70,  198,   38,  166,  102,  230,   22,  150,   86,  214,
+      54,  182,  118,  246,   14,  142,   78,  206,   46,  174,  110,  238,
+      30,  158,   94,  222,   62,  190,  126,  254,    1,  129,   65,  193,
+      33,  161,   97,  225,   17,  145,   81,  209,   49,  177,  113,  241,
+       9,  137,   73,  201,   41,  169,  105,  233,   25,  153,   89,  217,
+      57,  185,  121,  249,    5,  133,   69,  197,   37,  165,  101,  229,
+      21,  149,   85,  213,   53,  181,  117,  245,   13,  141,   77,  205,
+      45,  173,  109,  237,   29,  157,   93,  221,   61,  189,  125,  253,
+       3,  131,   67,  195,   35,  163,   99,  227,   19,  147,   83,  211,
+      51,  179,  115,  243,   11,  139,   75,  203,   43,  171,  107,  235,
+      27,  155,   91,  219,   59,  187,  123,  251,    7,  135,   71,  199,
+      39,  167,  103,  231,   23,  151,   87,  215,   55,  183,  119,  247,
+      15,  143,   79,  207,   47,  175,  111,  239,   31,  159,   95,  223,
+      63,  191,  127,  255,
+};
+
+#elif NUM_SAMPLES == 512
+
+const float fft_twiddles[3*NUM_SAMPLES/4][2] = {
+    { 1.000000000f, -0.000000000f },
+    { 0.999924702f, -0.012271538f },
+    { 0.999698819f, -0.024541229f },
+    { 0.999322385f, -0.036807223f },
+    { 0.998795456f, -0.049067674f },
+    { 0.998118113f, -0.061320736f },
+    { 0.997290457f, -0.073564564f },
+    { 0.996312612f, -0.085797312f },
+    { 0.995184727f, -0.098017140f },
+    { 0.993906970f, -0.110222207f },
+    { 0.992479535f, -0.122410675f },
+    { 0.990902635f, -0.134580709f },
+    { 0.989176510f, -0.146730474f },
+    { 0.987301418f, -0.158858143f },
+    { 0.985277642f, -0.170961889f },
+    { 0.983105487f, -0.183039888f },
+    { 0.980785280f, -0.195090322f },
+    { 0.978317371f, -0.207111376f },
+    { 0.975702130f, -0.219101240f },
+    { 0.972939952f, -0.231058108f },
+    { 0.970031253f, -0.242980180f },
+    { 0.966976471f, -0.254865660f },
+    { 0.963776066f, -0.266712757f },
+    { 0.960430519f, -0.278519689f },
+    { 0.956940336f, -0.290284677f },
+    { 0.953306040f, -0.302005949f },
+    { 0.949528181f, -0.313681740f },
+    { 0.945607325f, -0.325310292f },
+    { 0.941544065f, -0.336889853f },
+    { 0.937339012f, -0.348418680f },
+    { 0.932992799f, -0.359895037f },
+    { 0.928506080f, -0.371317194f },
+    { 0.923879533f, -0.382683432f },
+    { 0.919113852f, -0.393992040f },
+    { 0.914209756f, -0.405241314f },
+    { 0.909167983f, -0.416429560f },
+    { 0.903989293f, -0.427555093f },
+    { 0.898674466f, -0.438616239f },
+    { 0.893224301f, -0.449611330f },
+    { 0.887639620f, -0.460538711f },
+    { 0.881921264f, -0.471396737f },
+    { 0.876070094f, -0.482183772f },
+    { 0.870086991f, -0.492898192f },
+    { 0.863972856f, -0.503538384f },
+    { 0.857728610f, -0.514102744f },
+    { 0.851355193f, -0.524589683f },
+    { 0.844853565f, -0.534997620f },
+    { 0.838224706f, -0.545324988f },
+    { 0.831469612f, -0.555570233f },
+    { 0.824589303f, -0.565731811f },
+    { 0.817584813f, -0.575808191f },
+    { 0.810457198f, -0.585797857f },
+    { 0.803207531f, -0.595699304f },
+    { 0.795836905f, -0.605511041f },
+    { 0.788346428f, -0.615231591f },
+    { 0.780737229f, -0.624859488f },
+    { 0.773010453f, -0.634393284f },
+    { 0.765167266f, -0.643831543f },
+    { 0.757208847f, -0.653172843f },
+    { 0.749136395f, -0.662415778f },
+    { 0.740951125f, -0.671558955f },
+    { 0.732654272f, -0.680600998f },
+    { 0.724247083f, -0.689540545f },
+    { 0.715730825f, -0.698376249f },
+    { 0.707106781f, -0.707106781f },
+    { 0.698376249f, -0.715730825f },
+    { 0.689540545f, -0.724247083f },
+    { 0.680600998f, -0.732654272f },
+    { 0.671558955f, -0.740951125f },
+    { 0.662415778f, -0.749136395f },
+    { 0.653172843f, -0.757208847f },
+    { 0.643831543f, -0.765167266f },
+    { 0.634393284f, -0.773010453f },
+    { 0.624859488f, -0.780737229f },
+    { 0.615231591f, -0.788346428f },
+    { 0.605511041f, -0.795836905f },
+    { 0.595699304f, -0.803207531f },
+    { 0.585797857f, -0.810457198f },
+    { 0.575808191f, -0.817584813f },
+    { 0.565731811f, -0.824589303f },
+    { 0.555570233f, -0.831469612f },
+    { 0.545324988f, -0.838224706f },
+    { 0.534997620f, -0.844853565f },
+    { 0.524589683f, -0.851355193f },
+    { 0.514102744f, -0.857728610f },
+    { 0.503538384f, -0.863972856f },
+    { 0.492898192f, -0.870086991f },
+    { 0.482183772f, -0.876070094f },
+    { 0.471396737f, -0.881921264f },
+    { 0.460538711f, -0.887639620f },
+    { 0.449611330f, -0.893224301f },
+    { 0.438616239f, -0.898674466f },
+    { 0.427555093f, -0.903989293f },
+    { 0.416429560f, -0.909167983f },
+    { 0.405241314f, -0.914209756f },
+    { 0.393992040f, -0.919113852f },
+    { 0.382683432f, -0.923879533f },
+    { 0.371317194f, -0.928506080f },
+    { 0.359895037f, -0.932992799f },
+    { 0.348418680f, -0.937339012f },
+    { 0.336889853f, -0.941544065f },
+    { 0.325310292f, -0.945607325f },
+    { 0.313681740f, -0.949528181f },
+    { 0.302005949f, -0.953306040f },
+    { 0.290284677f, -0.956940336f },
+    { 0.278519689f, -0.960430519f },
+    { 0.266712757f, -0.963776066f },
+    { 0.254865660f, -0.966976471f },
+    { 0.242980180f, -0.970031253f },
+    { 0.231058108f, -0.972939952f },
+    { 0.219101240f, -0.975702130f },
+    { 0.207111376f, -0.978317371f },
+    { 0.195090322f, -0.980785280f },
+    { 0.183039888f, -0.983105487f },
+    { 0.170961889f, -0.985277642f },
+    { 0.158858143f, -0.987301418f },
+    { 0.146730474f, -0.989176510f },
+    { 0.134580709f, -0.990902635f },
+    { 0.122410675f, -0.992479535f },
+    { 0.110222207f, -0.993906970f },
+    { 0.098017140f, -0.995184727f },
+    { 0.085797312f, -0.996312612f },
+    { 0.073564564f, -0.997290457f },
+    { 0.061320736f, -0.998118113f },
+    { 0.049067674f, -0.998795456f },
+    { 0.036807223f, -0.999322385f },
+    { 0.024541229f, -0.999698819f },
+    { 0.012271538f, -0.999924702f },
+    { 0.000000000f, -1.000000000f },
+    { -0.012271538f, -0.999924702f },
+    { -0.024541229f, -0.999698819f },
+    { -0.036807223f, -0.999322385f },
+    { -0.049067674f, -0.998795456f },
+    { -0.061320736f, -0.998118113f },
+    { -0.073564564f, -0.997290457f },
+    { -0.085797312f, -0.996312612f },
+    { -0.098017140f, -0.995184727f },
+    { -0.110222207f, -0.993906970f },
+    { -0.122410675f, -0.992479535f },
+    { -0.134580709f, -0.990902635f },
+    { -0.146730474f, -0.989176510f },
+    { -0.158858143f, -0.987301418f },
+    { -0.170961889f, -0.985277642f },
+    { -0.183039888f, -0.983105487f },
+    { -0.195090322f, -0.980785280f },
+    { -0.207111376f, -0.978317371f },
+    { -0.219101240f, -0.975702130f },
+    { -0.231058108f, -0.972939952f },
+    { -0.242980180f, -0.970031253f },
+    { -0.254865660f, -0.966976471f },
+    { -0.266712757f, -0.963776066f },
+    { -0.278519689f, -0.960430519f },
+    { -0.290284677f, -0.956940336f },
+    { -0.302005949f, -0.953306040f },
+    { -0.313681740f, -0.949528181f },
+    { -0.325310292f, -0.945607325f },
+    { -0.336889853f, -0.941544065f },
+    { -0.348418680f, -0.937339012f },
+    { -0.359895037f, -0.932992799f },
+    { -0.371317194f, -0.928506080f },
+    { -0.382683432f, -0.923879533f },
+    { -0.393992040f, -0.919113852f },
+    { -0.405241314f, -0.914209756f },
+    { -0.416429560f, -0.909167983f },
+    { -0.427555093f, -0.903989293f },
+    { -0.438616239f, -0.898674466f },
+    { -0.449611330f, -0.893224301f },
+    { -0.460538711f, -0.887639620f },
+    { -0.471396737f, -0.881921264f },
+    { -0.482183772f, -0.876070094f },
+    { -0.492898192f, -0.870086991f },
+    { -0.503538384f, -0.863972856f },
+    { -0.514102744f, -0.857728610f },
+    { -0.524589683f, -0.851355193f },
+    { -0.534997620f, -0.844853565f },
+    { -0.545324988f, -0.838224706f },
+    { -0.555570233f, -0.831469612f },
+    { -0.565731811f, -0.824589303f },
+    { -0.575808191f, -0.817584813f },
+    { -0.585797857f, -0.810457198f },
+    { -0.595699304f, -0.803207531f },
+    { -0.605511041f, -0.795836905f },
+    { -0.615231591f, -0.788346428f },
+    { -0.624859488f, -0.780737229f },
+    { -0.634393284f, -0.773010453f },
+    { -0.643831543f, -0.765167266f },
+    { -0.653172843f, -0.757208847f },
+    { -0.662415778f, -0.749136395f },
+    { -0.671558955f, -0.740951125f },
+    { -0.680600998f, -0.732654272f },
+    { -0.689540545f, -0.724247083f },
+    { -0.698376249f, -0.715730825f },
+    { -0.707106781f, -0.707106781f },
+    { -0.715730825f, -0.698376249f },
+    { -0.724247083f, -0.689540545f },
+    { -0.732654272f, -0.680600998f },
+    { -0.740951125f, -0.671558955f },
+    { -0.749136395f, -0.662415778f },
+    { -0.757208847f, -0.653172843f },
+    { -0.765167266f, -0.643831543f },
+    { -0.773010453f, -0.634393284f },
+    { -0.780737229f, -0.624859488f },
+    { -0.788346428f, -0.615231591f },
+    { -0.795836905f, -0.605511041f },
+    { -0.803207531f, -0.595699304f },
+    { -0.810457198f, -0.585797857f },
+    { -0.817584813f, -0.575808191f },
+    { -0.824589303f, -0.565731811f },
+    { -0.831469612f, -0.555570233f },
+    { -0.838224706f, -0.545324988f },
+    { -0.844853565f, -0.534997620f },
+    { -0.851355193f, -0.524589683f },
+    { -0.857728610f, -0.514102744f },
+    { -0.863972856f, -0.503538384f },
+    { -0.870086991f, -0.492898192f },
+    { -0.876070094f, -0.482183772f },
+    { -0.881921264f, -0.471396737f },
+    { -0.887639620f, -0.460538711f },
+    { -0.893224301f, -0.449611330f },
+    { -0.898674466f, -0.438616239f },
+    { -0.903989293f, -0.427555093f },
+    { -0.909167983f, -0.416429560f },
+    { -0.914209756f, -0.405241314f },
+    { -0.919113852f, -0.393992040f },
+    { -0.923879533f, -0.382683432f },
+    { -0.928506080f, -0.371317194f },
+    { -0.932992799f, -0.359895037f },
+    { -0.937339012f, -0.348418680f },
+    { -0.941544065f, -0.336889853f },
+    { -0.945607325f, -0.325310292f },
+    { -0.949528181f, -0.313681740f },
+    { -0.953306040f, -0.302005949f },
+    { -0.956940336f, -0.290284677f },
+    { -0.960430519f, -0.278519689f },
+    { -0.963776066f, -0.266712757f },
+    { -0.966976471f, -0.254865660f },
+    { -0.970031253f, -0.242980180f },
+    { -0.972939952f, -0.231058108f },
+    { -0.975702130f, -0.219101240f },
+    { -0.978317371f, -0.207111376f },
+    { -0.980785280f, -0.195090322f },
+    { -0.983105487f, -0.183039888f },
+    { -0.985277642f, -0.170961889f },
+    { -0.987301418f, -0.158858143f },
+    { -0.989176510f, -0.146730474f },
+    { -0.990902635f, -0.134580709f },
+    { -0.992479535f, -0.122410675f },
+    { -0.993906970f, -0.110222207f },
+    { -0.995184727f, -0.098017140f },
+    { -0.996312612f, -0.085797312f },
+    { -0.997290457f, -0.073564564f },
+    { -0.998118113f, -0.061320736f },
+    { -0.998795456f, -0.049067674f },
+    { -0.999322385f, -0.036807223f },
+    { -0.999698819f, -0.024541229f },
+    { -0.999924702f, -0.012271538f },
+    { -1.000000000f, -0.000000000f },
+    { -0.999924702f, 0.012271538f },
+    { -0.999698819f, 0.024541229f },
+    { -0.999322385f, 0.036807223f },
+    { -0.998795456f, 0.049067674f },
+    { -0.998118113f, 0.061320736f },
+    { -0.997290457f, 0.073564564f },
+    { -0.996312612f, 0.085797312f },
+    { -0.995184727f, 0.098017140f },
+    { -0.993906970f, 0.110222207f },
+    { -0.992479535f, 0.122410675f },
+    { -0.990902635f, 0.134580709f },
+    { -0.989176510f, 0.146730474f },
+    { -0.987301418f, 0.158858143f },
+    { -0.985277642f, 0.170961889f },
+    { -0.983105487f, 0.183039888f },
+    { -0.980785280f, 0.195090322f },
+    { -0.978317371f, 0.207111376f },
+    { -0.975702130f, 0.219101240f },
+    { -0.972939952f, 0.231058108f },
+    { -0.970031253f, 0.242980180f },
+    { -0.966976471f, 0.254865660f },
+    { -0.963776066f, 0.266712757f },
+    { -0.960430519f, 0.278519689f },
+    { -0.956940336f, 0.290284677f },
+    { -0.953306040f, 0.302005949f },
+    { -0.949528181f, 0.313681740f },
+    { -0.945607325f, 0.325310292f },
+    { -0.941544065f, 0.336889853f },
+    { -0.937339012f, 0.348418680f },
+    { -0.932992799f, 0.359895037f },
+    { -0.928506080f, 0.371317194f },
+    { -0.923879533f, 0.382683432f },
+    { -0.919113852f, 0.393992040f },
+    { -0.914209756f, 0.405241314f },
+    { -0.909167983f, 0.416429560f },
+    { -0.903989293f, 0.427555093f },
+    { -0.898674466f, 0.438616239f },
+    { -0.893224301f, 0.449611330f },
+    { -0.887639620f, 0.460538711f },
+    { -0.881921264f, 0.471396737f },
+    { -0.876070094f, 0.482183772f },
+    { -0.870086991f, 0.492898192f },
+    { -0.863972856f, 0.503538384f },
+    { -0.857728610f, 0.514102744f },
+    { -0.851355193f, 0.524589683f },
+    { -0.844853565f, 0.534997620f },
+    { -0.838224706f, 0.545324988f },
+    { -0.831469612f, 0.555570233f },
+    { -0.824589303f, 0.565731811f },
+    { -0.817584813f, 0.575808191f },
+    { -0.810457198f, 0.585797857f },
+    { -0.803207531f, 0.595699304f },
+    { -0.795836905f, 0.605511041f },
+    { -0.788346428f, 0.615231591f },
+    { -0.780737229f, 0.624859488f },
+    { -0.773010453f, 0.634393284f },
+    { -0.765167266f, 0.643831543f },
+    { -0.757208847f, 0.653172843f },
+    { -0.749136395f, 0.662415778f },
+    { -0.740951125f, 0.671558955f },
+    { -0.732654272f, 0.680600998f },
+    { -0.724247083f, 0.689540545f },
+    { -0.715730825f, 0.698376249f },
+    { -0.707106781f, 0.707106781f },
+    { -0.698376249f, 0.715730825f },
+    { -0.689540545f, 0.724247083f },
+    { -0.680600998f, 0.732654272f },
+    { -0.671558955f, 0.740951125f },
+    { -0.662415778f, 0.749136395f },
+    { -0.653172843f, 0.757208847f },
+    { -0.643831543f, 0.765167266f },
+    { -0.634393284f, 0.773010453f },
+    { -0.624859488f, 0.780737229f },
+    { -0.615231591f, 0.788346428f },
+    { -0.605511041f, 0.795836905f },
+    { -0.595699304f, 0.803207531f },
+    { -0.585797857f, 0.810457198f },
+    { -0.575808191f, 0.817584813f },
+    { -0.565731811f, 0.824589303f },
+    { -0.555570233f, 0.831469612f },
+    { -0.545324988f, 0.838224706f },
+    { -0.534997620f, 0.844853565f },
+    { -0.524589683f, 0.851355193f },
+    { -0.514102744f, 0.857728610f },
+    { -0.503538384f, 0.863972856f },
+    { -0.492898192f, 0.870086991f },
+    { -0.482183772f, 0.876070094f },
+    { -0.471396737f, 0.881921264f },
+    { -0.460538711f, 0.887639620f },
+    { -0.449611330f, 0.893224301f },
+    { -0.438616239f, 0.898674466f },
+    { -0.427555093f, 0.903989293f },
+    { -0.416429560f, 0.909167983f },
+    { -0.405241314f, 0.914209756f },
+    { -0.393992040f, 0.919113852f },
+    { -0.382683432f, 0.923879533f },
+    { -0.371317194f, 0.928506080f },
+    { -0.359895037f, 0.932992799f },
+    { -0.348418680f, 0.937339012f },
+    { -0.336889853f, 0.941544065f },
+    { -0.325310292f, 0.945607325f },
+    { -0.313681740f, 0.949528181f },
+    { -0.302005949f, 0.953306040f },
+    { -0.290284677f, 0.956940336f },
+    { -0.278519689f, 0.960430519f },
+    { -0.266712757f, 0.963776066f },
+    { -0.254865660f, 0.966976471f },
+    { -0.242980180f, 0.970031253f },
+    { -0.231058108f, 0.972939952f },
+    { -0.219101240f, 0.975702130f },
+    { -0.207111376f, 0.978317371f },
+    { -0.195090322f, 0.980785280f },
+    { -0.183039888f, 0.983105487f },
+    { -0.170961889f, 0.985277642f },
+    { -0.158858143f, 0.987301418f },
+    { -0.146730474f, 0.989176510f },
+    { -0.134580709f, 0.990902635f },
+    { -0.122410675f, 0.992479535f },
+    { -0.110222207f, 0.993906970f },
+    { -0.098017140f, 0.995184727f },
+    { -0.085797312f, 0.996312612f },
+    { -0.073564564f, 0.997290457f },
+    { -0.061320736f, 0.998118113f },
+    { -0.049067674f, 0.998795456f },
+    { -0.036807223f, 0.999322385f },
+    { -0.024541229f, 0.999698819f },
+    { -0.012271538f, 0.999924702f },
+};
+
+const uint32_t fft_q15_twiddles[NUM_SAMPLES/2] = {
+    0x00007FFF, 0xFE6E7FFE, 0xFCDC7FF6, 0xFB4A7FEA, 0xF9B87FD9, 0xF8277FC2,
+    0xF6957FA7, 0xF5057F87, 0xF3747F62, 0xF1E47F38, 0xF0557F0A, 0xEEC67ED6,
+    0xED387E9D, 0xEBAB7E60, 0xEA1E7E1E, 0xE8927DD6, 0xE7077D8A, 0xE57D7D3A,
+    0xE3F47CE4, 0xE26D7C89, 0xE0E67C2A, 0xDF617BC6, 0xDDDC7B5D, 0xDC597AEF,
+    0xDAD87A7D, 0xD9587A06, 0xD7D9798A, 0xD65C790A, 0xD4E17885, 0xD36777FB,
+    0xD1EF776C, 0xD07976D9, 0xCF047642, 0xCD9275A6, 0xCC217505, 0xCAB27460,
+    0xC94673B6, 0xC7DB7308, 0xC6737255, 0xC50D719E, 0xC3A970E3, 0xC2487023,
+    0xC0E96F5F, 0xBF8C6E97, 0xBE326DCA, 0xBCDA6CF9, 0xBB856C24, 0xBA336B4B,
+    0xB8E36A6E, 0xB796698C, 0xB64C68A7, 0xB50567BD, 0xB3C066D0, 0xB27F65DE,
+    0xB14064E9, 0xB00563EF, 0xAECC62F2, 0xAD9761F1, 0xAC6560EC, 0xAB365FE4,
+    0xAA0A5ED7, 0xA8E25DC8, 0xA7BD5CB4, 0xA69C5B9D, 0xA57E5A82, 0xA4635964,
+    0xA34C5843, 0xA238571E, 0xA12955F6, 0xA01C54CA, 0x9F14539B, 0x9E0F5269,
+    0x9D0E5134, 0x9C114FFB, 0x9B174EC0, 0x9A224D81, 0x99304C40, 0x98434AFB,
+    0x975949B4, 0x9674486A, 0x9592471D, 0x94B545CD, 0x93DC447B, 0x93074326,
+    0x923641CE, 0x91694074, 0x90A13F17, 0x8FDD3DB8, 0x8F1D3C57, 0x8E623AF3,
+    0x8DAB398D, 0x8CF83825, 0x8C4A36BA, 0x8BA0354E, 0x8AFB33DF, 0x8A5A326E,
+    0x89BE30FC, 0x89272F87, 0x88942E11, 0x88052C99, 0x877B2B1F, 0x86F629A4,
+    0x86762827, 0x85FA26A8, 0x85832528, 0x851123A7, 0x84A32224, 0x843A209F,
+    0x83D61F1A, 0x83771D93, 0x831C1C0C, 0x82C61A83, 0x827618F9, 0x822A176E,
+    0x81E215E2, 0x81A01455, 0x816312C8, 0x812A113A, 0x80F60FAB, 0x80C80E1C,
+    0x809E0C8C, 0x80790AFB, 0x8059096B, 0x803E07D9, 0x80270648, 0x801604B6,
+    0x800A0324, 0x80020192, 0x80000000, 0x8002FE6E, 0x800AFCDC, 0x8016FB4A,
+    0x8027F9B8, 0x803EF827, 0x8059F695, 0x8079F505, 0x809EF374, 0x80C8F1E4,
+    0x80F6F055, 0x812AEEC6, 0x8163ED38, 0x81A0EBAB, 0x81E2EA1E, 0x822AE892,
+    0x8276E707, 0x82C6E57D, 0x831CE3F4, 0x8377E26D, 0x83D6E0E6, 0x843ADF61,
+    0x84A3DDDC, 0x8511DC59, 0x8583DAD8, 0x85FAD958, 0x8676D7D9, 0x86F6D65C,
+    0x877BD4E1, 0x8805D367, 0x8894D1EF, 0x8927D079, 0x89BECF04, 0x8A5ACD92,
+    0x8AFBCC21, 0x8BA0CAB2, 0x8C4AC946, 0x8CF8C7DB, 0x8DABC673, 0x8E62C50D,
+    0x8F1DC3A9, 0x8FDDC248, 0x90A1C0E9, 0x9169BF8C, 0x9236BE32, 0x9307BCDA,
+    0x93DCBB85, 0x94B5BA33, 0x9592B8E3, 0x9674B796, 0x9759B64C, 0x9843B505,
+    0x9930B3C0, 0x9A22B27F, 0x9B17B140, 0x9C11B005, 0x9D0EAECC, 0x9E0FAD97,
+    0x9F14AC65, 0xA01CAB36, 0xA129AA0A, 0xA238A8E2, 0xA34CA7BD, 0xA463A69C,
+    0xA57EA57E, 0xA69CA463, 0xA7BDA34C, 0xA8E2A238, 0xAA0AA129, 0xAB36A01C,
+    0xAC659F14, 0xAD979E0F, 0xAECC9D0E, 0xB0059C11, 0xB1409B17, 0xB27F9A22,
+    0xB3C09930, 0xB5059843, 0xB64C9759, 0xB7969674, 0xB8E39592, 0xBA3394B5,
+    0xBB8593DC, 0xBCDA9307, 0xBE329236, 0xBF8C9169, 0xC0E990A1, 0xC2488FDD,
+    0xC3A98F1D, 0xC50D8E62, 0xC6738DAB, 0xC7DB8CF8, 0xC9468C4A, 0xCAB28BA0,
+    0xCC218AFB, 0xCD928A5A, 0xCF0489BE, 0xD0798927, 0xD1EF8894, 0xD3678805,
+    0xD4E1877B, 0xD65C86F6, 0xD7D98676, 0xD95885FA, 0xDAD88583, 0xDC598511,
+    0xDDDC84A3, 0xDF61843A, 0xE0E683D6, 0xE26D8377, 0xE3F4831C, 0xE57D82C6,
+    0xE7078276, 0xE892822A, 0xEA1E81E2, 0xEBAB81A0, 0xED388163, 0xEEC6812A,
+    0xF05580F6, 0xF1E480C8, 0xF374809E, 0xF5058079, 0xF6958059, 0xF827803E,
+    0xF9B88027, 0xFB4A8016, 0xFCDC800A, 0xFE6E8002,
+};
+
+const float fft_window[NUM_SAMPLES] = {
+    0.000000000f, 0.000075298f, 0.000301181f, 0.000677615f, 0.001204544f,
+    0.001881887f, 0.002709543f, 0.003687388f, 0.004815273f, 0.006093030f,
+    0.007520465f, 0.009097365f, 0.010823490f, 0.012698582f, 0.014722358f,
+    0.016894513f, 0.019214720f, 0.021682629f, 0.024297870f, 0.027060048f,
+    0.029968747f, 0.033023529f, 0.036223934f, 0.039569481f, 0.043059664f,
+    0.046693960f, 0.050471819f, 0.054392675f, 0.058455935f, 0.062660988f,
+    0.067007201f, 0.071493920f, 0.076120467f, 0.080886148f, 0.085790244f,
+    0.090832017f, 0.096010707f, 0.101325534f, 0.106775699f, 0.112360380f,
+    0.118078736f, 0.123929906f, 0.129913009f, 0.136027144f, 0.142271390f,
+    0.148644807f, 0.155146435f, 0.161775294f, 0.168530388f, 0.175410697f,
+    0.182415187f, 0.189542802f, 0.196792469f, 0.204163095f, 0.211653572f,
+    0.219262771f, 0.226989547f, 0.234832734f, 0.242791153f, 0.250863605f,
+    0.259048875f, 0.267345728f, 0.275752917f, 0.284269175f, 0.292893219f,
+    0.301623751f, 0.310459455f, 0.319399002f, 0.328441045f, 0.337584222f,
+    0.346827157f, 0.356168457f, 0.365606716f, 0.375140512f, 0.384768409f,
+    0.394488959f, 0.404300696f, 0.414202143f, 0.424191809f, 0.434268189f,
+    0.444429767f, 0.454675012f, 0.465002380f, 0.475410317f, 0.485897256f,
+    0.496461616f, 0.507101808f, 0.517816228f, 0.528603263f, 0.539461289f,
+    0.550388670f, 0.561383761f, 0.572444907f, 0.583570440f, 0.594758686f,
+    0.606007960f, 0.617316568f, 0.628682806f, 0.640104963f, 0.651581320f,
+    0.663110147f, 0.674689708f, 0.686318260f, 0.697994051f, 0.709715323f,
+    0.721480311f, 0.733287243f, 0.745134340f, 0.757019820f, 0.768941892f,
+    0.780898760f, 0.792888624f, 0.804909678f, 0.816960112f, 0.829038111f,
+    0.841141857f, 0.853269526f, 0.865419291f, 0.877589325f, 0.889777793f,
+    0.901982860f, 0.914202688f, 0.926435436f, 0.938679264f, 0.950932326f,
+    0.963192777f, 0.975458771f, 0.987728462f, 1.000000000f, 1.012271538f,
+    1.024541229f, 1.036807223f, 1.049067674f, 1.061320736f, 1.073564564f,
+    1.085797312f, 1.098017140f, 1.110222207f, 1.122410675f, 1.134580709f,
+    1.146730474f, 1.158858143f, 1.170961889f, 1.183039888f, 1.195090322f,
+    1.207111376f, 1.219101240f, 1.231058108f, 1.242980180f, 1.254865660f,
+    1.266712757f, 1.278519689f, 1.290284677f, 1.302005949f, 1.313681740f,
+    1.325310292f, 1.336889853f, 1.348418680f, 1.359895037f, 1.371317194f,
+    1.382683432f, 1.393992040f, 1.405241314f, 1.416429560f, 1.427555093f,
+    1.438616239f, 1.449611330f, 1.460538711f, 1.471396737f, 1.482183772f,
+    1.492898192f, 1.503538384f, 1.514102744f, 1.524589683f, 1.534997620f,
+    1.545324988f, 1.555570233f, 1.565731811f, 1.575808191f, 1.585797857f,
+    1.595699304f, 1.605511041f, 1.615231591f, 1.624859488f, 1.634393284f,
+    1.643831543f, 1.653172843f, 1.662415778f, 1.671558955f, 1.680600998f,
+    1.689540545f, 1.698376249f, 1.707106781f, 1.715730825f, 1.724247083f,
+    1.732654272f, 1.740951125f, 1.749136395f, 1.757208847f, 1.765167266f,
+    1.773010453f, 1.780737229f, 1.788346428f, 1.795836905f, 1.803207531f,
+    1.810457198f, 1.817584813f, 1.824589303f, 1.831469612f, 1.838224706f,
+    1.844853565f, 1.851355193f, 1.857728610f, 1.863972856f, 1.870086991f,
+    1.876070094f, 1.881921264f, 1.887639620f, 1.893224301f, 1.898674466f,
+    1.903989293f, 1.909167983f, 1.914209756f, 1.919113852f, 1.923879533f,
+    1.928506080f, 1.932992799f, 1.937339012f, 1.941544065f, 1.945607325f,
+    1.949528181f, 1.953306040f, 1.956940336f, 1.960430519f, 1.963776066f,
+    1.966976471f, 1.970031253f, 1.972939952f, 1.975702130f, 1.978317371f,
+    1.980785280f, 1.983105487f, 1.985277642f, 1.987301418f, 1.989176510f,
+    1.990902635f, 1.992479535f, 1.993906970f, 1.995184727f, 1.996312612f,
+    1.997290457f, 1.998118113f, 1.998795456f, 1.999322385f, 1.999698819f,
+    1.999924702f, 2.000000000f, 1.999924702f, 1.999698819f, 1.999322385f,
+    1.998795456f, 1.998118113f, 1.997290457f, 1.996312612f, 1.995184727f,
+    1.993906970f, 1.992479535f, 1.990902635f, 1.989176510f, 1.987301418f,
+    1.985277642f, 1.983105487f, 1.980785280f, 1.978317371f, 1.975702130f,
+    1.972939952f, 1.970031253f, 1.966976471f, 1.963776066f, 1.960430519f,
+    1.956940336f, 1.953306040f, 1.949528181f, 1.945607325f, 1.941544065f,
+    1.937339012f, 1.932992799f, 1.928506080f, 1.923879533f, 1.919113852f,
+    1.914209756f, 1.909167983f, 1.903989293f, 1.898674466f, 1.893224301f,
+    1.887639620f, 1.881921264f, 1.876070094f, 1.870086991f, 1.863972856f,
+    1.857728610f, 1.851355193f, 1.844853565f, 1.838224706f, 1.831469612f,
+    1.824589303f, 1.817584813f, 1.810457198f, 1.803207531f, 1.795836905f,
+    1.788346428f, 1.780737229f, 1.773010453f, 1.765167266f, 1.757208847f,
+    1.749136395f, 1.740951125f, 1.732654272f, 1.724247083f, 1.715730825f,
+    1.707106781f, 1.698376249f, 1.689540545f, 1.680600998f, 1.671558955f,
+    1.662415778f, 1.653172843f, 1.643831543f, 1.634393284f, 1.624859488f,
+    1.615231591f, 1.605511041f, 1.595699304f, 1.585797857f, 1.575808191f,
+    1.565731811f, 1.555570233f, 1.545324988f, 1.534997620f, 1.524589683f,
+    1.514102744f, 1.503538384f, 1.492898192f, 1.482183772f, 1.471396737f,
+    1.460538711f, 1.449611330f, 1.438616239f, 1.427555093f, 1.416429560f,
+    1.405241314f, 1.393992040f, 1.382683432f, 1.371317194f, 1.359895037f,
+    1.348418680f, 1.336889853f, 1.325310292f, 1.313681740f, 1.302005949f,
+    1.290284677f, 1.278519689f, 1.266712757f, 1.254865660f, 1.242980180f,
+    1.231058108f, 1.219101240f, 1.207111376f, 1.195090322f, 1.183039888f,
+    1.170961889f, 1.158858143f, 1.146730474f, 1.134580709f, 1.122410675f,
+    1.110222207f, 1.098017140f, 1.085797312f, 1.073564564f, 1.061320736f,
+    1.049067674f, 1.036807223f, 1.024541229f, 1.012271538f, 1.000000000f,
+    0.987728462f, 0.975458771f, 0.963192777f, 0.950932326f, 0.938679264f,
+    0.926435436f, 0.914202688f, 0.901982860f, 0.889777793f, 0.877589325f,
+    0.865419291f, 0.853269526f, 0.841141857f, 0.829038111f, 0.816960112f,
+    0.804909678f, 0.792888624f, 0.780898760f, 0.768941892f, 0.757019820f,
+    0.745134340f, 0.733287243f, 0.721480311f, 0.709715323f, 0.697994051f,
+    0.686318260f, 0.674689708f, 0.663110147f, 0.651581320f, 0.640104963f,
+    0.628682806f, 0.617316568f, 0.606007960f, 0.594758686f, 0.583570440f,
+    0.572444907f, 0.561383761f, 0.550388670f, 0.539461289f, 0.528603263f,
+    0.517816228f, 0.507101808f, 0.496461616f, 0.485897256f, 0.475410317f,
+    0.465002380f, 0.454675012f, 0.444429767f, 0.434268189f, 0.424191809f,
+    0.414202143f, 0.404300696f, 0.394488959f, 0.384768409f, 0.375140512f,
+    0.365606716f, 0.356168457f, 0.346827157f, 0.337584222f, 0.328441045f,
+    0.319399002f, 0.310459455f, 0.301623751f, 0.292893219f, 0.284269175f,
+    0.275752917f, 0.267345728f, 0.259048875f, 0.250863605f, 0.242791153f,
+    0.234832734f, 0.226989547f, 0.219262771f, 0.211653572f, 0.204163095f,
+    0.196792469f, 0.189542802f, 0.182415187f, 0.175410697f, 0.168530388f,
+    0.161775294f, 0.155146435f, 0.148644807f, 0.142271390f, 0.136027144f,
+    0.129913009f, 0.123929906f, 0.118078736f, 0.112360380f, 0.106775699f,
+    0.101325534f, 0.096010707f, 0.090832017f, 0.085790244f, 0.080886148f,
+    0.076120467f, 0.071493920f, 0.067007201f, 0.062660988f, 0.058455935f,
+    0.054392675f, 0.050471819f, 0.046693960f, 0.043059664f, 0.039569481f,
+    0.036223934f, 0.033023529f, 0.029968747f, 0.027060048f, 0.024297870f,
+    0.021682629f, 0.019214720f, 0.016894513f, 0.014722358f, 0.012698582f,
+    0.010823490f, 0.009097365f, 0.007520465f, 0.006093030f, 0.004815273f,
+    0.003687388f, 0.002709543f, 0.001881887f, 0.001204544f, 0.000677615f,
+    0.000301181f, 0.000075298f,
+};
+
+const uint16_t fft_bit_reverse[NUM_SAMPLES] = {
+       0,  256,  128,  384,   64,  320,  192,  448,   32,  288,  160,  416,
+      96,  352,  224,  480,   16,  272,  144,  400,   80,  336,  208,  464,
+      48,  304,  176,  432,  112,  368,  240,  496,    8,  264,  136,  392,
+      72,  328,  200,  456,   40,  296,  168,  424,  104,  360,  232,  488,
+      24,  280,  152,  408,   88,  344,  216,  472,   56,  312,  184,  440,
+     120,  376,  248,  504,    4,  260,  132,  388,   68,  324,  196,  452,
+      36,  292,  164,  420,  100,  356,  228,  484,   20,  276,  148,  404,
+      84,  340,  212,  468,   52,  308,  180,  436,  116,  372,  244,  500,
+      12,  268,  140,  396,   76,  332,  204,  460,   44,  300,  172,  428,
+     108,  364,  236,  492,   28,  284,  156,  412,   92,  348,  220,  476,
+      60,  316,  188,  444,  124,  380,  252,  508,    2,  258,  130,  386,
+      66,  322,  194,  450,   34,  290,  162,  418,   98,  354,  226,  482,
+      18,  274,  146,  402,   82,  338,  210,  466,   50,  306,  178,  434,
+     114,  370,  242,  498,   10,  266,  138,  394,   74,  330,  202,  458,
+      42,  298,  170,  426,  106,  362,  234,  490,   26,  282,  154,  410,
+      90,  346,  218,  474,   58,  314,  186,  442,  122,  378,  250,  506,
+       6,  262,  134,  390,   70,  326,  198,  454,   38,  294,  166,  422,
+     102,  358,  230,  486,   22,  278,  150,  406,   86,  342,  214,  470,
+      54,  310,  182,  438,  118,  374,  246,  502,   14,  270,  142,  398,
+      78,  334,  206,  462,   46,  302,  174,  430,  110,  366,  238,  494,
+      30,  286,  158,  414,   94,  350,  222,  478,   62,  318,  190,  446,
+     126,  382,  254,  510,    1,  257,  129,  385,   65,  321,  193,  449,
+      33,  289,  161,  417,   97,  353,  225,  481,   17,  273,  145,  401,
+      81,  337,  209,  465,   49,  305,  177,  433,  113,  369,  241,  497,
+       9,  265,  137,  393,   73,  329,  201,  457,   41,  297,  169,  425,
+     105,  361,  233,  489,   25,  281,  153,  409,   89,  345,  217,  473,
+      57,  313,  185,  441,  121,  377,  249,  505,    5,  261,  133,  389,
+      69,  325,  197,  453,   37,  293,  165,  421,  101,  357,  229,  485,
+      21,  277,  149,  405,   85,  341,  213,  469,   53,  309,  181,  437,
+     117,  373,  245,  501,   13,  269,  141,  397,   77,  333,  205,  461,
+      45,  301,  173,  429,  109,  365,  237,  493,   29,  285,  157,  413,
+      93,  349,  221,  477,   61,  317,  189,  445,  125,  381,  253,  509,
+       3,  259,  131,  387,   67,  323,  195,  451,   35,  291,  163,  419,
+      99,  355,  227,  483,   19,  275,  147,  403,   83,  339,  211,  467,
+      51,  307,  179,  435,  115,  371,  243,  499,   11,  267,  139,  395,
+      75,  331,  203,  459,   43,  299,  171,  427,  107,  363,  235,  491,
+      27,  283,  155,  411,   91,  347,  219,  475,   59,  315,  187,  443,
+     123,  379,  251,  507,    7,  263,  135,  391,   71,  327,  199,  455,
+      39,  295,  167,  423,  103,  359,  231,  487,   23,  279,  151,  407,
+      87,  343,  215,  471,   55,  311,  183,  439,  119,  375,  247,  503,
+      15,  271,  143,  399,   79,  335,  207,  463,   47,  303,  175,  431,
+     111,  367,  239,  495,   31,  287,  159,  415,   95,  351,  223,  479,
+      63,  319,  191,  447,  127,  383,  255,  511,
+};
+
+#elif NUM_SAMPLES == 1024
+
+const float fft_twiddles[3*NUM_SAMPLES/4][2] = {
+    { 1.000000000f, -0.000000000f },
+    { 0.999981175f, -0.006135885f },
+    { 0.999924702f, -0.012271538f },
+    { 0.999830582f, -0.018406730f },
+    { 0.999698819f, -0.024541229f },
+    { 0.999529418f, -0.030674803f },
+    { 0.999322385f, -0.036807223f },
+    { 0.999077728f, -0.042938257f },
+    { 0.998795456f, -0.049067674f },
+    { 0.998475581f, -0.055195244f },
+    { 0.998118113f, -0.061320736f },
+    { 0.997723067f, -0.067443920f },
+    { 0.997290457f, -0.073564564f },
+    { 0.996820299f, -0.079682438f },
+    { 0.996312612f, -0.085797312f },
+    { 0.995767414f, -0.091908956f },
+    { 0.995184727f, -0.098017140f },
+    { 0.994564571f, -0.104121634f },
+    { 0.993906970f, -0.110222207f },
+    { 0.993211949f, -0.116318631f },
+    { 0.992479535f, -0.122410675f },
+    { 0.991709754f, -0.128498111f },
+    { 0.990902635f, -0.134580709f },
+    { 0.990058210f, -0.140658239f },
+    { 0.989176510f, -0.146730474f },
+    { 0.988257568f, -0.152797185f },
+    { 0.987301418f, -0.158858143f },
+    { 0.986308097f, -0.164913120f },
+    { 0.985277642f, -0.170961889f },
+    { 0.984210092f, -0.177004220f },
+    { 0.983105487f, -0.183039888f },
+    { 0.981963869f, -0.189068664f },
+    { 0.980785280f, -0.195090322f },
+    { 0.979569766f, -0.201104635f },
+    { 0.978317371f, -0.207111376f },
+    { 0.977028143f, -0.213110320f },
+    { 0.975702130f, -0.219101240f },
+    { 0.974339383f, -0.225083911f },
+    { 0.972939952f, -0.231058108f },
+    { 0.971503891f, -0.237023606f },
+    { 0.970031253f, -0.242980180f },
+    { 0.968522094f, -0.248927606f },
+    { 0.966976471f, -0.254865660f },
+    { 0.965394442f, -0.260794118f },
+    { 0.963776066f, -0.266712757f },
+    { 0.962121404f, -0.272621355f },
+    { 0.960430519f, -0.278519689f },
+    { 0.958703475f, -0.284407537f },
+    { 0.956940336f, -0.290284677f },
+    { 0.955141168f, -0.296150888f },
+    { 0.953306040f, -0.302005949f },
+    { 0.951435021f, -0.307849640f },
+    { 0.949528181f, -0.313681740f },
+    { 0.947585591f, -0.319502031f },
+    { 0.945607325f, -0.325310292f },
+    { 0.943593458f, -0.331106306f },
+    { 0.941544065f, -0.336889853f },
+    { 0.939459224f, -0.342660717f },
+    { 0.937339012f, -0.348418680f },
+    { 0.935183510f, -0.354163525f },
+    { 0.932992799f, -0.359895037f },
+    { 0.930766961f, -0.365612998f },
+    { 0.928506080f, -0.371317194f },
+    { 0.926210242f, -0.377007410f },
+    { 0.923879533f, -0.382683432f },
+    { 0.921514039f, -0.388345047f },
+    { 0.919113852f, -0.393992040f },
+    { 0.916679060f, -0.399624200f },
+    { 0.914209756f, -0.405241314f },
+    { 0.911706032f, -0.410843171f },
+    { 0.909167983f, -0.416429560f },
+    { 0.906595705f, -0.422000271f },
+    { 0.903989293f, -0.427555093f },
+    { 0.901348847f, -0.433093819f },
+    { 0.898674466f, -0.438616239f },
+    { 0.895966250f, -0.444122145f },
+    { 0.893224301f, -0.449611330f },
+    { 0.890448723f, -0.455083587f },
+    { 0.887639620f, -0.460538711f },
+    { 0.884797098f, -0.465976496f },
+    { 0.881921264f, -0.471396737f },
+    { 0.879012226f, -0.476799230f },
+    { 0.876070094f, -0.482183772f },
+    { 0.873094978f, -0.487550160f },
+    { 0.870086991f, -0.492898192f },
+    { 0.867046246f, -0.498227667f },
+    { 0.863972856f, -0.503538384f },
+    { 0.860866939f, -0.508830143f },
+    { 0.857728610f, -0.514102744f },
+    { 0.854557988f, -0.519355990f },
+    { 0.851355193f, -0.524589683f },
+    { 0.848120345f, -0.529803625f },
+    { 0.844853565f, -0.534997620f },
+    { 0.841554977f, -0.540171473f },
+    { 0.838224706f, -0.545324988f },
+    { 0.834862875f, -0.550457973f },
+    { 0.831469612f, -0.555570233f },
+    { 0.828045045f, -0.560661576f },
+    { 0.824589303f, -0.565731811f },
+    { 0.821102515f, -0.570780746f },
+    { 0.817584813f, -0.575808191f },
+    { 0.814036330f, -0.580813958f },
+    { 0.810457198f, -0.585797857f },
+    { 0.806847554f, -0.590759702f },
+    { 0.803207531f, -0.595699304f },
+    { 0.799537269f, -0.600616479f },
+    { 0.795836905f, -0.605511041f },
+    { 0.792106577f, -0.610382806f },
+    { 0.788346428f, -0.615231591f },
+    { 0.784556597f, -0.620057212f },
+    { 0.780737229f, -0.624859488f },
+    { 0.776888466f, -0.629638239f },
+    { 0.773010453f, -0.634393284f },
+    { 0.769103338f, -0.639124445f },
+    { 0.765167266f, -0.643831543f },
+    { 0.761202385f, -0.648514401f },
+    { 0.757208847f, -0.653172843f },
+    { 0.753186799f, -0.657806693f },
+    { 0.749136395f, -0.662415778f },
+    { 0.745057785f, -0.666999922f },
+    { 0.740951125f, -0.671558955f },
+    { 0.736816569f, -0.676092704f },
+    { 0.732654272f, -0.680600998f },
+    { 0.728464390f, -0.685083668f },
+    { 0.724247083f, -0.689540545f },
+    { 0.720002508f, -0.693971461f },
+    { 0.715730825f, -0.698376249f },
+    { 0.711432196f, -0.702754744f },
+    { 0.707106781f, -0.707106781f },
+    { 0.702754744f, -0.711432196f },
+    { 0.698376249f, -0.715730825f },
+    { 0.693971461f, -0.720002508f },
+    { 0.689540545f, -0.724247083f },
+    { 0.685083668f, -0.728464390f },
+    { 0.680600998f, -0.732654272f },
+    { 0.676092704f, -0.736816569f },
+    { 0.671558955f, -0.740951125f },
+    { 0.666999922f, -0.745057785f },
+    { 0.662415778f, -0.749136395f },
+    { 0.657806693f, -0.753186799f },
+    { 0.653172843f, -0.757208847f },
+    { 0.648514401f, -0.761202385f },
+    { 0.643831543f, -0.765167266f },
+    { 0.639124445f, -0.769103338f },
+    { 0.634393284f, -0.773010453f },
+    { 0.629638239f, -0.776888466f },
+    { 0.624859488f, -0.780737229f },
+    { 0.620057212f, -0.784556597f },
+    { 0.615231591f, -0.788346428f },
+    { 0.610382806f, -0.792106577f },
+    { 0.605511041f, -0.795836905f },
+    { 0.600616479f, -0.799537269f },
+    { 0.595699304f, -0.803207531f },
+    { 0.590759702f, -0.806847554f },
+    { 0.585797857f, -0.810457198f },
+    { 0.580813958f, -0.814036330f },
+    { 0.575808191f, -0.817584813f },
+    { 0.570780746f, -0.821102515f },
+    { 0.565731811f, -0.824589303f },
+    { 0.560661576f, -0.828045045f },
+    { 0.555570233f, -0.831469612f },
+    { 0.550457973f, -0.834862875f },
+    { 0.545324988f, -0.838224706f },
+    { 0.540171473f, -0.841554977f },
+    { 0.534997620f, -0.844853565f },
+    { 0.529803625f, -0.848120345f },
+    { 0.524589683f, -0.851355193f },
+    { 0.519355990f, -0.854557988f },
+    { 0.514102744f, -0.857728610f },
+    { 0.508830143f, -0.860866939f },
+    { 0.503538384f, -0.863972856f },
+    { 0.498227667f, -0.867046246f },
+    { 0.492898192f, -0.870086991f },
+    { 0.487550160f, -0.873094978f },
+    { 0.482183772f, -0.876070094f },
+    { 0.476799230f, -0.879012226f },
+    { 0.471396737f, -0.881921264f },
+    { 0.465976496f, -0.884797098f },
+    { 0.460538711f, -0.887639620f },
+    { 0.455083587f, -0.890448723f },
+    { 0.449611330f, -0.893224301f },
+    { 0.444122145f, -0.895966250f },
+    { 0.438616239f, -0.898674466f },
+    { 0.433093819f, -0.901348847f },
+    { 0.427555093f, -0.903989293f },
+    { 0.422000271f, -0.906595705f },
+    { 0.416429560f, -0.909167983f },
+    { 0.410843171f, -0.911706032f },
+    { 0.405241314f, -0.914209756f },
+    { 0.399624200f, -0.916679060f },
+    { 0.393992040f, -0.919113852f },
+    { 0.388345047f, -0.921514039f },
+    { 0.382683432f, -0.923879533f },
+    { 0.377007410f, -0.926210242f },
+    { 0.371317194f, -0.928506080f },
+    { 0.365612998f, -0.930766961f },
+    { 0.359895037f, -0.932992799f },
+    { 0.354163525f, -0.935183510f },
+    { 0.348418680f, -0.937339012f },
+    { 0.342660717f, -0.939459224f },
+    { 0.336889853f, -0.941544065f },
+    { 0.331106306f, -0.943593458f },
+    { 0.325310292f, -0.945607325f },
+    { 0.319502031f, -0.947585591f },
+    { 0.313681740f, -0.949528181f },
+    { 0.307849640f, -0.951435021f },
+    { 0.302005949f, -0.953306040f },
+    { 0.296150888f, -0.955141168f },
+    { 0.290284677f, -0.956940336f },
+    { 0.284407537f, -0.958703475f },
+    { 0.278519689f, -0.960430519f },
+    { 0.272621355f, -0.962121404f },
+    { 0.266712757f, -0.963776066f },
+    { 0.260794118f, -0.965394442f },
+    { 0.254865660f, -0.966976471f },
+    { 0.248927606f, -0.968522094f },
+    { 0.242980180f, -0.970031253f },
+    { 0.237023606f, -0.971503891f },
+    { 0.231058108f, -0.972939952f },
+    { 0.225083911f, -0.974339383f },
+    { 0.219101240f, -0.975702130f },
+    { 0.213110320f, -0.977028143f },
+    { 0.207111376f, -0.978317371f },
+    { 0.201104635f, -0.979569766f },
+    { 0.195090322f, -0.980785280f },
+    { 0.189068664f, -0.981963869f },
+    { 0.183039888f, -0.983105487f },
+    { 0.177004220f, -0.984210092f },
+    { 0.170961889f, -0.985277642f },
+    { 0.164913120f, -0.986308097f },
+    { 0.158858143f, -0.987301418f },
+    { 0.152797185f, -0.988257568f },
+    { 0.146730474f, -0.989176510f },
+    { 0.140658239f, -0.990058210f },
+    { 0.134580709f, -0.990902635f },
+    { 0.128498111f, -0.991709754f },
+    { 0.122410675f, -0.992479535f },
+    { 0.116318631f, -0.993211949f },
+    { 0.110222207f, -0.993906970f },
+    { 0.104121634f, -0.994564571f },
+    { 0.098017140f, -0.995184727f },
+    { 0.091908956f, -0.995767414f },
+    { 0.085797312f, -0.996312612f },
+    { 0.079682438f, -0.996820299f },
+    { 0.073564564f, -0.997290457f },
+    { 0.067443920f, -0.997723067f },
+    { 0.061320736f, -0.998118113f },
+    { 0.055195244f, -0.998475581f },
+    { 0.049067674f, -0.998795456f },
+    { 0.042938257f, -0.999077728f },
+    { 0.036807223f, -0.999322385f },
+    { 0.030674803f, -0.999529418f },
+    { 0.024541229f, -0.999698819f },
+    { 0.018406730f, -0.999830582f },
+    { 0.012271538f, -0.999924702f },
+    { 0.006135885f, -0.999981175f },
+    { 0.000000000f, -1.000000000f },
+    { -0.006135885f, -0.999981175f },
+    { -0.012271538f, -0.999924702f },
+    { -0.018406730f, -0.999830582f },
+    { -0.024541229f, -0.999698819f },
+    { -0.030674803f, -0.999529418f },
+    { -0.036807223f, -0.999322385f },
+    { -0.042938257f, -0.999077728f },
+    { -0.049067674f, -0.998795456f },
+    { -0.055195244f, -0.998475581f },
+    { -0.061320736f, -0.998118113f },
+    { -0.067443920f, -0.997723067f },
+    { -0.073564564f, -0.997290457f },
+    { -0.079682438f, -0.996820299f },
+    { -0.085797312f, -0.996312612f },
+    { -0.091908956f, -0.995767414f },
+    { -0.098017140f, -0.995184727f },
+    { -0.104121634f, -0.994564571f },
+    { -0.110222207f, -0.993906970f },
+    { -0.116318631f, -0.993211949f },
+    { -0.122410675f, -0.992479535f },
+    { -0.128498111f, -0.991709754f },
+    { -0.134580709f, -0.990902635f },
+    { -0.140658239f, -0.990058210f },
+    { -0.146730474f, -0.989176510f },
+    { -0.152797185f, -0.988257568f },
+    { -0.158858143f, -0.987301418f },
+    { -0.164913120f, -0.986308097f },
+    { -0.170961889f, -0.985277642f },
+    { -0.177004220f, -0.984210092f },
+    { -0.183039888f, -0.983105487f },
+    { -0.189068664f, -0.981963869f },
+    { -0.195090322f, -0.980785280f },
+    { -0.201104635f, -0.979569766f },
+    { -0.207111376f, -0.978317371f },
+    { -0.213110320f, -0.977028143f },
+    { -0.219101240f, -0.975702130f },
+    { -0.225083911f, -0.974339383f },
+    { -0.231058108f, -0.972939952f },
+    { -0.237023606f, -0.971503891f },
+    { -0.242980180f, -0.970031253f },
+    { -0.248927606f, -0.968522094f },
+    { -0.254865660f, -0.966976471f },
+    { -0.260794118f, -0.965394442f },
+    { -0.266712757f, -0.963776066f },
+    { -0.272621355f, -0.962121404f },
+    { -0.278519689f, -0.960430519f },
+    { -0.284407537f, -0.958703475f },
+    { -0.290284677f, -0.956940336f },
+    { -0.296150888f, -0.955141168f },
+    { -0.302005949f, -0.953306040f },
+    { -0.307849640f, -0.951435021f },
+    { -0.313681740f, -0.949528181f },
+    { -0.319502031f, -0.947585591f },
+    { -0.325310292f, -0.945607325f },
+    { -0.331106306f, -0.943593458f },
+    { -0.336889853f, -0.941544065f },
+    { -0.342660717f, -0.939459224f },
+    { -0.348418680f, -0.937339012f },
+    { -0.354163525f, -0.935183510f },
+    { -0.359895037f, -0.932992799f },
+    { -0.365612998f, -0.930766961f },
+    { -0.371317194f, -0.928506080f },
+    { -0.377007410f, -0.926210242f },
+    { -0.382683432f, -0.923879533f },
+    { -0.388345047f, -0.921514039f },
+    { -0.393992040f, -0.919113852f },
+    { -0.399624200f, -0.916679060f },
+    { -0.405241314f, -0.914209756f },
+    { -0.410843171f, -0.911706032f },
+    { -0.416429560f, -0.909167983f },
+    { -0.422000271f, -0.906595705f },
+    { -0.427555093f, -0.903989293f },
+    { -0.433093819f, -0.901348847f },
+    { -0.438616239f, -0.898674466f },
+    { -0.444122145f, -0.895966250f },
+    { -0.449611330f, -0.893224301f },
+    { -0.455083587f, -0.890448723f },
+    { -0.460538711f, -0.887639620f },
+    { -0.465976496f, -0.884797098f },
+    { -0.471396737f, -0.881921264f },
+    { -0.476799230f, -0.879012226f },
+    { -0.482183772f, -0.876070094f },
+    { -0.487550160f, -0.873094978f },
+    { -0.492898192f, -0.870086991f },
+    { -0.498227667f, -0.867046246f },
+    { -0.503538384f, -0.863972856f },
+    { -0.508830143f, -0.860866939f },
+    { -0.514102744f, -0.857728610f },
+    { -0.519355990f, -0.854557988f },
+    { -0.524589683f, -0.851355193f },
+    { -0.529803625f, -0.848120345f },
+    { -0.534997620f, -0.844853565f },
+    { -0.540171473f, -0.841554977f },
+    { -0.545324988f, -0.838224706f },
+    { -0.550457973f, -0.834862875f },
+    { -0.555570233f, -0.831469612f },
+    { -0.560661576f, -0.828045045f },
+    { -0.565731811f, -0.824589303f },
+    { -0.570780746f, -0.821102515f },
+    { -0.575808191f, -0.817584813f },
+    { -0.580813958f, -0.814036330f },
+    { -0.585797857f, -0.810457198f },
+    { -0.590759702f, -0.806847554f },
+    { -0.595699304f, -0.803207531f },
+    { -0.600616479f, -0.799537269f },
+    { -0.605511041f, -0.795836905f },
+    { -0.610382806f, -0.792106577f },
+    { -0.615231591f, -0.788346428f },
+    { -0.620057212f, -0.784556597f },
+    { -0.624859488f, -0.780737229f },
+    { -0.629638239f, -0.776888466f },
+    { -0.634393284f, -0.773010453f },
+    { -0.639124445f, -0.769103338f },
+    { -0.643831543f, -0.765167266f },
+    { -0.648514401f, -0.761202385f },
+    { -0.653172843f, -0.757208847f },
+    { -0.657806693f, -0.753186799f },
+    { -0.662415778f, -0.749136395f },
+    { -0.666999922f, -0.745057785f },
+    { -0.671558955f, -0.740951125f },
+    { -0.676092704f, -0.736816569f },
+    { -0.680600998f, -0.732654272f },
+    { -0.685083668f, -0.728464390f },
+    { -0.689540545f, -0.724247083f },
+    { -0.693971461f, -0.720002508f },
+    { -0.698376249f, -0.715730825f },
+    { -0.702754744f, -0.711432196f },
+    { -0.707106781f, -0.707106781f },
+    { -0.711432196f, -0.702754744f },
+    { -0.715730825f, -0.698376249f },
+    { -0.720002508f, -0.693971461f },
+    { -0.724247083f, -0.689540545f },
+    { -0.728464390f, -0.685083668f },
+    { -0.732654272f, -0.680600998f },
+    { -0.736816569f, -0.676092704f },
+    { -0.740951125f, -0.671558955f },
+    { -0.745057785f, -0.666999922f },
+    { -0.749136395f, -0.662415778f },
+    { -0.753186799f, -0.657806693f },
+    { -0.757208847f, -0.653172843f },
+    { -0.761202385f, -0.648514401f },
+    { -0.765167266f, -0.643831543f },
+    { -0.769103338f, -0.639124445f },
+    { -0.773010453f, -0.634393284f },
+    { -0.776888466f, -0.629638239f },
+    { -0.780737229f, -0.624859488f },
+    { -0.784556597f, -0.620057212f },
+    { -0.788346428f, -0.615231591f },
+    { -0.792106577f, -0.610382806f },
+    { -0.795836905f, -0.605511041f },
+    { -0.799537269f, -0.600616479f },
+    { -0.803207531f, -0.595699304f },
+    { -0.806847554f, -0.590759702f },
+    { -0.810457198f, -0.585797857f },
+    { -0.814036330f, -0.580813958f },
+    { -0.817584813f, -0.575808191f },
+    { -0.821102515f, -0.570780746f },
+    { -0.824589303f, -0.565731811f },
+    { -0.828045045f, -0.560661576f },
+    { -0.831469612f, -0.555570233f },
+    { -0.834862875f, -0.550457973f },
+    { -0.838224706f, -0.545324988f },
+    { -0.841554977f, -0.540171473f },
+    { -0.844853565f, -0.534997620f },
+    { -0.848120345f, -0.529803625f },
+    { -0.851355193f, -0.524589683f },
+    { -0.854557988f, -0.519355990f },
+    { -0.857728610f, -0.514102744f },
+    { -0.860866939f, -0.508830143f },
+    { -0.863972856f, -0.503538384f },
+    { -0.867046246f, -0.498227667f },
+    { -0.870086991f, -0.492898192f },
+    { -0.873094978f, -0.487550160f },
+    { -0.876070094f, -0.482183772f },
+    { -0.879012226f, -0.476799230f },
+    { -0.881921264f, -0.471396737f },
+    { -0.884797098f, -0.465976496f },
+    { -0.887639620f, -0.460538711f },
+    { -0.890448723f, -0.455083587f },
+    { -0.893224301f, -0.449611330f },
+    { -0.895966250f, -0.444122145f },
+    { -0.898674466f, -0.438616239f },
+    { -0.901348847f, -0.433093819f },
+    { -0.903989293f, -0.427555093f },
+    { -0.906595705f, -0.422000271f },
+    { -0.909167983f, -0.416429560f },
+    { -0.911706032f, -0.410843171f },
+    { -0.914209756f, -0.405241314f },
+    { -0.916679060f, -0.399624200f },
+    { -0.919113852f, -0.393992040f },
+    { -0.921514039f, -0.388345047f },
+    { -0.923879533f, -0.382683432f },
+    { -0.926210242f, -0.377007410f },
+    { -0.928506080f, -0.371317194f },
+    { -0.930766961f, -0.365612998f },
+    { -0.932992799f, -0.359895037f },
+    { -0.935183510f, -0.354163525f },
+    { -0.937339012f, -0.348418680f },
+    { -0.939459224f, -0.342660717f },
+    { -0.941544065f, -0.336889853f },
+    { -0.943593458f, -0.331106306f },
+    { -0.945607325f, -0.325310292f },
+    { -0.947585591f, -0.319502031f },
+    { -0.949528181f, -0.313681740f },
+    { -0.951435021f, -0.307849640f },
+    { -0.953306040f, -0.302005949f },
+    { -0.955141168f, -0.296150888f },
+    { -0.956940336f, -0.290284677f },
+    { -0.958703475f, -0.284407537f },
+    { -0.960430519f, -0.278519689f },
+    { -0.962121404f, -0.272621355f },
+    { -0.963776066f, -0.266712757f },
+    { -0.965394442f, -0.260794118f },
+    { -0.966976471f, -0.254865660f },
+    { -0.968522094f, -0.248927606f },
+    { -0.970031253f, -0.242980180f },
+    { -0.971503891f, -0.237023606f },
+    { -0.972939952f, -0.231058108f },
+    { -0.974339383f, -0.225083911f },
+    { -0.975702130f, -0.219101240f },
+    { -0.977028143f, -0.213110320f },
+    { -0.978317371f, -0.207111376f },
+    { -0.979569766f, -0.201104635f },
+    { -0.980785280f, -0.195090322f },
+    { -0.981963869f, -0.189068664f },
+    { -0.983105487f, -0.183039888f },
+    { -0.984210092f, -0.177004220f },
+    { -0.985277642f, -0.170961889f },
+    { -0.986308097f, -0.164913120f },
+    { -0.987301418f, -0.158858143f },
+    { -0.988257568f, -0.152797185f },
+    { -0.989176510f, -0.146730474f },
+    { -0.990058210f, -0.140658239f },
+    { -0.990902635f, -0.134580709f },
+    { -0.991709754f, -0.128498111f },
+    { -0.992479535f, -0.122410675f },
+    { -0.993211949f, -0.116318631f },
+    { -0.993906970f, -0.110222207f },
+    { -0.994564571f, -0.104121634f },
+    { -0.995184727f, -0.098017140f },
+    { -0.995767414f, -0.091908956f },
+    { -0.996312612f, -0.085797312f },
+    { -0.996820299f, -0.079682438f },
+    { -0.997290457f, -0.073564564f },
+    { -0.997723067f, -0.067443920f },
+    { -0.998118113f, -0.061320736f },
+    { -0.998475581f, -0.055195244f },
+    { -0.998795456f, -0.049067674f },
+    { -0.999077728f, -0.042938257f },
+    { -0.999322385f, -0.036807223f },
+    { -0.999529418f, -0.030674803f },
+    { -0.999698819f, -0.024541229f },
+    { -0.999830582f, -0.018406730f },
+    { -0.999924702f, -0.012271538f },
+    { -0.999981175f, -0.006135885f },
+    { -1.000000000f, -0.000000000f },
+    { -0.999981175f, 0.006135885f },
+    { -0.999924702f, 0.012271538f },
+    { -0.999830582f, 0.018406730f },
+    { -0.999698819f, 0.024541229f },
+    { -0.999529418f, 0.030674803f },
+    { -0.999322385f, 0.036807223f },
+    { -0.999077728f, 0.042938257f },
+    { -0.998795456f, 0.049067674f },
+    { -0.998475581f, 0.055195244f },
+    { -0.998118113f, 0.061320736f },
+    { -0.997723067f, 0.067443920f },
+    { -0.997290457f, 0.073564564f },
+    { -0.996820299f, 0.079682438f },
+    { -0.996312612f, 0.085797312f },
+    { -0.995767414f, 0.091908956f },
+    { -0.995184727f, 0.098017140f },
+    { -0.994564571f, 0.104121634f },
+    { -0.993906970f, 0.110222207f },
+    { -0.993211949f, 0.116318631f },
+    { -0.992479535f, 0.122410675f },
+    { -0.991709754f, 0.128498111f },
+    { -0.990902635f, 0.134580709f },
+    { -0.990058210f, 0.140658239f },
+    { -0.989176510f, 0.146730474f },
+    { -0.988257568f, 0.152797185f },
+    { -0.987301418f, 0.158858143f },
+    { -0.986308097f, 0.164913120f },
+    { -0.985277642f, 0.170961889f },
+    { -0.984210092f, 0.177004220f },
+    { -0.983105487f, 0.183039888f },
+    { -0.981963869f, 0.189068664f },
+    { -0.980785280f, 0.195090322f },
+    { -0.979569766f, 0.201104635f },
+    { -0.978317371f, 0.207111376f },
+    { -0.977028143f, 0.213110320f },
+    { -0.975702130f, 0.219101240f },
+    { -0.974339383f, 0.225083911f },
+    { -0.972939952f, 0.231058108f },
+    { -0.971503891f, 0.237023606f },
+    { -0.970031253f, 0.242980180f },
+    { -0.968522094f, 0.248927606f },
+    { -0.966976471f, 0.254865660f },
+    { -0.965394442f, 0.260794118f },
+    { -0.963776066f, 0.266712757f },
+    { -0.962121404f, 0.272621355f },
+    { -0.960430519f, 0.278519689f },
+    { -0.958703475f, 0.284407537f },
+    { -0.956940336f, 0.290284677f },
+    { -0.955141168f, 0.296150888f },
+    { -0.953306040f, 0.302005949f },
+    { -0.951435021f, 0.307849640f },
+    { -0.949528181f, 0.313681740f },
+    { -0.947585591f, 0.319502031f },
+    { -0.945607325f, 0.325310292f },
+    { -0.943593458f, 0.331106306f },
+    { -0.941544065f, 0.336889853f },
+    { -0.939459224f, 0.342660717f },
+    { -0.937339012f, 0.348418680f },
+    { -0.935183510f, 0.354163525f },
+    { -0.932992799f, 0.359895037f },
+    { -0.930766961f, 0.365612998f },
+    { -0.928506080f, 0.371317194f },
+    { -0.926210242f, 0.377007410f },
+    { -0.923879533f, 0.382683432f },
+    { -0.921514039f, 0.388345047f },
+    { -0.919113852f, 0.393992040f },
+    { -0.916679060f, 0.399624200f },
+    { -0.914209756f, 0.405241314f },
+    { -0.911706032f, 0.410843171f },
+    { -0.909167983f, 0.416429560f },
+    { -0.906595705f, 0.422000271f },
+    { -0.903989293f, 0.427555093f },
+    { -0.901348847f, 0.433093819f },
+    { -0.898674466f, 0.438616239f },
+    { -0.895966250f, 0.444122145f },
+    { -0.893224301f, 0.449611330f },
+    { -0.890448723f, 0.455083587f },
+    { -0.887639620f, 0.460538711f },
+    { -0.884797098f, 0.465976496f },
+    { -0.881921264f, 0.471396737f },
+    { -0.879012226f, 0.476799230f },
+    { -0.876070094f, 0.482183772f },
+    { -0.873094978f, 0.487550160f },
+    { -0.870086991f, 0.492898192f },
+    { -0.867046246f, 0.498227667f },
+    { -0.863972856f, 0.503538384f },
+    { -0.860866939f, 0.508830143f },
+    { -0.857728610f, 0.514102744f },
+    { -0.854557988f, 0.519355990f },
+    { -0.851355193f, 0.524589683f },
+    { -0.848120345f, 0.529803625f },
+    { -0.844853565f, 0.534997620f },
+    { -0.841554977f, 0.540171473f },
+    { -0.838224706f, 0.545324988f },
+    { -0.834862875f, 0.550457973f },
+    { -0.831469612f, 0.555570233f },
+    { -0.828045045f, 0.560661576f },
+    { -0.824589303f, 0.565731811f },
+    { -0.821102515f, 0.570780746f },
+    { -0.817584813f, 0.575808191f },
+    { -0.814036330f, 0.580813958f },
+    { -0.810457198f, 0.585797857f },
+    { -0.806847554f, 0.590759702f },
+    { -0.803207531f, 0.595699304f },
+    { -0.799537269f, 0.600616479f },
+    { -0.795836905f, 0.605511041f },
+    { -0.792106577f, 0.610382806f },
+    { -0.788346428f, 0.615231591f },
+    { -0.784556597f, 0.620057212f },
+    { -0.780737229f, 0.624859488f },
+    { -0.776888466f, 0.629638239f },
+    { -0.773010453f, 0.634393284f },
+    { -0.769103338f, 0.639124445f },
+    { -0.765167266f, 0.643831543f },
+    { -0.761202385f, 0.648514401f },
+    { -0.757208847f, 0.653172843f },
+    { -0.753186799f, 0.657806693f },
+    { -0.749136395f, 0.662415778f },
+    { -0.745057785f, 0.666999922f },
+    { -0.740951125f, 0.671558955f },
+    { -0.736816569f, 0.676092704f },
+    { -0.732654272f, 0.680600998f },
+    { -0.728464390f, 0.685083668f },
+    { -0.724247083f, 0.689540545f },
+    { -0.720002508f, 0.693971461f },
+    { -0.715730825f, 0.698376249f },
+    { -0.711432196f, 0.702754744f },
+    { -0.707106781f, 0.707106781f },
+    { -0.702754744f, 0.711432196f },
+    { -0.698376249f, 0.715730825f },
+    { -0.693971461f, 0.720002508f },
+    { -0.689540545f, 0.724247083f },
+    { -0.685083668f, 0.728464390f },
+    { -0.680600998f, 0.732654272f },
+    { -0.676092704f, 0.736816569f },
+    { -0.671558955f, 0.740951125f },
+    { -0.666999922f, 0.745057785f },
+    { -0.662415778f, 0.749136395f },
+    { -0.657806693f, 0.753186799f },
+    { -0.653172843f, 0.757208847f },
+    { -0.648514401f, 0.761202385f },
+    { -0.643831543f, 0.765167266f },
+    { -0.639124445f, 0.769103338f },
+    { -0.634393284f, 0.773010453f },
+    { -0.629638239f, 0.776888466f },
+    { -0.624859488f, 0.780737229f },
+    { -0.620057212f, 0.784556597f },
+    { -0.615231591f, 0.788346428f },
+    { -0.610382806f, 0.792106577f },
+    { -0.605511041f, 0.795836905f },
+    { -0.600616479f, 0.799537269f },
+    { -0.595699304f, 0.803207531f },
+    { -0.590759702f, 0.806847554f },
+    { -0.585797857f, 0.810457198f },
+    { -0.580813958f, 0.814036330f },
+    { -0.575808191f, 0.817584813f },
+    { -0.570780746f, 0.821102515f },
+    { -0.565731811f, 0.824589303f },
+    { -0.560661576f, 0.828045045f },
+    { -0.555570233f, 0.831469612f },
+    { -0.550457973f, 0.834862875f },
+    { -0.545324988f, 0.838224706f },
+    { -0.540171473f, 0.841554977f },
+    { -0.534997620f, 0.844853565f },
+    { -0.529803625f, 0.848120345f },
+    { -0.524589683f, 0.851355193f },
+    { -0.519355990f, 0.854557988f },
+    { -0.514102744f, 0.857728610f },
+    { -0.508830143f, 0.860866939f },
+    { -0.503538384f, 0.863972856f },
+    { -0.498227667f, 0.867046246f },
+    { -0.492898192f, 0.870086991f },
+    { -0.487550160f, 0.873094978f },
+    { -0.482183772f, 0.876070094f },
+    { -0.476799230f, 0.879012226f },
+    { -0.471396737f, 0.881921264f },
+    { -0.465976496f, 0.884797098f },
+    { -0.460538711f, 0.887639620f },
+    { -0.455083587f, 0.890448723f },
+    { -0.449611330f, 0.893224301f },
+    { -0.444122145f, 0.895966250f },
+    { -0.438616239f, 0.898674466f },
+    { -0.433093819f, 0.901348847f },
+    { -0.427555093f, 0.903989293f },
+    { -0.422000271f, 0.906595705f },
+    { -0.416429560f, 0.909167983f },
+    { -0.410843171f, 0.911706032f },
+    { -0.405241314f, 0.914209756f },
+    { -0.399624200f, 0.916679060f },
+    { -0.393992040f, 0.919113852f },
+    { -0.388345047f, 0.921514039f },
+    { -0.382683432f, 0.923879533f },
+    { -0.377007410f, 0.926210242f },
+    { -0.371317194f, 0.928506080f },
+    { -0.365612998f, 0.930766961f },
+    { -0.359895037f, 0.932992799f },
+    { -0.354163525f, 0.935183510f },
+    { -0.348418680f, 0.937339012f },
+    { -0.342660717f, 0.939459224f },
+    { -0.336889853f, 0.941544065f },
+    { -0.331106306f, 0.943593458f },
+    { -0.325310292f, 0.945607325f },
+    { -0.319502031f, 0.947585591f },
+    { -0.313681740f, 0.949528181f },
+    { -0.307849640f, 0.951435021f },
+    { -0.302005949f, 0.953306040f },
+    { -0.296150888f, 0.955141168f },
+    { -0.290284677f, 0.956940336f },
+    { -0.284407537f, 0.958703475f },
+    { -0.278519689f, 0.960430519f },
+    { -0.272621355f, 0.962121404f },
+    { -0.266712757f, 0.963776066f },
+    { -0.260794118f, 0.965394442f },
+    { -0.254865660f, 0.966976471f },
+    { -0.248927606f, 0.968522094f },
+    { -0.242980180f, 0.970031253f },
+    { -0.237023606f, 0.971503891f },
+    { -0.231058108f, 0.972939952f },
+    { -0.225083911f, 0.974339383f },
+    { -0.219101240f, 0.975702130f },
+    { -0.213110320f, 0.977028143f },
+    { -0.207111376f, 0.978317371f },
+    { -0.201104635f, 0.979569766f },
+    { -0.195090322f, 0.980785280f },
+    { -0.189068664f, 0.981963869f },
+    { -0.183039888f, 0.983105487f },
+    { -0.177004220f, 0.984210092f },
+    { -0.170961889f, 0.985277642f },
+    { -0.164913120f, 0.986308097f },
+    { -0.158858143f, 0.987301418f },
+    { -0.152797185f, 0.988257568f },
+    { -0.146730474f, 0.989176510f },
+    { -0.140658239f, 0.990058210f },
+    { -0.134580709f, 0.990902635f },
+    { -0.128498111f, 0.991709754f },
+    { -0.122410675f, 0.992479535f },
+    { -0.116318631f, 0.993211949f },
+    { -0.110222207f, 0.993906970f },
+    { -0.104121634f, 0.994564571f },
+    { -0.098017140f, 0.995184727f },
+    { -0.091908956f, 0.995767414f },
+    { -0.085797312f, 0.996312612f },
+    { -0.079682438f, 0.996820299f },
+    { -0.073564564f, 0.997290457f },
+    { -0.067443920f, 0.997723067f },
+    { -0.061320736f, 0.998118113f },
+    { -0.055195244f, 0.998475581f },
+    { -0.049067674f, 0.998795456f },
+    { -0.042938257f, 0.999077728f },
+    { -0.036807223f, 0.999322385f },
+    { -0.030674803f, 0.999529418f },
+    { -0.024541229f, 0.999698819f },
+    { -0.018406730f, 0.999830582f },
+    { -0.012271538f, 0.999924702f },
+    { -0.006135885f, 0.999981175f },
+};
+
+const uint32_t fft_q15_twiddles[NUM_SAMPLES/2] = {
+    0x00007FFF, 0xFF377FFF, 0xFE6E7FFE, 0xFDA57FFA, 0xFCDC7FF6, 0xFC137FF1,
+    0xFB4A7FEA, 0xFA817FE2, 0xF9B87FD9, 0xF8EF7FCE, 0xF8277FC2, 0xF75E7FB5,
+    0xF6957FA7, 0xF5CD7F98, 0xF5057F87, 0xF43C7F75, 0xF3747F62, 0xF2AC7F4E,
+    0xF1E47F38, 0xF11C7F22, 0xF0557F0A, 0xEF8D7EF0, 0xEEC67ED6, 0xEDFF7EBA,
+    0xED387E9D, 0xEC717E7F, 0xEBAB7E60, 0xEAE47E3F, 0xEA1E7E1E, 0xE9587DFB,
+    0xE8927DD6, 0xE7CD7DB1, 0xE7077D8A, 0xE6427D63, 0xE57D7D3A, 0xE4B97D0F,
+    0xE3F47CE4, 0xE3307CB7, 0xE26D7C89, 0xE1A97C5A, 0xE0E67C2A, 0xE0237BF9,
+    0xDF617BC6, 0xDE9E7B92, 0xDDDC7B5D, 0xDD1B7B27, 0xDC597AEF, 0xDB997AB7,
+    0xDAD87A7D, 0xDA187A42, 0xD9587A06, 0xD89879C9, 0xD7D9798A, 0xD71B794A,
+    0xD65C790A, 0xD59E78C8, 0xD4E17885, 0xD4247840, 0xD36777FB, 0xD2AB77B4,
+    0xD1EF776C, 0xD1347723, 0xD07976D9, 0xCFBE768E, 0xCF047642, 0xCE4B75F4,
+    0xCD9275A6, 0xCCD97556, 0xCC217505, 0xCB6974B3, 0xCAB27460, 0xC9FC740B,
+    0xC94673B6, 0xC890735F, 0xC7DB7308, 0xC72772AF, 0xC6737255, 0xC5C071FA,
+    0xC50D719E, 0xC45B7141, 0xC3A970E3, 0xC2F87083, 0xC2487023, 0xC1986FC2,
+    0xC0E96F5F, 0xC03A6EFB, 0xBF8C6E97, 0xBEDF6E31, 0xBE326DCA, 0xBD866D62,
+    0xBCDA6CF9, 0xBC2F6C8F, 0xBB856C24, 0xBADC6BB8, 0xBA336B4B, 0xB98B6ADD,
+    0xB8E36A6E, 0xB83C69FD, 0xB796698C, 0xB6F1691A, 0xB64C68A7, 0xB5A86832,
+    0xB50567BD, 0xB4626747, 0xB3C066D0, 0xB31F6657, 0xB27F65DE, 0xB1DF6564,
+    0xB14064E9, 0xB0A2646C, 0xB00563EF, 0xAF686371, 0xAECC62F2, 0xAE316272,
+    0xAD9761F1, 0xACFD616F, 0xAC6560EC, 0xABCD6068, 0xAB365FE4, 0xAAA05F5E,
+    0xAA0A5ED7, 0xA9765E50, 0xA8E25DC8, 0xA84F5D3E, 0xA7BD5CB4, 0xA72C5C29,
+    0xA69C5B9D, 0xA60C5B10, 0xA57E5A82, 0xA4F059F4, 0xA4635964, 0xA3D758D4,
+    0xA34C5843, 0xA2C257B1, 0xA238571E, 0xA1B0568A, 0xA12955F6, 0xA0A25560,
+    0xA01C54CA, 0x9F985433, 0x9F14539B, 0x9E915303, 0x9E0F5269, 0x9D8E51CF,
+    0x9D0E5134, 0x9C8F5098, 0x9C114FFB, 0x9B944F5E, 0x9B174EC0, 0x9A9C4E21,
+    0x9A224D81, 0x99A94CE1, 0x99304C40, 0x98B94B9E, 0x98434AFB, 0x97CE4A58,
+    0x975949B4, 0x96E6490F, 0x9674486A, 0x960347C4, 0x9592471D, 0x95234675,
+    0x94B545CD, 0x94484524, 0x93DC447B, 0x937143D1, 0x93074326, 0x929E427A,
+    0x923641CE, 0x91CF4121, 0x91694074, 0x91053FC6, 0x90A13F17, 0x903E3E68,
+    0x8FDD3DB8, 0x8F7D3D08, 0x8F1D3C57, 0x8EBF3BA5, 0x8E623AF3, 0x8E063A40,
+    0x8DAB398D, 0x8D5138D9, 0x8CF83825, 0x8CA13770, 0x8C4A36BA, 0x8BF53604,
+    0x8BA0354E, 0x8B4D3497, 0x8AFB33DF, 0x8AAA3327, 0x8A5A326E, 0x8A0C31B5,
+    0x89BE30FC, 0x89723042, 0x89272F87, 0x88DD2ECC, 0x88942E11, 0x884C2D55,
+    0x88052C99, 0x87C02BDC, 0x877B2B1F, 0x87382A62, 0x86F629A4, 0x86B628E5,
+    0x86762827, 0x86372768, 0x85FA26A8, 0x85BE25E8, 0x85832528, 0x85492467,
+    0x851123A7, 0x84D922E5, 0x84A32224, 0x846E2162, 0x843A209F, 0x84071FDD,
+    0x83D61F1A, 0x83A61E57, 0x83771D93, 0x83491CD0, 0x831C1C0C, 0x82F11B47,
+    0x82C61A83, 0x829D19BE, 0x827618F9, 0x824F1833, 0x822A176E, 0x820516A8,
+    0x81E215E2, 0x81C1151C, 0x81A01455, 0x8181138F, 0x816312C8, 0x81461201,
+    0x812A113A, 0x81101073, 0x80F60FAB, 0x80DE0EE4, 0x80C80E1C, 0x80B20D54,
+    0x809E0C8C, 0x808B0BC4, 0x80790AFB, 0x80680A33, 0x8059096B, 0x804B08A2,
+    0x803E07D9, 0x80320711, 0x80270648, 0x801E057F, 0x801604B6, 0x800F03ED,
+    0x800A0324, 0x8006025B, 0x80020192, 0x800100C9, 0x80000000, 0x8001FF37,
+    0x8002FE6E, 0x8006FDA5, 0x800AFCDC, 0x800FFC13, 0x8016FB4A, 0x801EFA81,
+    0x8027F9B8, 0x8032F8EF, 0x803EF827, 0x804BF75E, 0x8059F695, 0x8068F5CD,
+    0x8079F505, 0x808BF43C, 0x809EF374, 0x80B2F2AC, 0x80C8F1E4, 0x80DEF11C,
+    0x80F6F055, 0x8110EF8D, 0x812AEEC6, 0x8146EDFF, 0x8163ED38, 0x8181EC71,
+    0x81A0EBAB, 0x81C1EAE4, 0x81E2EA1E, 0x8205E958, 0x822AE892, 0x824FE7CD,
+    0x8276E707, 0x829DE642, 0x82C6E57D, 0x82F1E4B9, 0x831CE3F4, 0x8349E330,
+    0x8377E26D, 0x83A6E1A9, 0x83D6E0E6, 0x8407E023, 0x843ADF61, 0x846EDE9E,
+    0x84A3DDDC, 0x84D9DD1B, 0x8511DC59, 0x8549DB99, 0x8583DAD8, 0x85BEDA18,
+    0x85FAD958, 0x8637D898, 0x8676D7D9, 0x86B6D71B, 0x86F6D65C, 0x8738D59E,
+    0x877BD4E1, 0x87C0D424, 0x8805D367, 0x884CD2AB, 0x8894D1EF, 0x88DDD134,
+    0x8927D079, 0x8972CFBE, 0x89BECF04, 0x8A0CCE4B, 0x8A5ACD92, 0x8AAACCD9,
+    0x8AFBCC21, 0x8B4DCB69, 0x8BA0CAB2, 0x8BF5C9FC, 0x8C4AC946, 0x8CA1C890,
+    0x8CF8C7DB, 0x8D51C727, 0x8DABC673, 0x8E06C5C0, 0x8E62C50D, 0x8EBFC45B,
+    0x8F1DC3A9, 0x8F7DC2F8, 0x8FDDC248, 0x903EC198, 0x90A1C0E9, 0x9105C03A,
+    0x9169BF8C, 0x91CFBEDF, 0x9236BE32, 0x929EBD86, 0x9307BCDA, 0x9371BC2F,
+    0x93DCBB85, 0x9448BADC, 0x94B5BA33, 0x9523B98B, 0x9592B8E3, 0x9603B83C,
+    0x9674B796, 0x96E6B6F1, 0x9759B64C, 0x97CEB5A8, 0x9843B505, 0x98B9B462,
+    0x9930B3C0, 0x99A9B31F, 0x9A22B27F, 0x9A9CB1DF, 0x9B17B140, 0x9B94B0A2,
+    0x9C11B005, 0x9C8FAF68, 0x9D0EAECC, 0x9D8EAE31, 0x9E0FAD97, 0x9E91ACFD,
+    0x9F14AC65, 0x9F98ABCD, 0xA01CAB36, 0xA0A2AAA0, 0xA129AA0A, 0xA1B0A976,
+    0xA238A8E2, 0xA2C2A84F, 0xA34CA7BD, 0xA3D7A72C, 0xA463A69C, 0xA4F0A60C,
+    0xA57EA57E, 0xA60CA4F0, 0xA69CA463, 0xA72CA3D7, 0xA7BDA34C, 0xA84FA2C2,
+    0xA8E2A238, 0xA976A1B0, 0xAA0AA129, 0xAAA0A0A2, 0xAB36A01C, 0xABCD9F98,
+    0xAC659F14, 0xACFD9E91, 0xAD979E0F, 0xAE319D8E, 0xAECC9D0E, 0xAF689C8F,
+    0xB0059C11, 0xB0A29B94, 0xB1409B17, 0xB1DF9A9C, 0xB27F9A22, 0xB31F99A9,
+    0xB3C09930, 0xB46298B9, 0xB5059843, 0xB5A897CE, 0xB64C9759, 0xB6F196E6,
+    0xB7969674, 0xB83C9603, 0xB8E39592, 0xB98B9523, 0xBA3394B5, 0xBADC9448,
+    0xBB8593DC, 0xBC2F9371, 0xBCDA9307, 0xBD86929E, 0xBE329236, 0xBEDF91CF,
+    0xBF8C9169, 0xC03A9105, 0xC0E990A1, 0xC198903E, 0xC2488FDD, 0xC2F88F7D,
+    0xC3A98F1D, 0xC45B8EBF, 0xC50D8E62, 0xC5C08E06, 0xC6738DAB, 0xC7278D51,
+    0xC7DB8CF8, 0xC8908CA1, 0xC9468C4A, 0xC9FC8BF5, 0xCAB28BA0, 0xCB698B4D,
+    0xCC218AFB, 0xCCD98AAA, 0xCD928A5A, 0xCE4B8A0C, 0xCF0489BE, 0xCFBE8972,
+    0xD0798927, 0xD13488DD, 0xD1EF8894, 0xD2AB884C, 0xD3678805, 0xD42487C0,
+    0xD4E1877B, 0xD59E8738, 0xD65C86F6, 0xD71B86B6, 0xD7D98676, 0xD8988637,
+    0xD95885FA, 0xDA1885BE, 0xDAD88583, 0xDB998549, 0xDC598511, 0xDD1B84D9,
+    0xDDDC84A3, 0xDE9E846E, 0xDF61843A, 0xE0238407, 0xE0E683D6, 0xE1A983A6,
+    0xE26D8377, 0xE3308349, 0xE3F4831C, 0xE4B982F1, 0xE57D82C6, 0xE642829D,
+    0xE7078276, 0xE7CD824F, 0xE892822A, 0xE9588205, 0xEA1E81E2, 0xEAE481C1,
+    0xEBAB81A0, 0xEC718181, 0xED388163, 0xEDFF8146, 0xEEC6812A, 0xEF8D8110,
+    0xF05580F6, 0xF11C80DE, 0xF1E480C8, 0xF2AC80B2, 0xF374809E, 0xF43C808B,
+    0xF5058079, 0xF5CD8068, 0xF6958059, 0xF75E804B, 0xF827803E, 0xF8EF8032,
+    0xF9B88027, 0xFA81801E, 0xFB4A8016, 0xFC13800F, 0xFCDC800A, 0xFDA58006,
+    0xFE6E8002, 0xFF378001,
+};
+
+const float fft_window[NUM_SAMPLES] = {
+    0.000000000f, 0.000018825f, 0.000075298f, 0.000169418f, 0.000301181f,
+    0.000470582f, 0.000677615f, 0.000922272f, 0.001204544f, 0.001524419f,
+    0.001881887f, 0.002276933f, 0.002709543f, 0.003179701f, 0.003687388f,
+    0.004232586f, 0.004815273f, 0.005435429f, 0.006093030f, 0.006788051f,
+    0.007520465f, 0.008290246f, 0.009097365f, 0.009941790f, 0.010823490f,
+    0.011742432f, 0.012698582f, 0.013691903f, 0.014722358f, 0.015789908f,
+    0.016894513f, 0.018036131f, 0.019214720f, 0.020430234f, 0.021682629f,
+    0.022971857f, 0.024297870f, 0.025660617f, 0.027060048f, 0.028496109f,
+    0.029968747f, 0.031477906f, 0.033023529f, 0.034605558f, 0.036223934f,
+    0.037878596f, 0.039569481f, 0.041296525f, 0.043059664f, 0.044858832f,
+    0.046693960f, 0.048564979f, 0.050471819f, 0.052414409f, 0.054392675f,
+    0.056406542f, 0.058455935f, 0.060540776f, 0.062660988f, 0.064816490f,
+    0.067007201f, 0.069233039f, 0.071493920f, 0.073789758f, 0.076120467f,
+    0.078485961f, 0.080886148f, 0.083320940f, 0.085790244f, 0.088293968f,
+    0.090832017f, 0.093404295f, 0.096010707f, 0.098651153f, 0.101325534f,
+    0.104033750f, 0.106775699f, 0.109551277f, 0.112360380f, 0.115202902f,
+    0.118078736f, 0.120987774f, 0.123929906f, 0.126905022f, 0.129913009f,
+    0.132953754f, 0.136027144f, 0.139133061f, 0.142271390f, 0.145442012f,
+    0.148644807f, 0.151879655f, 0.155146435f, 0.158445023f, 0.161775294f,
+    0.165137125f, 0.168530388f, 0.171954955f, 0.175410697f, 0.178897485f,
+    0.182415187f, 0.185963670f, 0.189542802f, 0.193152446f, 0.196792469f,
+    0.200462731f, 0.204163095f, 0.207893423f, 0.211653572f, 0.215443403f,
+    0.219262771f, 0.223111534f, 0.226989547f, 0.230896662f, 0.234832734f,
+    0.238797615f, 0.242791153f, 0.246813201f, 0.250863605f, 0.254942215f,
+    0.259048875f, 0.263183431f, 0.267345728f, 0.271535610f, 0.275752917f,
+    0.279997492f, 0.284269175f, 0.288567804f, 0.292893219f, 0.297245256f,
+    0.301623751f, 0.306028539f, 0.310459455f, 0.314916332f, 0.319399002f,
+    0.323907296f, 0.328441045f, 0.333000078f, 0.337584222f, 0.342193307f,
+    0.346827157f, 0.351485599f, 0.356168457f, 0.360875555f, 0.365606716f,
+    0.370361761f, 0.375140512f, 0.379942788f, 0.384768409f, 0.389617194f,
+    0.394488959f, 0.399383521f, 0.404300696f, 0.409240298f, 0.414202143f,
+    0.419186042f, 0.424191809f, 0.429219254f, 0.434268189f, 0.439338424f,
+    0.444429767f, 0.449542027f, 0.454675012f, 0.459828527f, 0.465002380f,
+    0.470196375f, 0.475410317f, 0.480644010f, 0.485897256f, 0.491169857f,
+    0.496461616f, 0.501772333f, 0.507101808f, 0.512449840f, 0.517816228f,
+    0.523200770f, 0.528603263f, 0.534023504f, 0.539461289f, 0.544916413f,
+    0.550388670f, 0.555877855f, 0.561383761f, 0.566906181f, 0.572444907f,
+    0.577999729f, 0.583570440f, 0.589156829f, 0.594758686f, 0.600375800f,
+    0.606007960f, 0.611654953f, 0.617316568f, 0.622992590f, 0.628682806f,
+    0.634387002f, 0.640104963f, 0.645836475f, 0.651581320f, 0.657339283f,
+    0.663110147f, 0.668893694f, 0.674689708f, 0.680497969f, 0.686318260f,
+    0.692150360f, 0.697994051f, 0.703849112f, 0.709715323f, 0.715592463f,
+    0.721480311f, 0.727378645f, 0.733287243f, 0.739205882f, 0.745134340f,
+    0.751072394f, 0.757019820f, 0.762976394f, 0.768941892f, 0.774916089f,
+    0.780898760f, 0.786889680f, 0.792888624f, 0.798895365f, 0.804909678f,
+    0.810931336f, 0.816960112f, 0.822995780f, 0.829038111f, 0.835086880f,
+    0.841141857f, 0.847202815f, 0.853269526f, 0.859341761f, 0.865419291f,
+    0.871501889f, 0.877589325f, 0.883681369f, 0.889777793f, 0.895878366f,
+    0.901982860f, 0.908091044f, 0.914202688f, 0.920317562f, 0.926435436f,
+    0.932556080f, 0.938679264f, 0.944804756f, 0.950932326f, 0.957061743f,
+    0.963192777f, 0.969325197f, 0.975458771f, 0.981593270f, 0.987728462f,
+    0.993864115f, 1.000000000f, 1.006135885f, 1.012271538f, 1.018406730f,
+    1.024541229f, 1.030674803f, 1.036807223f, 1.042938257f, 1.049067674f,
+    1.055195244f, 1.061320736f, 1.067443920f, 1.073564564f, 1.079682438f,
+    1.085797312f, 1.091908956f, 1.098017140f, 1.104121634f, 1.110222207f,
+    1.116318631f, 1.122410675f, 1.128498111f, 1.134580709f, 1.140658239f,
+    1.146730474f, 1.152797185f, 1.158858143f, 1.164913120f, 1.170961889f,
+    1.177004220f, 1.183039888f, 1.189068664f, 1.195090322f, 1.201104635f,
+    1.207111376f, 1.213110320f, 1.219101240f, 1.225083911f, 1.231058108f,
+    1.237023606f, 1.242980180f, 1.248927606f, 1.254865660f, 1.260794118f,
+    1.266712757f, 1.272621355f, 1.278519689f, 1.284407537f, 1.290284677f,
+    1.296150888f, 1.302005949f, 1.307849640f, 1.313681740f, 1.319502031f,
+    1.325310292f, 1.331106306f, 1.336889853f, 1.342660717f, 1.348418680f,
+    1.354163525f, 1.359895037f, 1.365612998f, 1.371317194f, 1.377007410f,
+    1.382683432f, 1.388345047f, 1.393992040f, 1.399624200f, 1.405241314f,
+    1.410843171f, 1.416429560f, 1.422000271f, 1.427555093f, 1.433093819f,
+    1.438616239f, 1.444122145f, 1.449611330f, 1.455083587f, 1.460538711f,
+    1.465976496f, 1.471396737f, 1.476799230f, 1.482183772f, 1.487550160f,
+    1.492898192f, 1.498227667f, 1.503538384f, 1.508830143f, 1.514102744f,
+    1.519355990f, 1.524589683f, 1.529803625f, 1.534997620f, 1.540171473f,
+    1.545324988f, 1.550457973f, 1.555570233f, 1.560661576f, 1.565731811f,
+    1.570780746f, 1.575808191f, 1.580813958f, 1.585797857f, 1.590759702f,
+    1.595699304f, 1.600616479f, 1.605511041f, 1.610382806f, 1.615231591f,
+    1.620057212f, 1.624859488f, 1.629638239f, 1.634393284f, 1.639124445f,
+    1.643831543f, 1.648514401f, 1.653172843f, 1.657806693f, 1.662415778f,
+    1.666999922f, 1.671558955f, 1.676092704f, 1.680600998f, 1.685083668f,
+    1.689540545f, 1.693971461f, 1.698376249f, 1.702754744f, 1.707106781f,
+    1.711432196f, 1.715730825f, 1.720002508f, 1.724247083f, 1.728464390f,
+    1.732654272f, 1.736816569f, 1.740951125f, 1.745057785f, 1.749136395f,
+    1.753186799f, 1.757208847f, 1.761202385f, 1.765167266f, 1.769103338f,
+    1.773010453f, 1.776888466f, 1.780737229f, 1.784556597f, 1.788346428f,
+    1.792106577f, 1.795836905f, 1.799537269f, 1.803207531f, 1.806847554f,
+    1.810457198f, 1.814036330f, 1.817584813f, 1.821102515f, 1.824589303f,
+    1.828045045f, 1.831469612f, 1.834862875f, 1.838224706f, 1.841554977f,
+    1.844853565f, 1.848120345f, 1.851355193f, 1.854557988f, 1.857728610f,
+    1.860866939f, 1.863972856f, 1.867046246f, 1.870086991f, 1.873094978f,
+    1.876070094f, 1.879012226f, 1.881921264f, 1.884797098f, 1.887639620f,
+    1.890448723f, 1.893224301f, 1.895966250f, 1.898674466f, 1.901348847f,
+    1.903989293f, 1.906595705f, 1.909167983f, 1.911706032f, 1.914209756f,
+    1.916679060f, 1.919113852f, 1.921514039f, 1.923879533f, 1.926210242f,
+    1.928506080f, 1.930766961f, 1.932992799f, 1.935183510f, 1.937339012f,
+    1.939459224f, 1.941544065f, 1.943593458f, 1.945607325f, 1.947585591f,
+    1.949528181f, 1.951435021f, 1.953306040f, 1.955141168f, 1.956940336f,
+    1.958703475f, 1.960430519f, 1.962121404f, 1.963776066f, 1.965394442f,
+    1.966976471f, 1.968522094f, 1.970031253f, 1.971503891f, 1.972939952f,
+    1.974339383f, 1.975702130f, 1.977028143f, 1.978317371f, 1.979569766f,
+    1.980785280f, 1.981963869f, 1.983105487f, 1.984210092f, 1.985277642f,
+    1.986308097f, 1.987301418f, 1.988257568f, 1.989176510f, 1.990058210f,
+    1.990902635f, 1.991709754f, 1.992479535f, 1.993211949f, 1.993906970f,
+    1.994564571f, 1.995184727f, 1.995767414f, 1.996312612f, 1.996820299f,
+    1.997290457f, 1.997723067f, 1.998118113f, 1.998475581f, 1.998795456f,
+    1.999077728f, 1.999322385f, 1.999529418f, 1.999698819f, 1.999830582f,
+    1.999924702f, 1.999981175f, 2.000000000f, 1.999981175f, 1.999924702f,
+    1.999830582f, 1.999698819f, 1.999529418f, 1.999322385f, 1.999077728f,
+    1.998795456f, 1.998475581f, 1.998118113f, 1.997723067f, 1.997290457f,
+    1.996820299f, 1.996312612f, 1.995767414f, 1.995184727f, 1.994564571f,
+    1.993906970f, 1.993211949f, 1.992479535f, 1.991709754f, 1.990902635f,
+    1.990058210f, 1.989176510f, 1.988257568f, 1.987301418f, 1.986308097f,
+    1.985277642f, 1.984210092f, 1.983105487f, 1.981963869f, 1.980785280f,
+    1.979569766f, 1.978317371f, 1.977028143f, 1.975702130f, 1.974339383f,
+    1.972939952f, 1.971503891f, 1.970031253f, 1.968522094f, 1.966976471f,
+    1.965394442f, 1.963776066f, 1.962121404f, 1.960430519f, 1.958703475f,
+    1.956940336f, 1.955141168f, 1.953306040f, 1.951435021f, 1.949528181f,
+    1.947585591f, 1.945607325f, 1.943593458f, 1.941544065f, 1.939459224f,
+    1.937339012f, 1.935183510f, 1.932992799f, 1.930766961f, 1.928506080f,
+    1.926210242f, 1.923879533f, 1.921514039f, 1.919113852f, 1.916679060f,
+    1.914209756f, 1.911706032f, 1.909167983f, 1.906595705f, 1.903989293f,
+    1.901348847f, 1.898674466f, 1.895966250f, 1.893224301f, 1.890448723f,
+    1.887639620f, 1.884797098f, 1.881921264f, 1.879012226f, 1.876070094f,
+    1.873094978f, 1.870086991f, 1.867046246f, 1.863972856f, 1.860866939f,
+    1.857728610f, 1.854557988f, 1.851355193f, 1.848120345f, 1.844853565f,
+    1.841554977f, 1.838224706f, 1.834862875f, 1.831469612f, 1.828045045f,
+    1.824589303f, 1.821102515f, 1.817584813f, 1.814036330f, 1.810457198f,
+    1.806847554f, 1.803207531f, 1.799537269f, 1.795836905f, 1.792106577f,
+    1.788346428f, 1.784556597f, 1.780737229f, 1.776888466f, 1.773010453f,
+    1.769103338f, 1.765167266f, 1.761202385f, 1.757208847f, 1.753186799f,
+    1.749136395f, 1.745057785f, 1.740951125f, 1.736816569f, 1.732654272f,
+    1.728464390f, 1.724247083f, 1.720002508f, 1.715730825f, 1.711432196f,
+    1.707106781f, 1.702754744f, 1.698376249f, 1.693971461f, 1.689540545f,
+    1.685083668f, 1.680600998f, 1.676092704f, 1.671558955f, 1.666999922f,
+    1.662415778f, 1.657806693f, 1.653172843f, 1.648514401f, 1.643831543f,
+    1.639124445f, 1.634393284f, 1.629638239f, 1.624859488f, 1.620057212f,
+    1.615231591f, 1.610382806f, 1.605511041f, 1.600616479f, 1.595699304f,
+    1.590759702f, 1.585797857f, 1.580813958f, 1.575808191f, 1.570780746f,
+    1.565731811f, 1.560661576f, 1.555570233f, 1.550457973f, 1.545324988f,
+    1.540171473f, 1.534997620f, 1.529803625f, 1.524589683f, 1.519355990f,
+    1.514102744f, 1.508830143f, 1.503538384f, 1.498227667f, 1.492898192f,
+    1.487550160f, 1.482183772f, 1.476799230f, 1.471396737f, 1.465976496f,
+    1.460538711f, 1.455083587f, 1.449611330f, 1.444122145f, 1.438616239f,
+    1.433093819f, 1.427555093f, 1.422000271f, 1.416429560f, 1.410843171f,
+    1.405241314f, 1.399624200f, 1.393992040f, 1.388345047f, 1.382683432f,
+    1.377007410f, 1.371317194f, 1.365612998f, 1.359895037f, 1.354163525f,
+    1.348418680f, 1.342660717f, 1.336889853f, 1.331106306f, 1.325310292f,
+    1.319502031f, 1.313681740f, 1.307849640f, 1.302005949f, 1.296150888f,
+    1.290284677f, 1.284407537f, 1.278519689f, 1.272621355f, 1.266712757f,
+    1.260794118f, 1.254865660f, 1.248927606f, 1.242980180f, 1.237023606f,
+    1.231058108f, 1.225083911f, 1.219101240f, 1.213110320f, 1.207111376f,
+    1.201104635f, 1.195090322f, 1.189068664f, 1.183039888f, 1.177004220f,
+    1.170961889f, 1.164913120f, 1.158858143f, 1.152797185f, 1.146730474f,
+    1.140658239f, 1.134580709f, 1.128498111f, 1.122410675f, 1.116318631f,
+    1.110222207f, 1.104121634f, 1.098017140f, 1.091908956f, 1.085797312f,
+    1.079682438f, 1.073564564f, 1.067443920f, 1.061320736f, 1.055195244f,
+    1.049067674f, 1.042938257f, 1.036807223f, 1.030674803f, 1.024541229f,
+    1.018406730f, 1.012271538f, 1.006135885f, 1.000000000f, 0.993864115f,
+    0.987728462f, 0.981593270f, 0.975458771f, 0.969325197f, 0.963192777f,
+    0.957061743f, 0.950932326f, 0.944804756f, 0.938679264f, 0.932556080f,
+    0.926435436f, 0.920317562f, 0.914202688f, 0.908091044f, 0.901982860f,
+    0.895878366f, 0.889777793f, 0.883681369f, 0.877589325f, 0.871501889f,
+    0.865419291f, 0.859341761f, 0.853269526f, 0.847202815f, 0.841141857f,
+    0.835086880f, 0.829038111f, 0.822995780f, 0.816960112f, 0.810931336f,
+    0.804909678f, 0.798895365f, 0.792888624f, 0.786889680f, 0.780898760f,
+    0.774916089f, 0.768941892f, 0.762976394f, 0.757019820f, 0.751072394f,
+    0.745134340f, 0.739205882f, 0.733287243f, 0.727378645f, 0.721480311f,
+    0.715592463f, 0.709715323f, 0.703849112f, 0.697994051f, 0.692150360f,
+    0.686318260f, 0.680497969f, 0.674689708f, 0.668893694f, 0.663110147f,
+    0.657339283f, 0.651581320f, 0.645836475f, 0.640104963f, 0.634387002f,
+    0.628682806f, 0.622992590f, 0.617316568f, 0.611654953f, 0.606007960f,
+    0.600375800f, 0.594758686f, 0.589156829f, 0.583570440f, 0.577999729f,
+    0.572444907f, 0.566906181f, 0.561383761f, 0.555877855f, 0.550388670f,
+    0.544916413f, 0.539461289f, 0.534023504f, 0.528603263f, 0.523200770f,
+    0.517816228f, 0.512449840f, 0.507101808f, 0.501772333f, 0.496461616f,
+    0.491169857f, 0.485897256f, 0.480644010f, 0.475410317f, 0.470196375f,
+    0.465002380f, 0.459828527f, 0.454675012f, 0.449542027f, 0.444429767f,
+    0.439338424f, 0.434268189f, 0.429219254f, 0.424191809f, 0.419186042f,
+    0.414202143f, 0.409240298f, 0.404300696f, 0.399383521f, 0.394488959f,
+    0.389617194f, 0.384768409f, 0.379942788f, 0.375140512f, 0.370361761f,
+    0.365606716f, 0.360875555f, 0.356168457f, 0.351485599f, 0.346827157f,
+    0.342193307f, 0.337584222f, 0.333000078f, 0.328441045f, 0.323907296f,
+    0.319399002f, 0.314916332f, 0.310459455f, 0.306028539f, 0.301623751f,
+    0.297245256f, 0.292893219f, 0.288567804f, 0.284269175f, 0.279997492f,
+    0.275752917f, 0.271535610f, 0.267345728f, 0.263183431f, 0.259048875f,
+    0.254942215f, 0.250863605f, 0.246813201f, 0.242791153f, 0.238797615f,
+    0.234832734f, 0.230896662f, 0.226989547f, 0.223111534f, 0.219262771f,
+    0.215443403f, 0.211653572f, 0.207893423f, 0.204163095f, 0.200462731f,
+    0.196792469f, 0.193152446f, 0.189542802f, 0.185963670f, 0.182415187f,
+    0.178897485f, 0.175410697f, 0.171954955f, 0.168530388f, 0.165137125f,
+    0.161775294f, 0.158445023f, 0.155146435f, 0.151879655f, 0.148644807f,
+    0.145442012f, 0.142271390f, 0.139133061f, 0.136027144f, 0.132953754f,
+    0.129913009f, 0.126905022f, 0.123929906f, 0.120987774f, 0.118078736f,
+    0.115202902f, 0.112360380f, 0.109551277f, 0.106775699f, 0.104033750f,
+    0.101325534f, 0.098651153f, 0.096010707f, 0.093404295f, 0.090832017f,
+    0.088293968f, 0.085790244f, 0.083320940f, 0.080886148f, 0.078485961f,
+    0.076120467f, 0.073789758f, 0.071493920f, 0.069233039f, 0.067007201f,
+    0.064816490f, 0.062660988f, 0.060540776f, 0.058455935f, 0.056406542f,
+    0.054392675f, 0.052414409f, 0.050471819f, 0.048564979f, 0.046693960f,
+    0.044858832f, 0.043059664f, 0.041296525f, 0.039569481f, 0.037878596f,
+    0.036223934f, 0.034605558f, 0.033023529f, 0.031477906f, 0.029968747f,
+    0.028496109f, 0.027060048f, 0.025660617f, 0.024297870f, 0.022971857f,
+    0.021682629f, 0.020430234f, 0.019214720f, 0.018036131f, 0.016894513f,
+    0.015789908f, 0.014722358f, 0.013691903f, 0.012698582f, 0.011742432f,
+    0.010823490f, 0.009941790f, 0.009097365f, 0.008290246f, 0.007520465f,
+    0.006788051f, 0.006093030f, 0.005435429f, 0.004815273f, 0.004232586f,
+    0.003687388f, 0.003179701f, 0.002709543f, 0.002276933f, 0.001881887f,
+    0.001524419f, 0.001204544f, 0.000922272f, 0.000677615f, 0.000470582f,
+    0.000301181f, 0.000169418f, 0.000075298f, 0.000018825f,
+};
+
+const uint16_t fft_bit_reverse[NUM_SAMPLES] = {
+       0,  512,  256,  768,  128,  640,  384,  896,   64,  576,  320,  832,
+     192,  704,  448,  960,   32,  544,  288,  800,  160,  672,  416,  928,
+      96,  608,  352,  864,  224,  736,  480,  992,   16,  528,  272,  784,
+     144,  656,  400,  912,   80,  592,  336,  848,  208,  720,  464,  976,
+      48,  560,  304,  816,  176,  688,  432,  944,  112,  624,  368,  880,
+     240,  752,  496, 1008,    8,  520,  264,  776,  136,  648,  392,  904,
+      72,  584,  328,  840,  200,  712,  456,  968,   40,  552,  296,  808,
+     168,  680,  424,  936,  104,  616,  360,  872,  232,  744,  488, 1000,
+      24,  536,  280,  792,  152,  664,  408,  920,   88,  600,  344,  856,
+     216,  728,  472,  984,   56,  568,  312,  824,  184,  696,  440,  952,
+     120,  632,  376,  888,  248,  760,  504, 1016,    4,  516,  260,  772,
+     132,  644,  388,  900,   68,  580,  324,  836,  196,  708,  452,  964,
+      36,  548,  292,  804,  164,  676,  420,  932,  100,  612,  356,  868,
+     228,  740,  484,  996,   20,  532,  276,  788,  148,  660,  404,  916,
+      84,  596,  340,  852,  212,  724,  468,  980,   52,  564,  308,  820,
+     180,  692,  436,  948,  116,  628,  372,  884,  244,  756,  500, 1012,
+      12,  524,  268,  780,  140,  652,  396,  908,   76,  588,  332,  844,
+     204,  716,  460,  972,   44,  556,  300,  812,  172,  684,  428,  940,
+     108,  620,  364,  876,  236,  748,  492, 1004,   28,  540,  284,  796,
+     156,  668,  412,  924,   92,  604,  348,  860,  220,  732,  476,  988,
+      60,  572,  316,  828,  188,  700,  444,  956,  124,  636,  380,  892,
+     252,  764,  508, 1020,    2,  514,  258,  770,  130,  642,  386,  898,
+      66,  578,  322,  834,  194,  706,  450,  962,   34,  546,  290,  802,
+     162,  674,  418,  930,   98,  610,  354,  866,  226,  738,  482,  994,
+      18,  530,  274,  786,  146,  658,  402,  914,   82,  594,  338,  850,
+     210,  722,  466,  978,   50,  562,  306,  818,  178,  690,  434,  946,
+     114,  626,  370,  882,  242,  754,  498, 1010,   10,  522,  266,  778,
+     138,  650,  394,  906,   74,  586,  330,  842,  202,  714,  458,  970,
+      42,  554,  298,  810,  170,  682,  426,  938,  106,  618,  362,  874,
+     234,  746,  490, 1002,   26,  538,  282,  794,  154,  666,  410,  922,
+      90,  602,  346,  858,  218,  730,  474,  986,   58,  570,  314,  826,
+     186,  698,  442,  954,  122,  634,  378,  890,  250,  762,  506, 1018,
+       6,  518,  262,  774,  134,  646,  390,  902,   70,  582,  326,  838,
+     198,  710,  454,  966,   38,  550,  294,  806,  166,  678,  422,  934,
+     102,  614,  358,  870,  230,  742,  486,  998,   22,  534,  278,  790,
+     150,  662,  406,  918,   86,  598,  342,  854,  214,  726,  470,  982,
+      54,  566,  310,  822,  182,  694,  438,  950,  118,  630,  374,  886,
+     246,  758,  502, 1014,   14,  526,  270,  782,  142,  654,  398,  910,
+      78,  590,  334,  846,  206,  718,  462,  974,   46,  558,  302,  814,
+     174,  686,  430,  942,  110,  622,  366,  878,  238,  750,  494, 1006,
+      30,  542,  286,  798,  158,  670,  414,  926,   94,  606,  350,  862,
+     222,  734,  478,  990,   62,  574,  318,  830,  190,  702,  446,  958,
+     126,  638,  382,  894,  254,  766,  510, 1022,    1,  513,  257,  769,
+     129,  641,  385,  897,   65,  577,  321,  833,  193,  705,  449,  961,
+      33,  545,  289,  801,  161,  673,  417,  929,   97,  609,  353,  865,
+     225,  737,  481,  993,   17,  529,  273,  785,  145,  657,  401,  913,
+      81,  593,  337,  849,  209,  721,  465,  977,   49,  561,  305,  817,
+     177,  689,  433,  945,  113,  625,  369,  881,  241,  753,  497, 1009,
+       9,  521,  265,  777,  137,  649,  393,  905,   73,  585,  329,  841,
+     201,  713,  457,  969,   41,  553,  297,  809,  169,  681,  425,  937,
+     105,  617,  361,  873,  233,  745,  489, 1001,   25,  537,  281,  793,
+     153,  665,  409,  921,   89,  601,  345,  857,  217,  729,  473,  985,
+      57,  569,  313,  825,  185,  697,  441,  953,  121,  633,  377,  889,
+     249,  761,  505, 1017,    5,  517,  261,  773,  133,  645,  389,  901,
+      69,  581,  325,  837,  197,  709,  453,  965,   37,  549,  293,  805,
+     165,  677,  421,  933,  101,  613,  357,  869,  229,  741,  485,  997,
+      21,  533,  277,  789,  149,  661,  405,  917,   85,  597,  341,  853,
+     213,  725,  469,  981,   53,  565,  309,  821,  181,  693,  437,  949,
+     117,  629,  373,  885,  245,  757,  501, 1013,   13,  525,  269,  781,
+     141,  653,  397,  909,   77,  589,  333,  845,  205,  717,  461,  973,
+      45,  557,  301,  813,  173,  685,  429,  941,  109,  621,  365,  877,
+     237,  749,  493, 1005,   29,  541,  285,  797,  157,  669,  413,  925,
+      93,  605,  349,  861,  221,  733,  477,  989,   61,  573,  317,  829,
+     189,  701,  445,  957,  125,  637,  381,  893,  253,  765,  509, 1021,
+       3,  515,  259,  771,  131,  643,  387,  899,   67,  579,  323,  835,
+     195,  707,  451,  963,   35,  547,  291,  803,  163,  675,  419,  931,
+      99,  611,  355,  867,  227,  739,  483,  995,   19,  531,  275,  787,
+     147,  659,  403,  915,   83,  595,  339,  851,  211,  723,  467,  979,
+      51,  563,  307,  819,  179,  691,  435,  947,  115,  627,  371,  883,
+     243,  755,  499, 1011,   11,  523,  267,  779,  139,  651,  395,  907,
+      75,  587,  331,  843,  203,  715,  459,  971,   43,  555,  299,  811,
+     171,  683,  427,  939,  107,  619,  363,  875,  235,  747,  491, 1003,
+      27,  539,  283,  795,  155,  667,  411,  923,   91,  603,  347,  859,
+     219,  731,  475,  987,   59,  571,  315,  827,  187,  699,  443,  955,
+     123,  635,  379,  891,  251,  763,  507, 1019,    7,  519,  263,  775,
+     135,  647,  391,  903,   71,  583,  327,  839,  199,  711,  455,  967,
+      39,  551,  295,  807,  167,  679,  423,  935,  103,  615,  359,  871,
+     231,  743,  487,  999,   23,  535,  279,  791,  151,  663,  407,  919,
+      87,  599,  343,  855,  215,  727,  471,  983,   55,  567,  311,  823,
+     183,  695,  439,  951,  119,  631,  375,  887,  247,  759,  503, 1015,
+      15,  527,  271,  783,  143,  655,  399,  911,   79,  591,  335,  847,
+     207,  719,  463,  975,   47,  559,  303,  815,  175,  687,  431,  943,
+     111,  623,  367,  879,  239,  751,  495, 1007,   31,  543,  287,  799,
+     159,  671,  415,  927,   95,  607,  351,  863,  223,  735,  479,  991,
+      63,  575,  319,  831,  191,  703,  447,  959,  127,  639,  383,  895,
+     255,  767,  511, 1023,
+};
+
+#elif NUM_SAMPLES == 2048
+
+const float fft_twiddles[3*NUM_SAMPLES/4][2] = {
+    { 1.000000000f, -0.000000000f },
+    { 0.999995294f, -0.003067957f },
+    { 0.999981175f, -0.006135885f },
+    { 0.999957645f, -0.009203755f },
+    { 0.999924702f, -0.012271538f },
+    { 0.999882347f, -0.015339206f },
+    { 0.999830582f, -0.018406730f },
+    { 0.999769405f, -0.021474080f },
+    { 0.999698819f, -0.024541229f },
+    { 0.999618822f, -0.027608146f },
+    { 0.999529418f, -0.030674803f },
+    { 0.999430605f, -0.033741172f },
+    { 0.999322385f, -0.036807223f },
+    { 0.999204759f, -0.039872928f },
+    { 0.999077728f, -0.042938257f },
+    { 0.998941293f, -0.046003182f },
+    { 0.998795456f, -0.049067674f },
+    { 0.998640218f, -0.052131705f },
+    { 0.998475581f, -0.055195244f },
+    { 0.998301545f, -0.058258265f },
+    { 0.998118113f, -0.061320736f },
+    { 0.997925286f, -0.064382631f },
+    { 0.997723067f, -0.067443920f },
+    { 0.997511456f, -0.070504573f },
+    { 0.997290457f, -0.073564564f },
+    { 0.997060070f, -0.076623861f },
+    { 0.996820299f, -0.079682438f },
+    { 0.996571146f, -0.082740265f },
+    { 0.996312612f, -0.085797312f },
+    { 0.996044701f, -0.088853553f },
+    { 0.995767414f, -0.091908956f },
+    { 0.995480755f, -0.094963495f },
+    { 0.995184727f, -0.098017140f },
+    { 0.994879331f, -0.101069863f },
+    { 0.994564571f, -0.104121634f },
+    { 0.994240449f, -0.107172425f },
+    { 0.993906970f, -0.110222207f },
+    { 0.993564136f, -0.113270952f },
+    { 0.993211949f, -0.116318631f },
+    { 0.992850414f, -0.119365215f },
+    { 0.992479535f, -0.122410675f },
+    { 0.992099313f, -0.125454983f },
+    { 0.991709754f, -0.128498111f },
+    { 0.991310860f, -0.131540029f },
+    { 0.990902635f, -0.134580709f },
+    { 0.990485084f, -0.137620122f },
+    { 0.990058210f, -0.140658239f },
+    { 0.989622017f, -0.143695033f },
+    { 0.989176510f, -0.146730474f },
+    { 0.988721692f, -0.149764535f },
+    { 0.988257568f, -0.152797185f },
+    { 0.987784142f, -0.155828398f },
+    { 0.987301418f, -0.158858143f },
+    { 0.986809402f, -0.161886394f },
+    { 0.986308097f, -0.164913120f },
+    { 0.985797509f, -0.167938295f },
+    { 0.985277642f, -0.170961889f },
+    { 0.984748502f, -0.173983873f },
+    { 0.984210092f, -0.177004220f },
+    { 0.983662419f, -0.180022901f },
+    { 0.983105487f, -0.183039888f },
+    { 0.982539302f, -0.186055152f },
+    { 0.981963869f, -0.189068664f },
+    { 0.981379193f, -0.192080397f },
+    { 0.980785280f, -0.195090322f },
+    { 0.980182136f, -0.198098411f },
+    { 0.979569766f, -0.201104635f },
+    { 0.978948175f, -0.204108966f },
+    { 0.978317371f, -0.207111376f },
+    { 0.977677358f, -0.210111837f },
+    { 0.977028143f, -0.213110320f },
+    { 0.976369731f, -0.216106797f },
+    { 0.975702130f, -0.219101240f },
+    { 0.975025345f, -0.222093621f },
+    { 0.974339383f, -0.225083911f },
+    { 0.973644250f, -0.228072083f },
+    { 0.972939952f, -0.231058108f },
+    { 0.972226497f, -0.234041959f },
+    { 0.971503891f, -0.237023606f },
+    { 0.970772141f, -0.240003022f },
+    { 0.970031253f, -0.242980180f },
+    { 0.969281235f, -0.245955050f },
+    { 0.968522094f, -0.248927606f },
+    { 0.967753837f, -0.251897818f },
+    { 0.966976471f, -0.254865660f },
+    { 0.966190003f, -0.257831102f },
+    { 0.965394442f, -0.260794118f },
+    { 0.964589793f, -0.263754679f },
+    { 0.963776066f, -0.266712757f },
+    { 0.962953267f, -0.269668326f },
+    { 0.962121404f, -0.272621355f },
+    { 0.961280486f, -0.275571819f },
+    { 0.960430519f, -0.278519689f },
+    { 0.959571513f, -0.281464938f },
+    { 0.958703475f, -0.284407537f },
+    { 0.957826413f, -0.287347460f },
+    { 0.956940336f, -0.290284677f },
+    { 0.956045251f, -0.293219163f },
+    { 0.955141168f, -0.296150888f },
+    { 0.954228095f, -0.299079826f },
+    { 0.953306040f, -0.302005949f },
+    { 0.952375013f, -0.304929230f },
+    { 0.951435021f, -0.307849640f },
+    { 0.950486074f, -0.310767153f },
+    { 0.949528181f, -0.313681740f },
+    { 0.948561350f, -0.316593376f },
+    { 0.947585591f, -0.319502031f },
+    { 0.946600913f, -0.322407679f },
+    { 0.945607325f, -0.325310292f },
+    { 0.944604837f, -0.328209844f },
+    { 0.943593458f, -0.331106306f },
+    { 0.942573198f, -0.333999651f },
+    { 0.941544065f, -0.336889853f },
+    { 0.940506071f, -0.339776884f },
+    { 0.939459224f, -0.342660717f },
+    { 0.938403534f, -0.345541325f },
+    { 0.937339012f, -0.348418680f },
+    { 0.936265667f, -0.351292756f },
+    { 0.935183510f, -0.354163525f },
+    { 0.934092550f, -0.357030961f },
+    { 0.932992799f, -0.359895037f },
+    { 0.931884266f, -0.362755724f },
+    { 0.930766961f, -0.365612998f },
+    { 0.929640896f, -0.368466830f },
+    { 0.928506080f, -0.371317194f },
+    { 0.927362526f, -0.374164063f },
+    { 0.926210242f, -0.377007410f },
+    { 0.925049241f, -0.379847209f },
+    { 0.923879533f, -0.382683432f },
+    { 0.922701128f, -0.385516054f },
+    { 0.921514039f, -0.388345047f },
+    { 0.920318277f, -0.391170384f },
+    { 0.919113852f, -0.393992040f },
+    { 0.917900776f, -0.396809987f },
+    { 0.916679060f, -0.399624200f },
+    { 0.915448716f, -0.402434651f },
+    { 0.914209756f, -0.405241314f },
+    { 0.912962190f, -0.408044163f },
+    { 0.911706032f, -0.410843171f },
+    { 0.910441292f, -0.413638312f },
+    { 0.909167983f, -0.416429560f },
+    { 0.907886116f, -0.419216888f },
+    { 0.906595705f, -0.422000271f },
+    { 0.905296759f, -0.424779681f },
+    { 0.903989293f, -0.427555093f },
+    { 0.902673318f, -0.430326481f },
+    { 0.901348847f, -0.433093819f },
+    { 0.900015892f, -0.435857080f },
+    { 0.898674466f, -0.438616239f },
+    { 0.897324581f, -0.441371269f },
+    { 0.895966250f, -0.444122145f },
+    { 0.894599486f, -0.446868840f },
+    { 0.893224301f, -0.449611330f },
+    { 0.891840709f, -0.452349587f },
+    { 0.890448723f, -0.455083587f },
+    { 0.889048356f, -0.457813304f },
+    { 0.887639620f, -0.460538711f },
+    { 0.886222530f, -0.463259784f },
+    { 0.884797098f, -0.465976496f },
+    { 0.883363339f, -0.468688822f },
+    { 0.881921264f, -0.471396737f },
+    { 0.880470889f, -0.474100215f },
+    { 0.879012226f, -0.476799230f },
+    { 0.877545290f, -0.479493758f },
+    { 0.876070094f, -0.482183772f },
+    { 0.874586652f, -0.484869248f },
+    { 0.873094978f, -0.487550160f },
+    { 0.871595087f, -0.490226483f },
+    { 0.870086991f, -0.492898192f },
+    { 0.868570706f, -0.495565262f },
+    { 0.867046246f, -0.498227667f },
+    { 0.865513624f, -0.500885383f },
+    { 0.863972856f, -0.503538384f },
+    { 0.862423956f, -0.506186645f },
+    { 0.860866939f, -0.508830143f },
+    { 0.859301818f, -0.511468850f },
+    { 0.857728610f, -0.514102744f },
+    { 0.856147328f, -0.516731799f },
+    { 0.854557988f, -0.519355990f },
+    { 0.852960605f, -0.521975293f },
+    { 0.851355193f, -0.524589683f },
+    { 0.849741768f, -0.527199135f },
+    { 0.848120345f, -0.529803625f },
+    { 0.846490939f, -0.532403128f },
+    { 0.844853565f, -0.534997620f },
+    { 0.843208240f, -0.537587076f },
+    { 0.841554977f, -0.540171473f },
+    { 0.839893794f, -0.542750785f },
+    { 0.838224706f, -0.545324988f },
+    { 0.836547727f, -0.547894059f },
+    { 0.834862875f, -0.550457973f },
+    { 0.833170165f, -0.553016706f },
+    { 0.831469612f, -0.555570233f },
+    { 0.829761234f, -0.558118531f },
+    { 0.828045045f, -0.560661576f },
+    { 0.826321063f, -0.563199344f },
+    { 0.824589303f, -0.565731811f },
+    { 0.822849781f, -0.568258953f },
+    { 0.821102515f, -0.570780746f },
+    { 0.819347520f, -0.573297167f },
+    { 0.817584813f, -0.575808191f },
+    { 0.815814411f, -0.578313796f },
+    { 0.814036330f, -0.580813958f },
+    { 0.812250587f, -0.583308653f },
+    { 0.810457198f, -0.585797857f },
+    { 0.808656182f, -0.588281548f },
+    { 0.806847554f, -0.590759702f },
+    { 0.805031331f, -0.593232295f },
+    { 0.803207531f, -0.595699304f },
+    { 0.801376172f, -0.598160707f },
+    { 0.799537269f, -0.600616479f },
+    { 0.797690841f, -0.603066599f },
+    { 0.795836905f, -0.605511041f },
+    { 0.793975478f, -0.607949785f },
+    { 0.792106577f, -0.610382806f },
+    { 0.790230221f, -0.612810082f },
+    { 0.788346428f, -0.615231591f },
+    { 0.786455214f, -0.617647308f },
+    { 0.784556597f, -0.620057212f },
+    { 0.782650596f, -0.622461279f },
+    { 0.780737229f, -0.624859488f },
+    { 0.778816512f, -0.627251815f },
+    { 0.776888466f, -0.629638239f },
+    { 0.774953107f, -0.632018736f },
+    { 0.773010453f, -0.634393284f },
+    { 0.771060524f, -0.636761861f },
+    { 0.769103338f, -0.639124445f },
+    { 0.767138912f, -0.641481013f },
+    { 0.765167266f, -0.643831543f },
+    { 0.763188417f, -0.646176013f },
+    { 0.761202385f, -0.648514401f },
+    { 0.759209189f, -0.650846685f },
+    { 0.757208847f, -0.653172843f },
+    { 0.755201377f, -0.655492853f },
+    { 0.753186799f, -0.657806693f },
+    { 0.751165132f, -0.660114342f },
+    { 0.749136395f, -0.662415778f },
+    { 0.747100606f, -0.664710978f },
+    { 0.745057785f, -0.666999922f },
+    { 0.743007952f, -0.669282588f },
+    { 0.740951125f, -0.671558955f },
+    { 0.738887324f, -0.673829000f },
+    { 0.736816569f, -0.676092704f },
+    { 0.734738878f, -0.678350043f },
+    { 0.732654272f, -0.680600998f },
+    { 0.730562769f, -0.682845546f },
+    { 0.728464390f, -0.685083668f },
+    { 0.726359155f, -0.687315341f },
+    { 0.724247083f, -0.689540545f },
+    { 0.722128194f, -0.691759258f },
+    { 0.720002508f, -0.693971461f },
+    { 0.717870045f, -0.696177131f },
+    { 0.715730825f, -0.698376249f },
+    { 0.713584869f, -0.700568794f },
+    { 0.711432196f, -0.702754744f },
+    { 0.709272826f, -0.704934080f },
+    { 0.707106781f, -0.707106781f },
+    { 0.704934080f, -0.709272826f },
+    { 0.702754744f, -0.711432196f },
+    { 0.700568794f, -0.713584869f },
+    { 0.698376249f, -0.715730825f },
+    { 0.696177131f, -0.717870045f },
+    { 0.693971461f, -0.720002508f },
+    { 0.691759258f, -0.722128194f },
+    { 0.689540545f, -0.724247083f },
+    { 0.687315341f, -0.726359155f },
+    { 0.685083668f, -0.728464390f },
+    { 0.682845546f, -0.730562769f },
+    { 0.680600998f, -0.732654272f },
+    { 0.678350043f, -0.734738878f },
+    { 0.676092704f, -0.736816569f },
+    { 0.673829000f, -0.738887324f },
+    { 0.671558955f, -0.740951125f },
+    { 0.669282588f, -0.743007952f },
+    { 0.666999922f, -0.745057785f },
+    { 0.664710978f, -0.747100606f },
+    { 0.662415778f, -0.749136395f },
+    { 0.660114342f, -0.751165132f },
+    { 0.657806693f, -0.753186799f },
+    { 0.655492853f, -0.755201377f },
+    { 0.653172843f, -0.757208847f },
+    { 0.650846685f, -0.759209189f },
+    { 0.648514401f, -0.761202385f },
+    { 0.646176013f, -0.763188417f },
+    { 0.643831543f, -0.765167266f },
+    { 0.641481013f, -0.767138912f },
+    { 0.639124445f, -0.769103338f },
+    { 0.636761861f, -0.771060524f },
+    { 0.634393284f, -0.773010453f },
+    { 0.632018736f, -0.774953107f },
+    { 0.629638239f, -0.776888466f },
+    { 0.627251815f, -0.778816512f },
+    { 0.624859488f, -0.780737229f },
+    { 0.622461279f, -0.782650596f },
+    { 0.620057212f, -0.784556597f },
+    { 0.617647308f, -0.786455214f },
+    { 0.615231591f, -0.788346428f },
+    { 0.612810082f, -0.790230221f },
+    { 0.610382806f, -0.792106577f },
+    { 0.607949785f, -0.793975478f },
+    { 0.605511041f, -0.795836905f },
+    { 0.603066599f, -0.797690841f },
+    { 0.600616479f, -0.799537269f },
+    { 0.598160707f, -0.801376172f },
+    { 0.595699304f, -0.803207531f },
+    { 0.593232295f, -0.805031331f },
+    { 0.590759702f, -0.806847554f },
+    { 0.588281548f, -0.808656182f },
+    { 0.585797857f, -0.810457198f },
+    { 0.583308653f, -0.812250587f },
+    { 0.580813958f, -0.814036330f },
+    { 0.578313796f, -0.815814411f },
+    { 0.575808191f, -0.817584813f },
+    { 0.573297167f, -0.819347520f },
+    { 0.570780746f, -0.821102515f },
+    { 0.568258953f, -0.822849781f },
+    { 0.565731811f, -0.824589303f },
+    { 0.563199344f, -0.826321063f },
+    { 0.560661576f, -0.828045045f },
+    { 0.558118531f, -0.829761234f },
+    { 0.555570233f, -0.831469612f },
+    { 0.553016706f, -0.833170165f },
+    { 0.550457973f, -0.834862875f },
+    { 0.547894059f, -0.836547727f },
+    { 0.545324988f, -0.838224706f },
+    { 0.542750785f, -0.839893794f },
+    { 0.540171473f, -0.841554977f },
+    { 0.537587076f, -0.843208240f },
+    { 0.534997620f, -0.844853565f },
+    { 0.532403128f, -0.846490939f },
+    { 0.529803625f, -0.848120345f },
+    { 0.527199135f, -0.849741768f },
+    { 0.524589683f, -0.851355193f },
+    { 0.521975293f, -0.852960605f },
+    { 0.519355990f, -0.854557988f },
+    { 0.516731799f, -0.856147328f },
+    { 0.514102744f, -0.857728610f },
+    { 0.511468850f, -0.859301818f },
+    { 0.508830143f, -0.860866939f },
+    { 0.506186645f, -0.862423956f },
+    { 0.503538384f, -0.863972856f },
+    { 0.500885383f, -0.865513624f },
+    { 0.498227667f, -0.867046246f },
+    { 0.495565262f, -0.868570706f },
+    { 0.492898192f, -0.870086991f },
+    { 0.490226483f, -0.871595087f },
+    { 0.487550160f, -0.873094978f },
+    { 0.484869248f, -0.874586652f },
+    { 0.482183772f, -0.876070094f },
+    { 0.479493758f, -0.877545290f },
+    { 0.476799230f, -0.879012226f },
+    { 0.474100215f, -0.880470889f },
+    { 0.471396737f, -0.881921264f },
+    { 0.468688822f, -0.883363339f },
+    { 0.465976496f, -0.884797098f },
+    { 0.463259784f, -0.886222530f },
+    { 0.460538711f, -0.887639620f },
+    { 0.457813304f, -0.889048356f },
+    { 0.455083587f, -0.890448723f },
+    { 0.452349587f, -0.891840709f },
+    { 0.449611330f, -0.893224301f },
+    { 0.446868840f, -0.894599486f },
+    { 0.444122145f, -0.895966250f },
+    { 0.441371269f, -0.897324581f },
+    { 0.438616239f, -0.898674466f },
+    { 0.435857080f, -0.900015892f },
+    { 0.433093819f, -0.901348847f },
+    { 0.430326481f, -0.902673318f },
+    { 0.427555093f, -0.903989293f },
+    { 0.424779681f, -0.905296759f },
+    { 0.422000271f, -0.906595705f },
+    { 0.419216888f, -0.907886116f },
+    { 0.416429560f, -0.909167983f },
+    { 0.413638312f, -0.910441292f },
+    { 0.410843171f, -0.911706032f },
+    { 0.408044163f, -0.912962190f },
+    { 0.405241314f, -0.914209756f },
+    { 0.402434651f, -0.915448716f },
+    { 0.399624200f, -0.916679060f },
+    { 0.396809987f, -0.917900776f },
+    { 0.393992040f, -0.919113852f },
+    { 0.391170384f, -0.920318277f },
+    { 0.388345047f, -0.921514039f },
+    { 0.385516054f, -0.922701128f },
+    { 0.382683432f, -0.923879533f },
+    { 0.379847209f, -0.925049241f },
+    { 0.377007410f, -0.926210242f },
+    { 0.374164063f, -0.927362526f },
+    { 0.371317194f, -0.928506080f },
+    { 0.368466830f, -0.929640896f },
+    { 0.365612998f, -0.930766961f },
+    { 0.362755724f, -0.931884266f },
+    { 0.359895037f, -0.932992799f },
+    { 0.357030961f, -0.934092550f },
+    { 0.354163525f, -0.935183510f },
+    { 0.351292756f, -0.936265667f },
+    { 0.348418680f, -0.937339012f },
+    { 0.345541325f, -0.938403534f },
+    { 0.342660717f, -0.939459224f },
+    { 0.339776884f, -0.940506071f },
+    { 0.336889853f, -0.941544065f },
+    { 0.333999651f, -0.942573198f },
+    { 0.331106306f, -0.943593458f },
+    { 0.328209844f, -0.944604837f },
+    { 0.325310292f, -0.945607325f },
+    { 0.322407679f, -0.946600913f },
+    { 0.319502031f, -0.947585591f },
+    { 0.316593376f, -0.948561350f },
+    { 0.313681740f, -0.949528181f },
+    { 0.310767153f, -0.950486074f },
+    { 0.307849640f, -0.951435021f },
+    { 0.304929230f, -0.952375013f },
+    { 0.302005949f, -0.953306040f },
+    { 0.299079826f, -0.954228095f },
+    { 0.296150888f, -0.955141168f },
+    { 0.293219163f, -0.956045251f },
+    { 0.290284677f, -0.956940336f },
+    { 0.287347460f, -0.957826413f },
+    { 0.284407537f, -0.958703475f },
+    { 0.281464938f, -0.959571513f },
+    { 0.278519689f, -0.960430519f },
+    { 0.275571819f, -0.961280486f },
+    { 0.272621355f, -0.962121404f },
+    { 0.269668326f, -0.962953267f },
+    { 0.266712757f, -0.963776066f },
+    { 0.263754679f, -0.964589793f },
+    { 0.260794118f, -0.965394442f },
+    { 0.257831102f, -0.966190003f },
+    { 0.254865660f, -0.966976471f },
+    { 0.251897818f, -0.967753837f },
+    { 0.248927606f, -0.968522094f },
+    { 0.245955050f, -0.969281235f },
+    { 0.242980180f, -0.970031253f },
+    { 0.240003022f, -0.970772141f },
+    { 0.237023606f, -0.971503891f },
+    { 0.234041959f, -0.972226497f },
+    { 0.231058108f, -0.972939952f },
+    { 0.228072083f, -0.973644250f },
+    { 0.225083911f, -0.974339383f },
+    { 0.222093621f, -0.975025345f },
+    { 0.219101240f, -0.975702130f },
+    { 0.216106797f, -0.976369731f },
+    { 0.213110320f, -0.977028143f },
+    { 0.210111837f, -0.977677358f },
+    { 0.207111376f, -0.978317371f },
+    { 0.204108966f, -0.978948175f },
+    { 0.201104635f, -0.979569766f },
+    { 0.198098411f, -0.980182136f },
+    { 0.195090322f, -0.980785280f },
+    { 0.192080397f, -0.981379193f },
+    { 0.189068664f, -0.981963869f },
+    { 0.186055152f, -0.982539302f },
+    { 0.183039888f, -0.983105487f },
+    { 0.180022901f, -0.983662419f },
+    { 0.177004220f, -0.984210092f },
+    { 0.173983873f, -0.984748502f },
+    { 0.170961889f, -0.985277642f },
+    { 0.167938295f, -0.985797509f },
+    { 0.164913120f, -0.986308097f },
+    { 0.161886394f, -0.986809402f },
+    { 0.158858143f, -0.987301418f },
+    { 0.155828398f, -0.987784142f },
+    { 0.152797185f, -0.988257568f },
+    { 0.149764535f, -0.988721692f },
+    { 0.146730474f, -0.989176510f },
+    { 0.143695033f, -0.989622017f },
+    { 0.140658239f, -0.990058210f },
+    { 0.137620122f, -0.990485084f },
+    { 0.134580709f, -0.990902635f },
+    { 0.131540029f, -0.991310860f },
+    { 0.128498111f, -0.991709754f },
+    { 0.125454983f, -0.992099313f },
+    { 0.122410675f, -0.992479535f },
+    { 0.119365215f, -0.992850414f },
+    { 0.116318631f, -0.993211949f },
+    { 0.113270952f, -0.993564136f },
+    { 0.110222207f, -0.993906970f },
+    { 0.107172425f, -0.994240449f },
+    { 0.104121634f, -0.994564571f },
+    { 0.101069863f, -0.994879331f },
+    { 0.098017140f, -0.995184727f },
+    { 0.094963495f, -0.995480755f },
+    { 0.091908956f, -0.995767414f },
+    { 0.088853553f, -0.996044701f },
+    { 0.085797312f, -0.996312612f },
+    { 0.082740265f, -0.996571146f },
+    { 0.079682438f, -0.996820299f },
+    { 0.076623861f, -0.997060070f },
+    { 0.073564564f, -0.997290457f },
+    { 0.070504573f, -0.997511456f },
+    { 0.067443920f, -0.997723067f },
+    { 0.064382631f, -0.997925286f },
+    { 0.061320736f, -0.998118113f },
+    { 0.058258265f, -0.998301545f },
+    { 0.055195244f, -0.998475581f },
+    { 0.052131705f, -0.998640218f },
+    { 0.049067674f, -0.998795456f },
+    { 0.046003182f, -0.998941293f },
+    { 0.042938257f, -0.999077728f },
+    { 0.039872928f, -0.999204759f },
+    { 0.036807223f, -0.999322385f },
+    { 0.033741172f, -0.999430605f },
+    { 0.030674803f, -0.999529418f },
+    { 0.027608146f, -0.999618822f },
+    { 0.024541229f, -0.999698819f },
+    { 0.021474080f, -0.999769405f },
+    { 0.018406730f, -0.999830582f },
+    { 0.015339206f, -0.999882347f },
+    { 0.012271538f, -0.999924702f },
+    { 0.009203755f, -0.999957645f },
+    { 0.006135885f, -0.999981175f },
+    { 0.003067957f, -0.999995294f },
+    { 0.000000000f, -1.000000000f },
+    { -0.003067957f, -0.999995294f },
+    { -0.006135885f, -0.999981175f },
+    { -0.009203755f, -0.999957645f },
+    { -0.012271538f, -0.999924702f },
+    { -0.015339206f, -0.999882347f },
+    { -0.018406730f, -0.999830582f },
+    { -0.021474080f, -0.999769405f },
+    { -0.024541229f, -0.999698819f },
+    { -0.027608146f, -0.999618822f },
+    { -0.030674803f, -0.999529418f },
+    { -0.033741172f, -0.999430605f },
+    { -0.036807223f, -0.999322385f },
+    { -0.039872928f, -0.999204759f },
+    { -0.042938257f, -0.999077728f },
+    { -0.046003182f, -0.998941293f },
+    { -0.049067674f, -0.998795456f },
+    { -0.052131705f, -0.998640218f },
+    { -0.055195244f, -0.998475581f },
+    { -0.058258265f, -0.998301545f },
+    { -0.061320736f, -0.998118113f },
+    { -0.064382631f, -0.997925286f },
+    { -0.067443920f, -0.997723067f },
+    { -0.070504573f, -0.997511456f },
+    { -0.073564564f, -0.997290457f },
+    { -0.076623861f, -0.997060070f },
+    { -0.079682438f, -0.996820299f },
+    { -0.082740265f, -0.996571146f },
+    { -0.085797312f, -0.996312612f },
+    { -0.088853553f, -0.996044701f },
+    { -0.091908956f, -0.995767414f },
+    { -0.094963495f, -0.995480755f },
+    { -0.098017140f, -0.995184727f },
+    { -0.101069863f, -0.994879331f },
+    { -0.104121634f, -0.994564571f },
+    { -0.107172425f, -0.994240449f },
+    { -0.110222207f, -0.993906970f },
+    { -0.113270952f, -0.993564136f },
+    { -0.116318631f, -0.993211949f },
+    { -0.119365215f, -0.992850414f },
+    { -0.122410675f, -0.992479535f },
+    { -0.125454983f, -0.992099313f },
+    { -0.128498111f, -0.991709754f },
+    { -0.131540029f, -0.991310860f },
+    { -0.134580709f, -0.990902635f },
+    { -0.137620122f, -0.990485084f },
+    { -0.140658239f, -0.990058210f },
+    { -0.143695033f, -0.989622017f },
+    { -0.146730474f, -0.989176510f },
+    { -0.149764535f, -0.988721692f },
+    { -0.152797185f, -0.988257568f },
+    { -0.155828398f, -0.987784142f },
+    { -0.158858143f, -0.987301418f },
+    { -0.161886394f, -0.986809402f },
+    { -0.164913120f, -0.986308097f },
+    { -0.167938295f, -0.985797509f },
+    { -0.170961889f, -0.985277642f },
+    { -0.173983873f, -0.984748502f },
+    { -0.177004220f, -0.984210092f },
+    { -0.180022901f, -0.983662419f },
+    { -0.183039888f, -0.983105487f },
+    { -0.186055152f, -0.982539302f },
+    { -0.189068664f, -0.981963869f },
+    { -0.192080397f, -0.981379193f },
+    { -0.195090322f, -0.980785280f },
+    { -0.198098411f, -0.980182136f },
+    { -0.201104635f, -0.979569766f },
+    { -0.204108966f, -0.978948175f },
+    { -0.207111376f, -0.978317371f },
+    { -0.210111837f, -0.977677358f },
+    { -0.213110320f, -0.977028143f },
+    { -0.216106797f, -0.976369731f },
+    { -0.219101240f, -0.975702130f },
+    { -0.222093621f, -0.975025345f },
+    { -0.225083911f, -0.974339383f },
+    { -0.228072083f, -0.973644250f },
+    { -0.231058108f, -0.972939952f },
+    { -0.234041959f, -0.972226497f },
+    { -0.237023606f, -0.971503891f },
+    { -0.240003022f, -0.970772141f },
+    { -0.242980180f, -0.970031253f },
+    { -0.245955050f, -0.969281235f },
+    { -0.248927606f, -0.968522094f },
+    { -0.251897818f, -0.967753837f },
+    { -0.254865660f, -0.966976471f },
+    { -0.257831102f, -0.966190003f },
+    { -0.260794118f, -0.965394442f },
+    { -0.263754679f, -0.964589793f },
+    { -0.266712757f, -0.963776066f },
+    { -0.269668326f, -0.962953267f },
+    { -0.272621355f, -0.962121404f },
+    { -0.275571819f, -0.961280486f },
+    { -0.278519689f, -0.960430519f },
+    { -0.281464938f, -0.959571513f },
+    { -0.284407537f, -0.958703475f },
+    { -0.287347460f, -0.957826413f },
+    { -0.290284677f, -0.956940336f },
+    { -0.293219163f, -0.956045251f },
+    { -0.296150888f, -0.955141168f },
+    { -0.299079826f, -0.954228095f },
+    { -0.302005949f, -0.953306040f },
+    { -0.304929230f, -0.952375013f },
+    { -0.307849640f, -0.951435021f },
+    { -0.310767153f, -0.950486074f },
+    { -0.313681740f, -0.949528181f },
+    { -0.316593376f, -0.948561350f },
+    { -0.319502031f, -0.947585591f },
+    { -0.322407679f, -0.946600913f },
+    { -0.325310292f, -0.945607325f },
+    { -0.328209844f, -0.944604837f },
+    { -0.331106306f, -0.943593458f },
+    { -0.333999651f, -0.942573198f },
+    { -0.336889853f, -0.941544065f },
+    { -0.339776884f, -0.940506071f },
+    { -0.342660717f, -0.939459224f },
+    { -0.345541325f, -0.938403534f },
+    { -0.348418680f, -0.937339012f },
+    { -0.351292756f, -0.936265667f },
+    { -0.354163525f, -0.935183510f },
+    { -0.357030961f, -0.934092550f },
+    { -0.359895037f, -0.932992799f },
+    { -0.362755724f, -0.931884266f },
+    { -0.365612998f, -0.930766961f },
+    { -0.368466830f, -0.929640896f },
+    { -0.371317194f, -0.928506080f },
+    { -0.374164063f, -0.927362526f },
+    { -0.377007410f, -0.926210242f },
+    { -0.379847209f, -0.925049241f },
+    { -0.382683432f, -0.923879533f },
+    { -0.385516054f, -0.922701128f },
+    { -0.388345047f, -0.921514039f },
+    { -0.391170384f, -0.920318277f },
+    { -0.393992040f, -0.919113852f },
+    { -0.396809987f, -0.917900776f },
+    { -0.399624200f, -0.916679060f },
+    { -0.402434651f, -0.915448716f },
+    { -0.405241314f, -0.914209756f },
+    { -0.408044163f, -0.912962190f },
+    { -0.410843171f, -0.911706032f },
+    { -0.413638312f, -0.910441292f },
+    { -0.416429560f, -0.909167983f },
+    { -0.419216888f, -0.907886116f },
+    { -0.422000271f, -0.906595705f },
+    { -0.424779681f, -0.905296759f },
+    { -0.427555093f, -0.903989293f },
+    { -0.430326481f, -0.902673318f },
+    { -0.433093819f, -0.901348847f },
+    { -0.435857080f, -0.900015892f },
+    { -0.438616239f, -0.898674466f },
+    { -0.441371269f, -0.897324581f },
+    { -0.444122145f, -0.895966250f },
+    { -0.446868840f, -0.894599486f },
+    { -0.449611330f, -0.893224301f },
+    { -0.452349587f, -0.891840709f },
+    { -0.455083587f, -0.890448723f },
+    { -0.457813304f, -0.889048356f },
+    { -0.460538711f, -0.887639620f },
+    { -0.463259784f, -0.886222530f },
+    { -0.465976496f, -0.884797098f },
+    { -0.468688822f, -0.883363339f },
+    { -0.471396737f, -0.881921264f },
+    { -0.474100215f, -0.880470889f },
+    { -0.476799230f, -0.879012226f },
+    { -0.479493758f, -0.877545290f },
+    { -0.482183772f, -0.876070094f },
+    { -0.484869248f, -0.874586652f },
+    { -0.487550160f, -0.873094978f },
+    { -0.490226483f, -0.871595087f },
+    { -0.492898192f, -0.870086991f },
+    { -0.495565262f, -0.868570706f },
+    { -0.498227667f, -0.867046246f },
+    { -0.500885383f, -0.865513624f },
+    { -0.503538384f, -0.863972856f },
+    { -0.506186645f, -0.862423956f },
+    { -0.508830143f, -0.860866939f },
+    { -0.511468850f, -0.859301818f },
+    { -0.514102744f, -0.857728610f },
+    { -0.516731799f, -0.856147328f },
+    { -0.519355990f, -0.854557988f },
+    { -0.521975293f, -0.852960605f },
+    { -0.524589683f, -0.851355193f },
+    { -0.527199135f, -0.849741768f },
+    { -0.529803625f, -0.848120345f },
+    { -0.532403128f, -0.846490939f },
+    { -0.534997620f, -0.844853565f },
+    { -0.537587076f, -0.843208240f },
+    { -0.540171473f, -0.841554977f },
+    { -0.542750785f, -0.839893794f },
+    { -0.545324988f, -0.838224706f },
+    { -0.547894059f, -0.836547727f },
+    { -0.550457973f, -0.834862875f },
+    { -0.553016706f, -0.833170165f },
+    { -0.555570233f, -0.831469612f },
+    { -0.558118531f, -0.829761234f },
+    { -0.560661576f, -0.828045045f },
+    { -0.563199344f, -0.826321063f },
+    { -0.565731811f, -0.824589303f },
+    { -0.568258953f, -0.822849781f },
+    { -0.570780746f, -0.821102515f },
+    { -0.573297167f, -0.819347520f },
+    { -0.575808191f, -0.817584813f },
+    { -0.578313796f, -0.815814411f },
+    { -0.580813958f, -0.814036330f },
+    { -0.583308653f, -0.812250587f },
+    { -0.585797857f, -0.810457198f },
+    { -0.588281548f, -0.808656182f },
+    { -0.590759702f, -0.806847554f },
+    { -0.593232295f, -0.805031331f },
+    { -0.595699304f, -0.803207531f },
+    { -0.598160707f, -0.801376172f },
+    { -0.600616479f, -0.799537269f },
+    { -0.603066599f, -0.797690841f },
+    { -0.605511041f, -0.795836905f },
+    { -0.607949785f, -0.793975478f },
+    { -0.610382806f, -0.792106577f },
+    { -0.612810082f, -0.790230221f },
+    { -0.615231591f, -0.788346428f },
+    { -0.617647308f, -0.786455214f },
+    { -0.620057212f, -0.784556597f },
+    { -0.622461279f, -0.782650596f },
+    { -0.624859488f, -0.780737229f },
+    { -0.627251815f, -0.778816512f },
+    { -0.629638239f, -0.776888466f },
+    { -0.632018736f, -0.774953107f },
+    { -0.634393284f, -0.773010453f },
+    { -0.636761861f, -0.771060524f },
+    { -0.639124445f, -0.769103338f },
+    { -0.641481013f, -0.767138912f },
+    { -0.643831543f, -0.765167266f },
+    { -0.646176013f, -0.763188417f },
+    { -0.648514401f, -0.761202385f },
+    { -0.650846685f, -0.759209189f },
+    { -0.653172843f, -0.757208847f },
+    { -0.655492853f, -0.755201377f },
+    { -0.657806693f, -0.753186799f },
+    { -0.660114342f, -0.751165132f },
+    { -0.662415778f, -0.749136395f },
+    { -0.664710978f, -0.747100606f },
+    { -0.666999922f, -0.745057785f },
+    { -0.669282588f, -0.743007952f },
+    { -0.671558955f, -0.740951125f },
+    { -0.673829000f, -0.738887324f },
+    { -0.676092704f, -0.736816569f },
+    { -0.678350043f, -0.734738878f },
+    { -0.680600998f, -0.732654272f },
+    { -0.682845546f, -0.730562769f },
+    { -0.685083668f, -0.728464390f },
+    { -0.687315341f, -0.726359155f },
+    { -0.689540545f, -0.724247083f },
+    { -0.691759258f, -0.722128194f },
+    { -0.693971461f, -0.720002508f },
+    { -0.696177131f, -0.717870045f },
+    { -0.698376249f, -0.715730825f },
+    { -0.700568794f, -0.713584869f },
+    { -0.702754744f, -0.711432196f },
+    { -0.704934080f, -0.709272826f },
+    { -0.707106781f, -0.707106781f },
+    { -0.709272826f, -0.704934080f },
+    { -0.711432196f, -0.702754744f },
+    { -0.713584869f, -0.700568794f },
+    { -0.715730825f, -0.698376249f },
+    { -0.717870045f, -0.696177131f },
+    { -0.720002508f, -0.693971461f },
+    { -0.722128194f, -0.691759258f },
+    { -0.724247083f, -0.689540545f },
+    { -0.726359155f, -0.687315341f },
+    { -0.728464390f, -0.685083668f },
+    { -0.730562769f, -0.682845546f },
+    { -0.732654272f, -0.680600998f },
+    { -0.734738878f, -0.678350043f },
+    { -0.736816569f, -0.676092704f },
+    { -0.738887324f, -0.673829000f },
+    { -0.740951125f, -0.671558955f },
+    { -0.743007952f, -0.669282588f },
+    { -0.745057785f, -0.666999922f },
+    { -0.747100606f, -0.664710978f },
+    { -0.749136395f, -0.662415778f },
+    { -0.751165132f, -0.660114342f },
+    { -0.753186799f, -0.657806693f },
+    { -0.755201377f, -0.655492853f },
+    { -0.757208847f, -0.653172843f },
+    { -0.759209189f, -0.650846685f },
+    { -0.761202385f, -0.648514401f },
+    { -0.763188417f, -0.646176013f },
+    { -0.765167266f, -0.643831543f },
+    { -0.767138912f, -0.641481013f },
+    { -0.769103338f, -0.639124445f },
+    { -0.771060524f, -0.636761861f },
+    { -0.773010453f, -0.634393284f },
+    { -0.774953107f, -0.632018736f },
+    { -0.776888466f, -0.629638239f },
+    { -0.778816512f, -0.627251815f },
+    { -0.780737229f, -0.624859488f },
+    { -0.782650596f, -0.622461279f },
+    { -0.784556597f, -0.620057212f },
+    { -0.786455214f, -0.617647308f },
+    { -0.788346428f, -0.615231591f },
+    { -0.790230221f, -0.612810082f },
+    { -0.792106577f, -0.610382806f },
+    { -0.793975478f, -0.607949785f },
+    { -0.795836905f, -0.605511041f },
+    { -0.797690841f, -0.603066599f },
+    { -0.799537269f, -0.600616479f },
+    { -0.801376172f, -0.598160707f },
+    { -0.803207531f, -0.595699304f },
+    { -0.805031331f, -0.593232295f },
+    { -0.806847554f, -0.590759702f },
+    { -0.808656182f, -0.588281548f },
+    { -0.810457198f, -0.585797857f },
+    { -0.812250587f, -0.583308653f },
+    { -0.814036330f, -0.580813958f },
+    { -0.815814411f, -0.578313796f },
+    { -0.817584813f, -0.575808191f },
+    { -0.819347520f, -0.573297167f },
+    { -0.821102515f, -0.570780746f },
+    { -0.822849781f, -0.568258953f },
+    { -0.824589303f, -0.565731811f },
+    { -0.826321063f, -0.563199344f },
+    { -0.828045045f, -0.560661576f },
+    { -0.829761234f, -0.558118531f },
+    { -0.831469612f, -0.555570233f },
+    { -0.833170165f, -0.553016706f },
+    { -0.834862875f, -0.550457973f },
+    { -0.836547727f, -0.547894059f },
+    { -0.838224706f, -0.545324988f },
+    { -0.839893794f, -0.542750785f },
+    { -0.841554977f, -0.540171473f },
+    { -0.843208240f, -0.537587076f },
+    { -0.844853565f, -0.534997620f },
+    { -0.846490939f, -0.532403128f },
+    { -0.848120345f, -0.529803625f },
+    { -0.849741768f, -0.527199135f },
+    { -0.851355193f, -0.524589683f },
+    { -0.852960605f, -0.521975293f },
+    { -0.854557988f, -0.519355990f },
+    { -0.856147328f, -0.516731799f },
+    { -0.857728610f, -0.514102744f },
+    { -0.859301818f, -0.511468850f },
+    { -0.860866939f, -0.508830143f },
+    { -0.862423956f, -0.506186645f },
+    { -0.863972856f, -0.503538384f },
+    { -0.865513624f, -0.500885383f },
+    { -0.867046246f, -0.498227667f },
+    { -0.868570706f, -0.495565262f },
+    { -0.870086991f, -0.492898192f },
+    { -0.871595087f, -0.490226483f },
+    { -0.873094978f, -0.487550160f },
+    { -0.874586652f, -0.484869248f },
+    { -0.876070094f, -0.482183772f },
+    { -0.877545290f, -0.479493758f },
+    { -0.879012226f, -0.476799230f },
+    { -0.880470889f, -0.474100215f },
+    { -0.881921264f, -0.471396737f },
+    { -0.883363339f, -0.468688822f },
+    { -0.884797098f, -0.465976496f },
+    { -0.886222530f, -0.463259784f },
+    { -0.887639620f, -0.460538711f },
+    { -0.889048356f, -0.457813304f },
+    { -0.890448723f, -0.455083587f },
+    { -0.891840709f, -0.452349587f },
+    { -0.893224301f, -0.449611330f },
+    { -0.894599486f, -0.446868840f },
+    { -0.895966250f, -0.444122145f },
+    { -0.897324581f, -0.441371269f },
+    { -0.898674466f, -0.438616239f },
+    { -0.900015892f, -0.435857080f },
+    { -0.901348847f, -0.433093819f },
+    { -0.902673318f, -0.430326481f },
+    { -0.903989293f, -0.427555093f },
+    { -0.905296759f, -0.424779681f },
+    { -0.906595705f, -0.422000271f },
+    { -0.907886116f, -0.419216888f },
+    { -0.909167983f, -0.416429560f },
+    { -0.910441292f, -0.413638312f },
+    { -0.911706032f, -0.410843171f },
+    { -0.912962190f, -0.408044163f },
+    { -0.914209756f, -0.405241314f },
+    { -0.915448716f, -0.402434651f },
+    { -0.916679060f, -0.399624200f },
+    { -0.917900776f, -0.396809987f },
+    { -0.919113852f, -0.393992040f },
+    { -0.920318277f, -0.391170384f },
+    { -0.921514039f, -0.388345047f },
+    { -0.922701128f, -0.385516054f },
+    { -0.923879533f, -0.382683432f },
+    { -0.925049241f, -0.379847209f },
+    { -0.926210242f, -0.377007410f },
+    { -0.927362526f, -0.374164063f },
+    { -0.928506080f, -0.371317194f },
+    { -0.929640896f, -0.368466830f },
+    { -0.930766961f, -0.365612998f },
+    { -0.931884266f, -0.362755724f },
+    { -0.932992799f, -0.359895037f },
+    { -0.934092550f, -0.357030961f },
+    { -0.935183510f, -0.354163525f },
+    { -0.936265667f, -0.351292756f },
+    { -0.937339012f, -0.348418680f },
+    { -0.938403534f, -0.345541325f },
+    { -0.939459224f, -0.342660717f },
+    { -0.940506071f, -0.339776884f },
+    { -0.941544065f, -0.336889853f },
+    { -0.942573198f, -0.333999651f },
+    { -0.943593458f, -0.331106306f },
+    { -0.944604837f, -0.328209844f },
+    { -0.945607325f, -0.325310292f },
+    { -0.946600913f, -0.322407679f },
+    { -0.947585591f, -0.319502031f },
+    { -0.948561350f, -0.316593376f },
+    { -0.949528181f, -0.313681740f },
+    { -0.950486074f, -0.310767153f },
+    { -0.951435021f, -0.307849640f },
+    { -0.952375013f, -0.304929230f },
+    { -0.953306040f, -0.302005949f },
+    { -0.954228095f, -0.299079826f },
+    { -0.955141168f, -0.296150888f },
+    { -0.956045251f, -0.293219163f },
+    { -0.956940336f, -0.290284677f },
+    { -0.957826413f, -0.287347460f },
+    { -0.958703475f, -0.284407537f },
+    { -0.959571513f, -0.281464938f },
+    { -0.960430519f, -0.278519689f },
+    { -0.961280486f, -0.275571819f },
+    { -0.962121404f, -0.272621355f },
+    { -0.962953267f, -0.269668326f },
+    { -0.963776066f, -0.266712757f },
+    { -0.964589793f, -0.263754679f },
+    { -0.965394442f, -0.260794118f },
+    { -0.966190003f, -0.257831102f },
+    { -0.966976471f, -0.254865660f },
+    { -0.967753837f, -0.251897818f },
+    { -0.968522094f, -0.248927606f },
+    { -0.969281235f, -0.245955050f },
+    { -0.970031253f, -0.242980180f },
+    { -0.970772141f, -0.240003022f },
+    { -0.971503891f, -0.237023606f },
+    { -0.972226497f, -0.234041959f },
+    { -0.972939952f, -0.231058108f },
+    { -0.973644250f, -0.228072083f },
+    { -0.974339383f, -0.225083911f },
+    { -0.975025345f, -0.222093621f },
+    { -0.975702130f, -0.219101240f },
+    { -0.976369731f, -0.216106797f },
+    { -0.977028143f, -0.213110320f },
+    { -0.977677358f, -0.210111837f },
+    { -0.978317371f, -0.207111376f },
+    { -0.978948175f, -0.204108966f },
+    { -0.979569766f, -0.201104635f },
+    { -0.980182136f, -0.198098411f },
+    { -0.980785280f, -0.195090322f },
+    { -0.981379193f, -0.192080397f },
+    { -0.981963869f, -0.189068664f },
+    { -0.982539302f, -0.186055152f },
+    { -0.983105487f, -0.183039888f },
+    { -0.983662419f, -0.180022901f },
+    { -0.984210092f, -0.177004220f },
+    { -0.984748502f, -0.173983873f },
+    { -0.985277642f, -0.170961889f },
+    { -0.985797509f, -0.167938295f },
+    { -0.986308097f, -0.164913120f },
+    { -0.986809402f, -0.161886394f },
+    { -0.987301418f, -0.158858143f },
+    { -0.987784142f, -0.155828398f },
+    { -0.988257568f, -0.152797185f },
+    { -0.988721692f, -0.149764535f },
+    { -0.989176510f, -0.146730474f },
+    { -0.989622017f, -0.143695033f },
+    { -0.990058210f, -0.140658239f },
+    { -0.990485084f, -0.137620122f },
+    { -0.990902635f, -0.134580709f },
+    { -0.991310860f, -0.131540029f },
+    { -0.991709754f, -0.128498111f },
+    { -0.992099313f, -0.125454983f },
+    { -0.992479535f, -0.122410675f },
+    { -0.992850414f, -0.119365215f },
+    { -0.993211949f, -0.116318631f },
+    { -0.993564136f, -0.113270952f },
+    { -0.993906970f, -0.110222207f },
+    { -0.994240449f, -0.107172425f },
+    { -0.994564571f, -0.104121634f },
+    { -0.994879331f, -0.101069863f },
+    { -0.995184727f, -0.098017140f },
+    { -0.995480755f, -0.094963495f },
+    { -0.995767414f, -0.091908956f },
+    { -0.996044701f, -0.088853553f },
+    { -0.996312612f, -0.085797312f },
+    { -0.996571146f, -0.082740265f },
+    { -0.996820299f, -0.079682438f },
+    { -0.997060070f, -0.076623861f },
+    { -0.997290457f, -0.073564564f },
+    { -0.997511456f, -0.070504573f },
+    { -0.997723067f, -0.067443920f },
+    { -0.997925286f, -0.064382631f },
+    { -0.998118113f, -0.061320736f },
+    { -0.998301545f, -0.058258265f },
+    { -0.998475581f, -0.055195244f },
+    { -0.998640218f, -0.052131705f },
+    { -0.998795456f, -0.049067674f },
+    { -0.998941293f, -0.046003182f },
+    { -0.999077728f, -0.042938257f },
+    { -0.999204759f, -0.039872928f },
+    { -0.999322385f, -0.036807223f },
+    { -0.999430605f, -0.033741172f },
+    { -0.999529418f, -0.030674803f },
+    { -0.999618822f, -0.027608146f },
+    { -0.999698819f, -0.024541229f },
+    { -0.999769405f, -0.021474080f },
+    { -0.999830582f, -0.018406730f },
+    { -0.999882347f, -0.015339206f },
+    { -0.999924702f, -0.012271538f },
+    { -0.999957645f, -0.009203755f },
+    { -0.999981175f, -0.006135885f },
+    { -0.999995294f, -0.003067957f },
+    { -1.000000000f, -0.000000000f },
+    { -0.999995294f, 0.003067957f },
+    { -0.999981175f, 0.006135885f },
+    { -0.999957645f, 0.009203755f },
+    { -0.999924702f, 0.012271538f },
+    { -0.999882347f, 0.015339206f },
+    { -0.999830582f, 0.018406730f },
+    { -0.999769405f, 0.021474080f },
+    { -0.999698819f, 0.024541229f },
+    { -0.999618822f, 0.027608146f },
+    { -0.999529418f, 0.030674803f },
+    { -0.999430605f, 0.033741172f },
+    { -0.999322385f, 0.036807223f },
+    { -0.999204759f, 0.039872928f },
+    { -0.999077728f, 0.042938257f },
+    { -0.998941293f, 0.046003182f },
+    { -0.998795456f, 0.049067674f },
+    { -0.998640218f, 0.052131705f },
+    { -0.998475581f, 0.055195244f },
+    { -0.998301545f, 0.058258265f },
+    { -0.998118113f, 0.061320736f },
+    { -0.997925286f, 0.064382631f },
+    { -0.997723067f, 0.067443920f },
+    { -0.997511456f, 0.070504573f },
+    { -0.997290457f, 0.073564564f },
+    { -0.997060070f, 0.076623861f },
+    { -0.996820299f, 0.079682438f },
+    { -0.996571146f, 0.082740265f },
+    { -0.996312612f, 0.085797312f },
+    { -0.996044701f, 0.088853553f },
+    { -0.995767414f, 0.091908956f },
+    { -0.995480755f, 0.094963495f },
+    { -0.995184727f, 0.098017140f },
+    { -0.994879331f, 0.101069863f },
+    { -0.994564571f, 0.104121634f },
+    { -0.994240449f, 0.107172425f },
+    { -0.993906970f, 0.110222207f },
+    { -0.993564136f, 0.113270952f },
+    { -0.993211949f, 0.116318631f },
+    { -0.992850414f, 0.119365215f },
+    { -0.992479535f, 0.122410675f },
+    { -0.992099313f, 0.125454983f },
+    { -0.991709754f, 0.128498111f },
+    { -0.991310860f, 0.131540029f },
+    { -0.990902635f, 0.134580709f },
+    { -0.990485084f, 0.137620122f },
+    { -0.990058210f, 0.140658239f },
+    { -0.989622017f, 0.143695033f },
+    { -0.989176510f, 0.146730474f },
+    { -0.988721692f, 0.149764535f },
+    { -0.988257568f, 0.152797185f },
+    { -0.987784142f, 0.155828398f },
+    { -0.987301418f, 0.158858143f },
+    { -0.986809402f, 0.161886394f },
+    { -0.986308097f, 0.164913120f },
+    { -0.985797509f, 0.167938295f },
+    { -0.985277642f, 0.170961889f },
+    { -0.984748502f, 0.173983873f },
+    { -0.984210092f, 0.177004220f },
+    { -0.983662419f, 0.180022901f },
+    { -0.983105487f, 0.183039888f },
+    { -0.982539302f, 0.186055152f },
+    { -0.981963869f, 0.189068664f },
+    { -0.981379193f, 0.192080397f },
+    { -0.980785280f, 0.195090322f },
+    { -0.980182136f, 0.198098411f },
+    { -0.979569766f, 0.201104635f },
+    { -0.978948175f, 0.204108966f },
+    { -0.978317371f, 0.207111376f },
+    { -0.977677358f, 0.210111837f },
+    { -0.977028143f, 0.213110320f },
+    { -0.976369731f, 0.216106797f },
+    { -0.975702130f, 0.219101240f },
+    { -0.975025345f, 0.222093621f },
+    { -0.974339383f, 0.225083911f },
+    { -0.973644250f, 0.228072083f },
+    { -0.972939952f, 0.231058108f },
+    { -0.972226497f, 0.234041959f },
+    { -0.971503891f, 0.237023606f },
+    { -0.970772141f, 0.240003022f },
+    { -0.970031253f, 0.242980180f },
+    { -0.969281235f, 0.245955050f },
+    { -0.968522094f, 0.248927606f },
+    { -0.967753837f, 0.251897818f },
+    { -0.966976471f, 0.254865660f },
+    { -0.966190003f, 0.257831102f },
+    { -0.965394442f, 0.260794118f },
+    { -0.964589793f, 0.263754679f },
+    { -0.963776066f, 0.266712757f },
+    { -0.962953267f, 0.269668326f },
+    { -0.962121404f, 0.272621355f },
+    { -0.961280486f, 0.275571819f },
+    { -0.960430519f, 0.278519689f },
+    { -0.959571513f, 0.281464938f },
+    { -0.958703475f, 0.284407537f },
+    { -0.957826413f, 0.287347460f },
+    { -0.956940336f, 0.290284677f },
+    { -0.956045251f, 0.293219163f },
+    { -0.955141168f, 0.296150888f },
+    { -0.954228095f, 0.299079826f },
+    { -0.953306040f, 0.302005949f },
+    { -0.952375013f, 0.304929230f },
+    { -0.951435021f, 0.307849640f },
+    { -0.950486074f, 0.310767153f },
+    { -0.949528181f, 0.313681740f },
+    { -0.948561350f, 0.316593376f },
+    { -0.947585591f, 0.319502031f },
+    { -0.946600913f, 0.322407679f },
+    { -0.945607325f, 0.325310292f },
+    { -0.944604837f, 0.328209844f },
+    { -0.943593458f, 0.331106306f },
+    { -0.942573198f, 0.333999651f },
+    { -0.941544065f, 0.336889853f },
+    { -0.940506071f, 0.339776884f },
+    { -0.939459224f, 0.342660717f },
+    { -0.938403534f, 0.345541325f },
+    { -0.937339012f, 0.348418680f },
+    { -0.936265667f, 0.351292756f },
+    { -0.935183510f, 0.354163525f },
+    { -0.934092550f, 0.357030961f },
+    { -0.932992799f, 0.359895037f },
+    { -0.931884266f, 0.362755724f },
+    { -0.930766961f, 0.365612998f },
+    { -0.929640896f, 0.368466830f },
+    { -0.928506080f, 0.371317194f },
+    { -0.927362526f, 0.374164063f },
+    { -0.926210242f, 0.377007410f },
+    { -0.925049241f, 0.379847209f },
+    { -0.923879533f, 0.382683432f },
+    { -0.922701128f, 0.385516054f },
+    { -0.921514039f, 0.388345047f },
+    { -0.920318277f, 0.391170384f },
+    { -0.919113852f, 0.393992040f },
+    { -0.917900776f, 0.396809987f },
+    { -0.916679060f, 0.399624200f },
+    { -0.915448716f, 0.402434651f },
+    { -0.914209756f, 0.405241314f },
+    { -0.912962190f, 0.408044163f },
+    { -0.911706032f, 0.410843171f },
+    { -0.910441292f, 0.413638312f },
+    { -0.909167983f, 0.416429560f },
+    { -0.907886116f, 0.419216888f },
+    { -0.906595705f, 0.422000271f },
+    { -0.905296759f, 0.424779681f },
+    { -0.903989293f, 0.427555093f },
+    { -0.902673318f, 0.430326481f },
+    { -0.901348847f, 0.433093819f },
+    { -0.900015892f, 0.435857080f },
+    { -0.898674466f, 0.438616239f },
+    { -0.897324581f, 0.441371269f },
+    { -0.895966250f, 0.444122145f },
+    { -0.894599486f, 0.446868840f },
+    { -0.893224301f, 0.449611330f },
+    { -0.891840709f, 0.452349587f },
+    { -0.890448723f, 0.455083587f },
+    { -0.889048356f, 0.457813304f },
+    { -0.887639620f, 0.460538711f },
+    { -0.886222530f, 0.463259784f },
+    { -0.884797098f, 0.465976496f },
+    { -0.883363339f, 0.468688822f },
+    { -0.881921264f, 0.471396737f },
+    { -0.880470889f, 0.474100215f },
+    { -0.879012226f, 0.476799230f },
+    { -0.877545290f, 0.479493758f },
+    { -0.876070094f, 0.482183772f },
+    { -0.874586652f, 0.484869248f },
+    { -0.873094978f, 0.487550160f },
+    { -0.871595087f, 0.490226483f },
+    { -0.870086991f, 0.492898192f },
+    { -0.868570706f, 0.495565262f },
+    { -0.867046246f, 0.498227667f },
+    { -0.865513624f, 0.500885383f },
+    { -0.863972856f, 0.503538384f },
+    { -0.862423956f, 0.506186645f },
+    { -0.860866939f, 0.508830143f },
+    { -0.859301818f, 0.511468850f },
+    { -0.857728610f, 0.514102744f },
+    { -0.856147328f, 0.516731799f },
+    { -0.854557988f, 0.519355990f },
+    { -0.852960605f, 0.521975293f },
+    { -0.851355193f, 0.524589683f },
+    { -0.849741768f, 0.527199135f },
+    { -0.848120345f, 0.529803625f },
+    { -0.846490939f, 0.532403128f },
+    { -0.844853565f, 0.534997620f },
+    { -0.843208240f, 0.537587076f },
+    { -0.841554977f, 0.540171473f },
+    { -0.839893794f, 0.542750785f },
+    { -0.838224706f, 0.545324988f },
+    { -0.836547727f, 0.547894059f },
+    { -0.834862875f, 0.550457973f },
+    { -0.833170165f, 0.553016706f },
+    { -0.831469612f, 0.555570233f },
+    { -0.829761234f, 0.558118531f },
+    { -0.828045045f, 0.560661576f },
+    { -0.826321063f, 0.563199344f },
+    { -0.824589303f, 0.565731811f },
+    { -0.822849781f, 0.568258953f },
+    { -0.821102515f, 0.570780746f },
+    { -0.819347520f, 0.573297167f },
+    { -0.817584813f, 0.575808191f },
+    { -0.815814411f, 0.578313796f },
+    { -0.814036330f, 0.580813958f },
+    { -0.812250587f, 0.583308653f },
+    { -0.810457198f, 0.585797857f },
+    { -0.808656182f, 0.588281548f },
+    { -0.806847554f, 0.590759702f },
+    { -0.805031331f, 0.593232295f },
+    { -0.803207531f, 0.595699304f },
+    { -0.801376172f, 0.598160707f },
+    { -0.799537269f, 0.600616479f },
+    { -0.797690841f, 0.603066599f },
+    { -0.795836905f, 0.605511041f },
+    { -0.793975478f, 0.607949785f },
+    { -0.792106577f, 0.610382806f },
+    { -0.790230221f, 0.612810082f },
+    { -0.788346428f, 0.615231591f },
+    { -0.786455214f, 0.617647308f },
+    { -0.784556597f, 0.620057212f },
+    { -0.782650596f, 0.622461279f },
+    { -0.780737229f, 0.624859488f },
+    { -0.778816512f, 0.627251815f },
+    { -0.776888466f, 0.629638239f },
+    { -0.774953107f, 0.632018736f },
+    { -0.773010453f, 0.634393284f },
+    { -0.771060524f, 0.636761861f },
+    { -0.769103338f, 0.639124445f },
+    { -0.767138912f, 0.641481013f },
+    { -0.765167266f, 0.643831543f },
+    { -0.763188417f, 0.646176013f },
+    { -0.761202385f, 0.648514401f },
+    { -0.759209189f, 0.650846685f },
+    { -0.757208847f, 0.653172843f },
+    { -0.755201377f, 0.655492853f },
+    { -0.753186799f, 0.657806693f },
+    { -0.751165132f, 0.660114342f },
+    { -0.749136395f, 0.662415778f },
+    { -0.747100606f, 0.664710978f },
+    { -0.745057785f, 0.666999922f },
+    { -0.743007952f, 0.669282588f },
+    { -0.740951125f, 0.671558955f },
+    { -0.738887324f, 0.673829000f },
+    { -0.736816569f, 0.676092704f },
+    { -0.734738878f, 0.678350043f },
+    { -0.732654272f, 0.680600998f },
+    { -0.730562769f, 0.682845546f },
+    { -0.728464390f, 0.685083668f },
+    { -0.726359155f, 0.687315341f },
+    { -0.724247083f, 0.689540545f },
+    { -0.722128194f, 0.691759258f },
+    { -0.720002508f, 0.693971461f },
+    { -0.717870045f, 0.696177131f },
+    { -0.715730825f, 0.698376249f },
+    { -0.713584869f, 0.700568794f },
+    { -0.711432196f, 0.702754744f },
+    { -0.709272826f, 0.704934080f },
+    { -0.707106781f, 0.707106781f },
+    { -0.704934080f, 0.709272826f },
+    { -0.702754744f, 0.711432196f },
+    { -0.700568794f, 0.713584869f },
+    { -0.698376249f, 0.715730825f },
+    { -0.696177131f, 0.717870045f },
+    { -0.693971461f, 0.720002508f },
+    { -0.691759258f, 0.722128194f },
+    { -0.689540545f, 0.724247083f },
+    { -0.687315341f, 0.726359155f },
+    { -0.685083668f, 0.728464390f },
+    { -0.682845546f, 0.730562769f },
+    { -0.680600998f, 0.732654272f },
+    { -0.678350043f, 0.734738878f },
+    { -0.676092704f, 0.736816569f },
+    { -0.673829000f, 0.738887324f },
+    { -0.671558955f, 0.740951125f },
+    { -0.669282588f, 0.743007952f },
+    { -0.666999922f, 0.745057785f },
+    { -0.664710978f, 0.747100606f },
+    { -0.662415778f, 0.749136395f },
+    { -0.660114342f, 0.751165132f },
+    { -0.657806693f, 0.753186799f },
+    { -0.655492853f, 0.755201377f },
+    { -0.653172843f, 0.757208847f },
+    { -0.650846685f, 0.759209189f },
+    { -0.648514401f, 0.761202385f },
+    { -0.646176013f, 0.763188417f },
+    { -0.643831543f, 0.765167266f },
+    { -0.641481013f, 0.767138912f },
+    { -0.639124445f, 0.769103338f },
+    { -0.636761861f, 0.771060524f },
+    { -0.634393284f, 0.773010453f },
+    { -0.632018736f, 0.774953107f },
+    { -0.629638239f, 0.776888466f },
+    { -0.627251815f, 0.778816512f },
+    { -0.624859488f, 0.780737229f },
+    { -0.622461279f, 0.782650596f },
+    { -0.620057212f, 0.784556597f },
+    { -0.617647308f, 0.786455214f },
+    { -0.615231591f, 0.788346428f },
+    { -0.612810082f, 0.790230221f },
+    { -0.610382806f, 0.792106577f },
+    { -0.607949785f, 0.793975478f },
+    { -0.605511041f, 0.795836905f },
+    { -0.603066599f, 0.797690841f },
+    { -0.600616479f, 0.799537269f },
+    { -0.598160707f, 0.801376172f },
+    { -0.595699304f, 0.803207531f },
+    { -0.593232295f, 0.805031331f },
+    { -0.590759702f, 0.806847554f },
+    { -0.588281548f, 0.808656182f },
+    { -0.585797857f, 0.810457198f },
+    { -0.583308653f, 0.812250587f },
+    { -0.580813958f, 0.814036330f },
+    { -0.578313796f, 0.815814411f },
+    { -0.575808191f, 0.817584813f },
+    { -0.573297167f, 0.819347520f },
+    { -0.570780746f, 0.821102515f },
+    { -0.568258953f, 0.822849781f },
+    { -0.565731811f, 0.824589303f },
+    { -0.563199344f, 0.826321063f },
+    { -0.560661576f, 0.828045045f },
+    { -0.558118531f, 0.829761234f },
+    { -0.555570233f, 0.831469612f },
+    { -0.553016706f, 0.833170165f },
+    { -0.550457973f, 0.834862875f },
+    { -0.547894059f, 0.836547727f },
+    { -0.545324988f, 0.838224706f },
+    { -0.542750785f, 0.839893794f },
+    { -0.540171473f, 0.841554977f },
+    { -0.537587076f, 0.843208240f },
+    { -0.534997620f, 0.844853565f },
+    { -0.532403128f, 0.846490939f },
+    { -0.529803625f, 0.848120345f },
+    { -0.527199135f, 0.849741768f },
+    { -0.524589683f, 0.851355193f },
+    { -0.521975293f, 0.852960605f },
+    { -0.519355990f, 0.854557988f },
+    { -0.516731799f, 0.856147328f },
+    { -0.514102744f, 0.857728610f },
+    { -0.511468850f, 0.859301818f },
+    { -0.508830143f, 0.860866939f },
+    { -0.506186645f, 0.862423956f },
+    { -0.503538384f, 0.863972856f },
+    { -0.500885383f, 0.865513624f },
+    { -0.498227667f, 0.867046246f },
+    { -0.495565262f, 0.868570706f },
+    { -0.492898192f, 0.870086991f },
+    { -0.490226483f, 0.871595087f },
+    { -0.487550160f, 0.873094978f },
+    { -0.484869248f, 0.874586652f },
+    { -0.482183772f, 0.876070094f },
+    { -0.479493758f, 0.877545290f },
+    { -0.476799230f, 0.879012226f },
+    { -0.474100215f, 0.880470889f },
+    { -0.471396737f, 0.881921264f },
+    { -0.468688822f, 0.883363339f },
+    { -0.465976496f, 0.884797098f },
+    { -0.463259784f, 0.886222530f },
+    { -0.460538711f, 0.887639620f },
+    { -0.457813304f, 0.889048356f },
+    { -0.455083587f, 0.890448723f },
+    { -0.452349587f, 0.891840709f },
+    { -0.449611330f, 0.893224301f },
+    { -0.446868840f, 0.894599486f },
+    { -0.444122145f, 0.895966250f },
+    { -0.441371269f, 0.897324581f },
+    { -0.438616239f, 0.898674466f },
+    { -0.435857080f, 0.900015892f },
+    { -0.433093819f, 0.901348847f },
+    { -0.430326481f, 0.902673318f },
+    { -0.427555093f, 0.903989293f },
+    { -0.424779681f, 0.905296759f },
+    { -0.422000271f, 0.906595705f },
+    { -0.419216888f, 0.907886116f },
+    { -0.416429560f, 0.909167983f },
+    { -0.413638312f, 0.910441292f },
+    { -0.410843171f, 0.911706032f },
+    { -0.408044163f, 0.912962190f },
+    { -0.405241314f, 0.914209756f },
+    { -0.402434651f, 0.915448716f },
+    { -0.399624200f, 0.916679060f },
+    { -0.396809987f, 0.917900776f },
+    { -0.393992040f, 0.919113852f },
+    { -0.391170384f, 0.920318277f },
+    { -0.388345047f, 0.921514039f },
+    { -0.385516054f, 0.922701128f },
+    { -0.382683432f, 0.923879533f },
+    { -0.379847209f, 0.925049241f },
+    { -0.377007410f, 0.926210242f },
+    { -0.374164063f, 0.927362526f },
+    { -0.371317194f, 0.928506080f },
+    { -0.368466830f, 0.929640896f },
+    { -0.365612998f, 0.930766961f },
+    { -0.362755724f, 0.931884266f },
+    { -0.359895037f, 0.932992799f },
+    { -0.357030961f, 0.934092550f },
+    { -0.354163525f, 0.935183510f },
+    { -0.351292756f, 0.936265667f },
+    { -0.348418680f, 0.937339012f },
+    { -0.345541325f, 0.938403534f },
+    { -0.342660717f, 0.939459224f },
+    { -0.339776884f, 0.940506071f },
+    { -0.336889853f, 0.941544065f },
+    { -0.333999651f, 0.942573198f },
+    { -0.331106306f, 0.943593458f },
+    { -0.328209844f, 0.944604837f },
+    { -0.325310292f, 0.945607325f },
+    { -0.322407679f, 0.946600913f },
+    { -0.319502031f, 0.947585591f },
+    { -0.316593376f, 0.948561350f },
+    { -0.313681740f, 0.949528181f },
+    { -0.310767153f, 0.950486074f },
+    { -0.307849640f, 0.951435021f },
+    { -0.304929230f, 0.952375013f },
+    { -0.302005949f, 0.953306040f },
+    { -0.299079826f, 0.954228095f },
+    { -0.296150888f, 0.955141168f },
+    { -0.293219163f, 0.956045251f },
+    { -0.290284677f, 0.956940336f },
+    { -0.287347460f, 0.957826413f },
+    { -0.284407537f, 0.958703475f },
+    { -0.281464938f, 0.959571513f },
+    { -0.278519689f, 0.960430519f },
+    { -0.275571819f, 0.961280486f },
+    { -0.272621355f, 0.962121404f },
+    { -0.269668326f, 0.962953267f },
+    { -0.266712757f, 0.963776066f },
+    { -0.263754679f, 0.964589793f },
+    { -0.260794118f, 0.965394442f },
+    { -0.257831102f, 0.966190003f },
+    { -0.254865660f, 0.966976471f },
+    { -0.251897818f, 0.967753837f },
+    { -0.248927606f, 0.968522094f },
+    { -0.245955050f, 0.969281235f },
+    { -0.242980180f, 0.970031253f },
+    { -0.240003022f, 0.970772141f },
+    { -0.237023606f, 0.971503891f },
+    { -0.234041959f, 0.972226497f },
+    { -0.231058108f, 0.972939952f },
+    { -0.228072083f, 0.973644250f },
+    { -0.225083911f, 0.974339383f },
+    { -0.222093621f, 0.975025345f },
+    { -0.219101240f, 0.975702130f },
+    { -0.216106797f, 0.976369731f },
+    { -0.213110320f, 0.977028143f },
+    { -0.210111837f, 0.977677358f },
+    { -0.207111376f, 0.978317371f },
+    { -0.204108966f, 0.978948175f },
+    { -0.201104635f, 0.979569766f },
+    { -0.198098411f, 0.980182136f },
+    { -0.195090322f, 0.980785280f },
+    { -0.192080397f, 0.981379193f },
+    { -0.189068664f, 0.981963869f },
+    { -0.186055152f, 0.982539302f },
+    { -0.183039888f, 0.983105487f },
+    { -0.180022901f, 0.983662419f },
+    { -0.177004220f, 0.984210092f },
+    { -0.173983873f, 0.984748502f },
+    { -0.170961889f, 0.985277642f },
+    { -0.167938295f, 0.985797509f },
+    { -0.164913120f, 0.986308097f },
+    { -0.161886394f, 0.986809402f },
+    { -0.158858143f, 0.987301418f },
+    { -0.155828398f, 0.987784142f },
+    { -0.152797185f, 0.988257568f },
+    { -0.149764535f, 0.988721692f },
+    { -0.146730474f, 0.989176510f },
+    { -0.143695033f, 0.989622017f },
+    { -0.140658239f, 0.990058210f },
+    { -0.137620122f, 0.990485084f },
+    { -0.134580709f, 0.990902635f },
+    { -0.131540029f, 0.991310860f },
+    { -0.128498111f, 0.991709754f },
+    { -0.125454983f, 0.992099313f },
+    { -0.122410675f, 0.992479535f },
+    { -0.119365215f, 0.992850414f },
+    { -0.116318631f, 0.993211949f },
+    { -0.113270952f, 0.993564136f },
+    { -0.110222207f, 0.993906970f },
+    { -0.107172425f, 0.994240449f },
+    { -0.104121634f, 0.994564571f },
+    { -0.101069863f, 0.994879331f },
+    { -0.098017140f, 0.995184727f },
+    { -0.094963495f, 0.995480755f },
+    { -0.091908956f, 0.995767414f },
+    { -0.088853553f, 0.996044701f },
+    { -0.085797312f, 0.996312612f },
+    { -0.082740265f, 0.996571146f },
+    { -0.079682438f, 0.996820299f },
+    { -0.076623861f, 0.997060070f },
+    { -0.073564564f, 0.997290457f },
+    { -0.070504573f, 0.997511456f },
+    { -0.067443920f, 0.997723067f },
+    { -0.064382631f, 0.997925286f },
+    { -0.061320736f, 0.998118113f },
+    { -0.058258265f, 0.998301545f },
+    { -0.055195244f, 0.998475581f },
+    { -0.052131705f, 0.998640218f },
+    { -0.049067674f, 0.998795456f },
+    { -0.046003182f, 0.998941293f },
+    { -0.042938257f, 0.999077728f },
+    { -0.039872928f, 0.999204759f },
+    { -0.036807223f, 0.999322385f },
+    { -0.033741172f, 0.999430605f },
+    { -0.030674803f, 0.999529418f },
+    { -0.027608146f, 0.999618822f },
+    { -0.024541229f, 0.999698819f },
+    { -0.021474080f, 0.999769405f },
+    { -0.018406730f, 0.999830582f },
+    { -0.015339206f, 0.999882347f },
+    { -0.012271538f, 0.999924702f },
+    { -0.009203755f, 0.999957645f },
+    { -0.006135885f, 0.999981175f },
+    { -0.003067957f, 0.999995294f },
+};
+
+const uint32_t fft_q15_twiddles[NUM_SAMPLES/2] = {
+    0x00007FFF, 0xFF9B7FFF, 0xFF377FFF, 0xFED27FFF, 0xFE6E7FFE, 0xFE097FFC,
+    0xFDA57FFA, 0xFD407FF8, 0xFCDC7FF6, 0xFC777FF4, 0xFC137FF1, 0xFBAE7FED,
+    0xFB4A7FEA, 0xFAE57FE6, 0xFA817FE2, 0xFA1D7FDD, 0xF9B87FD9, 0xF9547FD3,
+    0xF8EF7FCE, 0xF88B7FC8, 0xF8277FC2, 0xF7C27FBC, 0xF75E7FB5, 0xF6FA7FAE,
+    0xF6957FA7, 0xF6317FA0, 0xF5CD7F98, 0xF5697F90, 0xF5057F87, 0xF4A07F7E,
+    0xF43C7F75, 0xF3D87F6C, 0xF3747F62, 0xF3107F58, 0xF2AC7F4E, 0xF2487F43,
+    0xF1E47F38, 0xF1807F2D, 0xF11C7F22, 0xF0B97F16, 0xF0557F0A, 0xEFF17EFD,
+    0xEF8D7EF0, 0xEF2A7EE3, 0xEEC67ED6, 0xEE627EC8, 0xEDFF7EBA, 0xED9B7EAC,
+    0xED387E9D, 0xECD57E8E, 0xEC717E7F, 0xEC0E7E70, 0xEBAB7E60, 0xEB477E50,
+    0xEAE47E3F, 0xEA817E2F, 0xEA1E7E1E, 0xE9BB7E0C, 0xE9587DFB, 0xE8F57DE9,
+    0xE8927DD6, 0xE82F7DC4, 0xE7CD7DB1, 0xE76A7D9E, 0xE7077D8A, 0xE6A57D77,
+    0xE6427D63, 0xE5E07D4E, 0xE57D7D3A, 0xE51B7D25, 0xE4B97D0F, 0xE4577CFA,
+    0xE3F47CE4, 0xE3927CCE, 0xE3307CB7, 0xE2CF7CA0, 0xE26D7C89, 0xE20B7C72,
+    0xE1A97C5A, 0xE1487C42, 0xE0E67C2A, 0xE0857C11, 0xE0237BF9, 0xDFC27BDF,
+    0xDF617BC6, 0xDEFF7BAC, 0xDE9E7B92, 0xDE3D7B78, 0xDDDC7B5D, 0xDD7C7B42,
+    0xDD1B7B27, 0xDCBA7B0B, 0xDC597AEF, 0xDBF97AD3, 0xDB997AB7, 0xDB387A9A,
+    0xDAD87A7D, 0xDA787A60, 0xDA187A42, 0xD9B87A24, 0xD9587A06, 0xD8F879E7,
+    0xD89879C9, 0xD83979AA, 0xD7D9798A, 0xD77A796A, 0xD71B794A, 0xD6BB792A,
+    0xD65C790A, 0xD5FD78E9, 0xD59E78C8, 0xD53F78A6, 0xD4E17885, 0xD4827863,
+    0xD4247840, 0xD3C5781E, 0xD36777FB, 0xD30977D8, 0xD2AB77B4, 0xD24D7790,
+    0xD1EF776C, 0xD1917748, 0xD1347723, 0xD0D676FE, 0xD07976D9, 0xD01B76B4,
+    0xCFBE768E, 0xCF617668, 0xCF047642, 0xCEA7761B, 0xCE4B75F4, 0xCDEE75CD,
+    0xCD9275A6, 0xCD35757E, 0xCCD97556, 0xCC7D752D, 0xCC217505, 0xCBC574DC,
+    0xCB6974B3, 0xCB0E7489, 0xCAB27460, 0xCA577436, 0xC9FC740B, 0xC9A173E1,
+    0xC94673B6, 0xC8EB738B, 0xC890735F, 0xC8367334, 0xC7DB7308, 0xC78172DC,
+    0xC72772AF, 0xC6CD7282, 0xC6737255, 0xC6197228, 0xC5C071FA, 0xC56671CC,
+    0xC50D719E, 0xC4B47170, 0xC45B7141, 0xC4027112, 0xC3A970E3, 0xC35170B3,
+    0xC2F87083, 0xC2A07053, 0xC2487023, 0xC1F06FF2, 0xC1986FC2, 0xC1406F90,
+    0xC0E96F5F, 0xC0916F2D, 0xC03A6EFB, 0xBFE36EC9, 0xBF8C6E97, 0xBF356E64,
+    0xBEDF6E31, 0xBE886DFE, 0xBE326DCA, 0xBDDC6D96, 0xBD866D62, 0xBD306D2E,
+    0xBCDA6CF9, 0xBC856CC4, 0xBC2F6C8F, 0xBBDA6C5A, 0xBB856C24, 0xBB306BEE,
+    0xBADC6BB8, 0xBA876B82, 0xBA336B4B, 0xB9DF6B14, 0xB98B6ADD, 0xB9376AA5,
+    0xB8E36A6E, 0xB8906A36, 0xB83C69FD, 0xB7E969C5, 0xB796698C, 0xB7436953,
+    0xB6F1691A, 0xB69E68E0, 0xB64C68A7, 0xB5FA686D, 0xB5A86832, 0xB55667F8,
+    0xB50567BD, 0xB4B36782, 0xB4626747, 0xB411670B, 0xB3C066D0, 0xB36F6693,
+    0xB31F6657, 0xB2CF661B, 0xB27F65DE, 0xB22F65A1, 0xB1DF6564, 0xB18F6526,
+    0xB14064E9, 0xB0F164AB, 0xB0A2646C, 0xB053642E, 0xB00563EF, 0xAFB663B0,
+    0xAF686371, 0xAF1A6332, 0xAECC62F2, 0xAE7F62B2, 0xAE316272, 0xADE46232,
+    0xAD9761F1, 0xAD4A61B0, 0xACFD616F, 0xACB1612E, 0xAC6560EC, 0xAC1960AA,
+    0xABCD6068, 0xAB816026, 0xAB365FE4, 0xAAEB5FA1, 0xAAA05F5E, 0xAA555F1B,
+    0xAA0A5ED7, 0xA9C05E94, 0xA9765E50, 0xA92C5E0C, 0xA8E25DC8, 0xA8995D83,
+    0xA84F5D3E, 0xA8065CF9, 0xA7BD5CB4, 0xA7745C6F, 0xA72C5C29, 0xA6E45BE3,
+    0xA69C5B9D, 0xA6545B57, 0xA60C5B10, 0xA5C55AC9, 0xA57E5A82, 0xA5375A3B,
+    0xA4F059F4, 0xA4A959AC, 0xA4635964, 0xA41D591C, 0xA3D758D4, 0xA391588C,
+    0xA34C5843, 0xA30757FA, 0xA2C257B1, 0xA27D5767, 0xA238571E, 0xA1F456D4,
+    0xA1B0568A, 0xA16C5640, 0xA12955F6, 0xA0E555AB, 0xA0A25560, 0xA05F5515,
+    0xA01C54CA, 0x9FDA547F, 0x9F985433, 0x9F5653E7, 0x9F14539B, 0x9ED2534F,
+    0x9E915303, 0x9E5052B6, 0x9E0F5269, 0x9DCE521C, 0x9D8E51CF, 0x9D4E5181,
+    0x9D0E5134, 0x9CCE50E6, 0x9C8F5098, 0x9C50504A, 0x9C114FFB, 0x9BD24FAD,
+    0x9B944F5E, 0x9B554F0F, 0x9B174EC0, 0x9ADA4E71, 0x9A9C4E21, 0x9A5F4DD1,
+    0x9A224D81, 0x99E54D31, 0x99A94CE1, 0x996D4C91, 0x99304C40, 0x98F54BEF,
+    0x98B94B9E, 0x987E4B4D, 0x98434AFB, 0x98084AAA, 0x97CE4A58, 0x97934A06,
+    0x975949B4, 0x97204962, 0x96E6490F, 0x96AD48BD, 0x9674486A, 0x963B4817,
+    0x960347C4, 0x95CA4770, 0x9592471D, 0x955B46C9, 0x95234675, 0x94EC4621,
+    0x94B545CD, 0x947E4579, 0x94484524, 0x941244D0, 0x93DC447B, 0x93A64426,
+    0x937143D1, 0x933C437B, 0x93074326, 0x92D242D0, 0x929E427A, 0x926A4224,
+    0x923641CE, 0x92024178, 0x91CF4121, 0x919C40CB, 0x91694074, 0x9137401D,
+    0x91053FC6, 0x90D33F6F, 0x90A13F17, 0x90703EC0, 0x903E3E68, 0x900E3E10,
+    0x8FDD3DB8, 0x8FAD3D60, 0x8F7D3D08, 0x8F4D3CAF, 0x8F1D3C57, 0x8EEE3BFE,
+    0x8EBF3BA5, 0x8E903B4C, 0x8E623AF3, 0x8E343A9A, 0x8E063A40, 0x8DD839E7,
+    0x8DAB398D, 0x8D7E3933, 0x8D5138D9, 0x8D24387F, 0x8CF83825, 0x8CCC37CA,
+    0x8CA13770, 0x8C753715, 0x8C4A36BA, 0x8C1F365F, 0x8BF53604, 0x8BCA35A9,
+    0x8BA0354E, 0x8B7734F2, 0x8B4D3497, 0x8B24343B, 0x8AFB33DF, 0x8AD33383,
+    0x8AAA3327, 0x8A8232CB, 0x8A5A326E, 0x8A333212, 0x8A0C31B5, 0x89E53159,
+    0x89BE30FC, 0x8998309F, 0x89723042, 0x894C2FE5, 0x89272F87, 0x89022F2A,
+    0x88DD2ECC, 0x88B82E6F, 0x88942E11, 0x88702DB3, 0x884C2D55, 0x88282CF7,
+    0x88052C99, 0x87E22C3B, 0x87C02BDC, 0x879D2B7E, 0x877B2B1F, 0x875A2AC1,
+    0x87382A62, 0x87172A03, 0x86F629A4, 0x86D62945, 0x86B628E5, 0x86962886,
+    0x86762827, 0x865627C7, 0x86372768, 0x86192708, 0x85FA26A8, 0x85DC2648,
+    0x85BE25E8, 0x85A02588, 0x85832528, 0x856624C8, 0x85492467, 0x852D2407,
+    0x851123A7, 0x84F52346, 0x84D922E5, 0x84BE2284, 0x84A32224, 0x848821C3,
+    0x846E2162, 0x84542101, 0x843A209F, 0x8421203E, 0x84071FDD, 0x83EF1F7B,
+    0x83D61F1A, 0x83BE1EB8, 0x83A61E57, 0x838E1DF5, 0x83771D93, 0x83601D31,
+    0x83491CD0, 0x83321C6E, 0x831C1C0C, 0x83061BA9, 0x82F11B47, 0x82DB1AE5,
+    0x82C61A83, 0x82B21A20, 0x829D19BE, 0x8289195B, 0x827618F9, 0x82621896,
+    0x824F1833, 0x823C17D1, 0x822A176E, 0x8217170B, 0x820516A8, 0x81F41645,
+    0x81E215E2, 0x81D1157F, 0x81C1151C, 0x81B014B9, 0x81A01455, 0x819013F2,
+    0x8181138F, 0x8172132B, 0x816312C8, 0x81541265, 0x81461201, 0x8138119E,
+    0x812A113A, 0x811D10D6, 0x81101073, 0x8103100F, 0x80F60FAB, 0x80EA0F47,
+    0x80DE0EE4, 0x80D30E80, 0x80C80E1C, 0x80BD0DB8, 0x80B20D54, 0x80A80CF0,
+    0x809E0C8C, 0x80940C28, 0x808B0BC4, 0x80820B60, 0x80790AFB, 0x80700A97,
+    0x80680A33, 0x806009CF, 0x8059096B, 0x80520906, 0x804B08A2, 0x8044083E,
+    0x803E07D9, 0x80380775, 0x80320711, 0x802D06AC, 0x80270648, 0x802305E3,
+    0x801E057F, 0x801A051B, 0x801604B6, 0x80130452, 0x800F03ED, 0x800C0389,
+    0x800A0324, 0x800802C0, 0x8006025B, 0x800401F7, 0x80020192, 0x8001012E,
+    0x800100C9, 0x80000065, 0x80000000, 0x8000FF9B, 0x8001FF37, 0x8001FED2,
+    0x8002FE6E, 0x8004FE09, 0x8006FDA5, 0x8008FD40, 0x800AFCDC, 0x800CFC77,
+    0x800FFC13, 0x8013FBAE, 0x8016FB4A, 0x801AFAE5, 0x801EFA81, 0x8023FA1D,
+    0x8027F9B8, 0x802DF954, 0x8032F8EF, 0x8038F88B, 0x803EF827, 0x8044F7C2,
+    0x804BF75E, 0x8052F6FA, 0x8059F695, 0x8060F631, 0x8068F5CD, 0x8070F569,
+    0x8079F505, 0x8082F4A0, 0x808BF43C, 0x8094F3D8, 0x809EF374, 0x80A8F310,
+    0x80B2F2AC, 0x80BDF248, 0x80C8F1E4, 0x80D3F180, 0x80DEF11C, 0x80EAF0B9,
+    0x80F6F055, 0x8103EFF1, 0x8110EF8D, 0x811DEF2A, 0x812AEEC6, 0x8138EE62,
+    0x8146EDFF, 0x8154ED9B, 0x8163ED38, 0x8172ECD5, 0x8181EC71, 0x8190EC0E,
+    0x81A0EBAB, 0x81B0EB47, 0x81C1EAE4, 0x81D1EA81, 0x81E2EA1E, 0x81F4E9BB,
+    0x8205E958, 0x8217E8F5, 0x822AE892, 0x823CE82F, 0x824FE7CD, 0x8262E76A,
+    0x8276E707, 0x8289E6A5, 0x829DE642, 0x82B2E5E0, 0x82C6E57D, 0x82DBE51B,
+    0x82F1E4B9, 0x8306E457, 0x831CE3F4, 0x8332E392, 0x8349E330, 0x8360E2CF,
+    0x8377E26D, 0x838EE20B, 0x83A6E1A9, 0x83BEE148, 0x83D6E0E6, 0x83EFE085,
+    0x8407E023, 0x8421DFC2, 0x843ADF61, 0x8454DEFF, 0x846EDE9E, 0x8488DE3D,
+    0x84A3DDDC, 0x84BEDD7C, 0x84D9DD1B, 0x84F5DCBA, 0x8511DC59, 0x852DDBF9,
+    0x8549DB99, 0x8566DB38, 0x8583DAD8, 0x85A0DA78, 0x85BEDA18, 0x85DCD9B8,
+    0x85FAD958, 0x8619D8F8, 0x8637D898, 0x8656D839, 0x8676D7D9, 0x8696D77A,
+    0x86B6D71B, 0x86D6D6BB, 0x86F6D65C, 0x8717D5FD, 0x8738D59E, 0x875AD53F,
+    0x877BD4E1, 0x879DD482, 0x87C0D424, 0x87E2D3C5, 0x8805D367, 0x8828D309,
+    0x884CD2AB, 0x8870D24D, 0x8894D1EF, 0x88B8D191, 0x88DDD134, 0x8902D0D6,
+    0x8927D079, 0x894CD01B, 0x8972CFBE, 0x8998CF61, 0x89BECF04, 0x89E5CEA7,
+    0x8A0CCE4B, 0x8A33CDEE, 0x8A5ACD92, 0x8A82CD35, 0x8AAACCD9, 0x8AD3CC7D,
+    0x8AFBCC21, 0x8B24CBC5, 0x8B4DCB69, 0x8B77CB0E, 0x8BA0CAB2, 0x8BCACA57,
+    0x8BF5C9FC, 0x8C1FC9A1, 0x8C4AC946, 0x8C75C8EB, 0x8CA1C890, 0x8CCCC836,
+    0x8CF8C7DB, 0x8D24C781, 0x8D51C727, 0x8D7EC6CD, 0x8DABC673, 0x8DD8C619,
+    0x8E06C5C0, 0x8E34C566, 0x8E62C50D, 0x8E90C4B4, 0x8EBFC45B, 0x8EEEC402,
+    0x8F1DC3A9, 0x8F4DC351, 0x8F7DC2F8, 0x8FADC2A0, 0x8FDDC248, 0x900EC1F0,
+    0x903EC198, 0x9070C140, 0x90A1C0E9, 0x90D3C091, 0x9105C03A, 0x9137BFE3,
+    0x9169BF8C, 0x919CBF35, 0x91CFBEDF, 0x9202BE88, 0x9236BE32, 0x926ABDDC,
+    0x929EBD86, 0x92D2BD30, 0x9307BCDA, 0x933CBC85, 0x9371BC2F, 0x93A6BBDA,
+    0x93DCBB85, 0x9412BB30, 0x9448BADC, 0x947EBA87, 0x94B5BA33, 0x94ECB9DF,
+    0x9523B98B, 0x955BB937, 0x9592B8E3, 0x95CAB890, 0x9603B83C, 0x963BB7E9,
+    0x9674B796, 0x96ADB743, 0x96E6B6F1, 0x9720B69E, 0x9759B64C, 0x9793B5FA,
+    0x97CEB5A8, 0x9808B556, 0x9843B505, 0x987EB4B3, 0x98B9B462, 0x98F5B411,
+    0x9930B3C0, 0x996DB36F, 0x99A9B31F, 0x99E5B2CF, 0x9A22B27F, 0x9A5FB22F,
+    0x9A9CB1DF, 0x9ADAB18F, 0x9B17B140, 0x9B55B0F1, 0x9B94B0A2, 0x9BD2B053,
+    0x9C11B005, 0x9C50AFB6, 0x9C8FAF68, 0x9CCEAF1A, 0x9D0EAECC, 0x9D4EAE7F,
+    0x9D8EAE31, 0x9DCEADE4, 0x9E0FAD97, 0x9E50AD4A, 0x9E91ACFD, 0x9ED2ACB1,
+    0x9F14AC65, 0x9F56AC19, 0x9F98ABCD, 0x9FDAAB81, 0xA01CAB36, 0xA05FAAEB,
+    0xA0A2AAA0, 0xA0E5AA55, 0xA129AA0A, 0xA16CA9C0, 0xA1B0A976, 0xA1F4A92C,
+    0xA238A8E2, 0xA27DA899, 0xA2C2A84F, 0xA307A806, 0xA34CA7BD, 0xA391A774,
+    0xA3D7A72C, 0xA41DA6E4, 0xA463A69C, 0xA4A9A654, 0xA4F0A60C, 0xA537A5C5,
+    0xA57EA57E, 0xA5C5A537, 0xA60CA4F0, 0xA654A4A9, 0xA69CA463, 0xA6E4A41D,
+    0xA72CA3D7, 0xA774A391, 0xA7BDA34C, 0xA806A307, 0xA84FA2C2, 0xA899A27D,
+    0xA8E2A238, 0xA92CA1F4, 0xA976A1B0, 0xA9C0A16C, 0xAA0AA129, 0xAA55A0E5,
+    0xAAA0A0A2, 0xAAEBA05F, 0xAB36A01C, 0xAB819FDA, 0xABCD9F98, 0xAC199F56,
+    0xAC659F14, 0xACB19ED2, 0xACFD9E91, 0xAD4A9E50, 0xAD979E0F, 0xADE49DCE,
+    0xAE319D8E, 0xAE7F9D4E, 0xAECC9D0E, 0xAF1A9CCE, 0xAF689C8F, 0xAFB69C50,
+    0xB0059C11, 0xB0539BD2, 0xB0A29B94, 0xB0F19B55, 0xB1409B17, 0xB18F9ADA,
+    0xB1DF9A9C, 0xB22F9A5F, 0xB27F9A22, 0xB2CF99E5, 0xB31F99A9, 0xB36F996D,
+    0xB3C09930, 0xB41198F5, 0xB46298B9, 0xB4B3987E, 0xB5059843, 0xB5569808,
+    0xB5A897CE, 0xB5FA9793, 0xB64C9759, 0xB69E9720, 0xB6F196E6, 0xB74396AD,
+    0xB7969674, 0xB7E9963B, 0xB83C9603, 0xB89095CA, 0xB8E39592, 0xB937955B,
+    0xB98B9523, 0xB9DF94EC, 0xBA3394B5, 0xBA87947E, 0xBADC9448, 0xBB309412,
+    0xBB8593DC, 0xBBDA93A6, 0xBC2F9371, 0xBC85933C, 0xBCDA9307, 0xBD3092D2,
+    0xBD86929E, 0xBDDC926A, 0xBE329236, 0xBE889202, 0xBEDF91CF, 0xBF35919C,
+    0xBF8C9169, 0xBFE39137, 0xC03A9105, 0xC09190D3, 0xC0E990A1, 0xC1409070,
+    0xC198903E, 0xC1F0900E, 0xC2488FDD, 0xC2A08FAD, 0xC2F88F7D, 0xC3518F4D,
+    0xC3A98F1D, 0xC4028EEE, 0xC45B8EBF, 0xC4B48E90, 0xC50D8E62, 0xC5668E34,
+    0xC5C08E06, 0xC6198DD8, 0xC6738DAB, 0xC6CD8D7E, 0xC7278D51, 0xC7818D24,
+    0xC7DB8CF8, 0xC8368CCC, 0xC8908CA1, 0xC8EB8C75, 0xC9468C4A, 0xC9A18C1F,
+    0xC9FC8BF5, 0xCA578BCA, 0xCAB28BA0, 0xCB0E8B77, 0xCB698B4D, 0xCBC58B24,
+    0xCC218AFB, 0xCC7D8AD3, 0xCCD98AAA, 0xCD358A82, 0xCD928A5A, 0xCDEE8A33,
+    0xCE4B8A0C, 0xCEA789E5, 0xCF0489BE, 0xCF618998, 0xCFBE8972, 0xD01B894C,
+    0xD0798927, 0xD0D68902, 0xD13488DD, 0xD19188B8, 0xD1EF8894, 0xD24D8870,
+    0xD2AB884C, 0xD3098828, 0xD3678805, 0xD3C587E2, 0xD42487C0, 0xD482879D,
+    0xD4E1877B, 0xD53F875A, 0xD59E8738, 0xD5FD8717, 0xD65C86F6, 0xD6BB86D6,
+    0xD71B86B6, 0xD77A8696, 0xD7D98676, 0xD8398656, 0xD8988637, 0xD8F88619,
+    0xD95885FA, 0xD9B885DC, 0xDA1885BE, 0xDA7885A0, 0xDAD88583, 0xDB388566,
+    0xDB998549, 0xDBF9852D, 0xDC598511, 0xDCBA84F5, 0xDD1B84D9, 0xDD7C84BE,
+    0xDDDC84A3, 0xDE3D8488, 0xDE9E846E, 0xDEFF8454, 0xDF61843A, 0xDFC28421,
+    0xE0238407, 0xE08583EF, 0xE0E683D6, 0xE14883BE, 0xE1A983A6, 0xE20B838E,
+    0xE26D8377, 0xE2CF8360, 0xE3308349, 0xE3928332, 0xE3F4831C, 0xE4578306,
+    0xE4B982F1, 0xE51B82DB, 0xE57D82C6, 0xE5E082B2, 0xE642829D, 0xE6A58289,
+    0xE7078276, 0xE76A8262, 0xE7CD824F, 0xE82F823C, 0xE892822A, 0xE8F58217,
+    0xE9588205, 0xE9BB81F4, 0xEA1E81E2, 0xEA8181D1, 0xEAE481C1, 0xEB4781B0,
+    0xEBAB81A0, 0xEC0E8190, 0xEC718181, 0xECD58172, 0xED388163, 0xED9B8154,
+    0xEDFF8146, 0xEE628138, 0xEEC6812A, 0xEF2A811D, 0xEF8D8110, 0xEFF18103,
+    0xF05580F6, 0xF0B980EA, 0xF11C80DE, 0xF18080D3, 0xF1E480C8, 0xF24880BD,
+    0xF2AC80B2, 0xF31080A8, 0xF374809E, 0xF3D88094, 0xF43C808B, 0xF4A08082,
+    0xF5058079, 0xF5698070, 0xF5CD8068, 0xF6318060, 0xF6958059, 0xF6FA8052,
+    0xF75E804B, 0xF7C28044, 0xF827803E, 0xF88B8038, 0xF8EF8032, 0xF954802D,
+    0xF9B88027, 0xFA1D8023, 0xFA81801E, 0xFAE5801A, 0xFB4A8016, 0xFBAE8013,
+    0xFC13800F, 0xFC77800C, 0xFCDC800A, 0xFD408008, 0xFDA58006, 0xFE098004,
+    0xFE6E8002, 0xFED28001, 0xFF378001, 0xFF9B8000,
+};
+
+const float fft_window[NUM_SAMPLES] = {
+    0.000000000f, 0.000004706f, 0.000018825f, 0.000042355f, 0.000075298f,
+    0.000117653f, 0.000169418f, 0.000230595f, 0.000301181f, 0.000381178f,
+    0.000470582f, 0.000569395f, 0.000677615f, 0.000795241f, 0.000922272f,
+    0.001058707f, 0.001204544f, 0.001359782f, 0.001524419f, 0.001698455f,
+    0.001881887f, 0.002074714f, 0.002276933f, 0.002488544f, 0.002709543f,
+    0.002939930f, 0.003179701f, 0.003428854f, 0.003687388f, 0.003955299f,
+    0.004232586f, 0.004519245f, 0.004815273f, 0.005120669f, 0.005435429f,
+    0.005759551f, 0.006093030f, 0.006435864f, 0.006788051f, 0.007149586f,
+    0.007520465f, 0.007900687f, 0.008290246f, 0.008689140f, 0.009097365f,
+    0.009514916f, 0.009941790f, 0.010377983f, 0.010823490f, 0.011278308f,
+    0.011742432f, 0.012215858f, 0.012698582f, 0.013190598f, 0.013691903f,
+    0.014202491f, 0.014722358f, 0.015251498f, 0.015789908f, 0.016337581f,
+    0.016894513f, 0.017460698f, 0.018036131f, 0.018620807f, 0.019214720f,
+    0.019817864f, 0.020430234f, 0.021051825f, 0.021682629f, 0.022322642f,
+    0.022971857f, 0.023630269f, 0.024297870f, 0.024974655f, 0.025660617f,
+    0.026355750f, 0.027060048f, 0.027773503f, 0.028496109f, 0.029227859f,
+    0.029968747f, 0.030718765f, 0.031477906f, 0.032246163f, 0.033023529f,
+    0.033809997f, 0.034605558f, 0.035410207f, 0.036223934f, 0.037046733f,
+    0.037878596f, 0.038719514f, 0.039569481f, 0.040428487f, 0.041296525f,
+    0.042173587f, 0.043059664f, 0.043954749f, 0.044858832f, 0.045771905f,
+    0.046693960f, 0.047624987f, 0.048564979f, 0.049513926f, 0.050471819f,
+    0.051438650f, 0.052414409f, 0.053399087f, 0.054392675f, 0.055395163f,
+    0.056406542f, 0.057426802f, 0.058455935f, 0.059493929f, 0.060540776f,
+    0.061596466f, 0.062660988f, 0.063734333f, 0.064816490f, 0.065907450f,
+    0.067007201f, 0.068115734f, 0.069233039f, 0.070359104f, 0.071493920f,
+    0.072637474f, 0.073789758f, 0.074950759f, 0.076120467f, 0.077298872f,
+    0.078485961f, 0.079681723f, 0.080886148f, 0.082099224f, 0.083320940f,
+    0.084551284f, 0.085790244f, 0.087037810f, 0.088293968f, 0.089558708f,
+    0.090832017f, 0.092113884f, 0.093404295f, 0.094703241f, 0.096010707f,
+    0.097326682f, 0.098651153f, 0.099984108f, 0.101325534f, 0.102675419f,
+    0.104033750f, 0.105400514f, 0.106775699f, 0.108159291f, 0.109551277f,
+    0.110951644f, 0.112360380f, 0.113777470f, 0.115202902f, 0.116636661f,
+    0.118078736f, 0.119529111f, 0.120987774f, 0.122454710f, 0.123929906f,
+    0.125413348f, 0.126905022f, 0.128404913f, 0.129913009f, 0.131429294f,
+    0.132953754f, 0.134486376f, 0.136027144f, 0.137576044f, 0.139133061f,
+    0.140698182f, 0.142271390f, 0.143852672f, 0.145442012f, 0.147039395f,
+    0.148644807f, 0.150258232f, 0.151879655f, 0.153509061f, 0.155146435f,
+    0.156791760f, 0.158445023f, 0.160106206f, 0.161775294f, 0.163452273f,
+    0.165137125f, 0.166829835f, 0.168530388f, 0.170238766f, 0.171954955f,
+    0.173678937f, 0.175410697f, 0.177150219f, 0.178897485f, 0.180652480f,
+    0.182415187f, 0.184185589f, 0.185963670f, 0.187749413f, 0.189542802f,
+    0.191343818f, 0.193152446f, 0.194968669f, 0.196792469f, 0.198623828f,
+    0.200462731f, 0.202309159f, 0.204163095f, 0.206024522f, 0.207893423f,
+    0.209769779f, 0.211653572f, 0.213544786f, 0.215443403f, 0.217349404f,
+    0.219262771f, 0.221183488f, 0.223111534f, 0.225046893f, 0.226989547f,
+    0.228939476f, 0.230896662f, 0.232861088f, 0.234832734f, 0.236811583f,
+    0.238797615f, 0.240790811f, 0.242791153f, 0.244798623f, 0.246813201f,
+    0.248834868f, 0.250863605f, 0.252899394f, 0.254942215f, 0.256992048f,
+    0.259048875f, 0.261112676f, 0.263183431f, 0.265261122f, 0.267345728f,
+    0.269437231f, 0.271535610f, 0.273640845f, 0.275752917f, 0.277871806f,
+    0.279997492f, 0.282129955f, 0.284269175f, 0.286415131f, 0.288567804f,
+    0.290727174f, 0.292893219f, 0.295065920f, 0.297245256f, 0.299431206f,
+    0.301623751f, 0.303822869f, 0.306028539f, 0.308240742f, 0.310459455f,
+    0.312684659f, 0.314916332f, 0.317154454f, 0.319399002f, 0.321649957f,
+    0.323907296f, 0.326171000f, 0.328441045f, 0.330717412f, 0.333000078f,
+    0.335289022f, 0.337584222f, 0.339885658f, 0.342193307f, 0.344507147f,
+    0.346827157f, 0.349153315f, 0.351485599f, 0.353823987f, 0.356168457f,
+    0.358518987f, 0.360875555f, 0.363238139f, 0.365606716f, 0.367981264f,
+    0.370361761f, 0.372748185f, 0.375140512f, 0.377538721f, 0.379942788f,
+    0.382352692f, 0.384768409f, 0.387189918f, 0.389617194f, 0.392050215f,
+    0.394488959f, 0.396933401f, 0.399383521f, 0.401839293f, 0.404300696f,
+    0.406767705f, 0.409240298f, 0.411718452f, 0.414202143f, 0.416691347f,
+    0.419186042f, 0.421686204f, 0.424191809f, 0.426702833f, 0.429219254f,
+    0.431741047f, 0.434268189f, 0.436800656f, 0.439338424f, 0.441881469f,
+    0.444429767f, 0.446983294f, 0.449542027f, 0.452105941f, 0.454675012f,
+    0.457249215f, 0.459828527f, 0.462412924f, 0.465002380f, 0.467596872f,
+    0.470196375f, 0.472800865f, 0.475410317f, 0.478024707f, 0.480644010f,
+    0.483268201f, 0.485897256f, 0.488531150f, 0.491169857f, 0.493813355f,
+    0.496461616f, 0.499114617f, 0.501772333f, 0.504434738f, 0.507101808f,
+    0.509773517f, 0.512449840f, 0.515130752f, 0.517816228f, 0.520506242f,
+    0.523200770f, 0.525899785f, 0.528603263f, 0.531311178f, 0.534023504f,
+    0.536740216f, 0.539461289f, 0.542186696f, 0.544916413f, 0.547650413f,
+    0.550388670f, 0.553131160f, 0.555877855f, 0.558628731f, 0.561383761f,
+    0.564142920f, 0.566906181f, 0.569673519f, 0.572444907f, 0.575220319f,
+    0.577999729f, 0.580783112f, 0.583570440f, 0.586361688f, 0.589156829f,
+    0.591955837f, 0.594758686f, 0.597565349f, 0.600375800f, 0.603190013f,
+    0.606007960f, 0.608829616f, 0.611654953f, 0.614483946f, 0.617316568f,
+    0.620152791f, 0.622992590f, 0.625835937f, 0.628682806f, 0.631533170f,
+    0.634387002f, 0.637244276f, 0.640104963f, 0.642969039f, 0.645836475f,
+    0.648707244f, 0.651581320f, 0.654458675f, 0.657339283f, 0.660223116f,
+    0.663110147f, 0.666000349f, 0.668893694f, 0.671790156f, 0.674689708f,
+    0.677592321f, 0.680497969f, 0.683406624f, 0.686318260f, 0.689232847f,
+    0.692150360f, 0.695070770f, 0.697994051f, 0.700920174f, 0.703849112f,
+    0.706780837f, 0.709715323f, 0.712652540f, 0.715592463f, 0.718535062f,
+    0.721480311f, 0.724428181f, 0.727378645f, 0.730331674f, 0.733287243f,
+    0.736245321f, 0.739205882f, 0.742168898f, 0.745134340f, 0.748102182f,
+    0.751072394f, 0.754044950f, 0.757019820f, 0.759996978f, 0.762976394f,
+    0.765958041f, 0.768941892f, 0.771927917f, 0.774916089f, 0.777906379f,
+    0.780898760f, 0.783893203f, 0.786889680f, 0.789888163f, 0.792888624f,
+    0.795891034f, 0.798895365f, 0.801901589f, 0.804909678f, 0.807919603f,
+    0.810931336f, 0.813944848f, 0.816960112f, 0.819977099f, 0.822995780f,
+    0.826016127f, 0.829038111f, 0.832061705f, 0.835086880f, 0.838113606f,
+    0.841141857f, 0.844171602f, 0.847202815f, 0.850235465f, 0.853269526f,
+    0.856304967f, 0.859341761f, 0.862379878f, 0.865419291f, 0.868459971f,
+    0.871501889f, 0.874545017f, 0.877589325f, 0.880634785f, 0.883681369f,
+    0.886729048f, 0.889777793f, 0.892827575f, 0.895878366f, 0.898930137f,
+    0.901982860f, 0.905036505f, 0.908091044f, 0.911146447f, 0.914202688f,
+    0.917259735f, 0.920317562f, 0.923376139f, 0.926435436f, 0.929495427f,
+    0.932556080f, 0.935617369f, 0.938679264f, 0.941741735f, 0.944804756f,
+    0.947868295f, 0.950932326f, 0.953996818f, 0.957061743f, 0.960127072f,
+    0.963192777f, 0.966258828f, 0.969325197f, 0.972391854f, 0.975458771f,
+    0.978525920f, 0.981593270f, 0.984660794f, 0.987728462f, 0.990796245f,
+    0.993864115f, 0.996932043f, 1.000000000f, 1.003067957f, 1.006135885f,
+    1.009203755f, 1.012271538f, 1.015339206f, 1.018406730f, 1.021474080f,
+    1.024541229f, 1.027608146f, 1.030674803f, 1.033741172f, 1.036807223f,
+    1.039872928f, 1.042938257f, 1.046003182f, 1.049067674f, 1.052131705f,
+    1.055195244f, 1.058258265f, 1.061320736f, 1.064382631f, 1.067443920f,
+    1.070504573f, 1.073564564f, 1.076623861f, 1.079682438f, 1.082740265f,
+    1.085797312f, 1.088853553f, 1.091908956f, 1.094963495f, 1.098017140f,
+    1.101069863f, 1.104121634f, 1.107172425f, 1.110222207f, 1.113270952f,
+    1.116318631f, 1.119365215f, 1.122410675f, 1.125454983f, 1.128498111f,
+    1.131540029f, 1.134580709f, 1.137620122f, 1.140658239f, 1.143695033f,
+    1.146730474f, 1.149764535f, 1.152797185f, 1.155828398f, 1.158858143f,
+    1.161886394f, 1.164913120f, 1.167938295f, 1.170961889f, 1.173983873f,
+    1.177004220f, 1.180022901f, 1.183039888f, 1.186055152f, 1.189068664f,
+    1.192080397f, 1.195090322f, 1.198098411f, 1.201104635f, 1.204108966f,
+    1.207111376f, 1.210111837f, 1.213110320f, 1.216106797f, 1.219101240f,
+    1.222093621f, 1.225083911f, 1.228072083f, 1.231058108f, 1.234041959f,
+    1.237023606f, 1.240003022f, 1.242980180f, 1.245955050f, 1.248927606f,
+    1.251897818f, 1.254865660f, 1.257831102f, 1.260794118f, 1.263754679f,
+    1.266712757f, 1.269668326f, 1.272621355f, 1.275571819f, 1.278519689f,
+    1.281464938f, 1.284407537f, 1.287347460f, 1.290284677f, 1.293219163f,
+    1.296150888f, 1.299079826f, 1.302005949f, 1.304929230f, 1.307849640f,
+    1.310767153f, 1.313681740f, 1.316593376f, 1.319502031f, 1.322407679f,
+    1.325310292f, 1.328209844f, 1.331106306f, 1.333999651f, 1.336889853f,
+    1.339776884f, 1.342660717f, 1.345541325f, 1.348418680f, 1.351292756f,
+    1.354163525f, 1.357030961f, 1.359895037f, 1.362755724f, 1.365612998f,
+    1.368466830f, 1.371317194f, 1.374164063f, 1.377007410f, 1.379847209f,
+    1.382683432f, 1.385516054f, 1.388345047f, 1.391170384f, 1.393992040f,
+    1.396809987f, 1.399624200f, 1.402434651f, 1.405241314f, 1.408044163f,
+    1.410843171f, 1.413638312f, 1.416429560f, 1.419216888f, 1.422000271f,
+    1.424779681f, 1.427555093f, 1.430326481f, 1.433093819f, 1.435857080f,
+    1.438616239f, 1.441371269f, 1.444122145f, 1.446868840f, 1.449611330f,
+    1.452349587f, 1.455083587f, 1.457813304f, 1.460538711f, 1.463259784f,
+    1.465976496f, 1.468688822f, 1.471396737f, 1.474100215f, 1.476799230f,
+    1.479493758f, 1.482183772f, 1.484869248f, 1.487550160f, 1.490226483f,
+    1.492898192f, 1.495565262f, 1.498227667f, 1.500885383f, 1.503538384f,
+    1.506186645f, 1.508830143f, 1.511468850f, 1.514102744f, 1.516731799f,
+    1.519355990f, 1.521975293f, 1.524589683f, 1.527199135f, 1.529803625f,
+    1.532403128f, 1.534997620f, 1.537587076f, 1.540171473f, 1.542750785f,
+    1.545324988f, 1.547894059f, 1.550457973f, 1.553016706f, 1.555570233f,
+    1.558118531f, 1.560661576f, 1.563199344f, 1.565731811f, 1.568258953f,
+    1.570780746f, 1.573297167f, 1.575808191f, 1.578313796f, 1.580813958f,
+    1.583308653f, 1.585797857f, 1.588281548f, 1.590759702f, 1.593232295f,
+    1.595699304f, 1.598160707f, 1.600616479f, 1.603066599f, 1.605511041f,
+    1.607949785f, 1.610382806f, 1.612810082f, 1.615231591f, 1.617647308f,
+    1.620057212f, 1.622461279f, 1.624859488f, 1.627251815f, 1.629638239f,
+    1.632018736f, 1.634393284f, 1.636761861f, 1.639124445f, 1.641481013f,
+    1.643831543f, 1.646176013f, 1.648514401f, 1.650846685f, 1.653172843f,
+    1.655492853f, 1.657806693f, 1.660114342f, 1.662415778f, 1.664710978f,
+    1.666999922f, 1.669282588f, 1.671558955f, 1.673829000f, 1.676092704f,
+    1.678350043f, 1.680600998f, 1.682845546f, 1.685083668f, 1.687315341f,
+    1.689540545f, 1.691759258f, 1.693971461f, 1.696177131f, 1.698376249f,
+    1.700568794f, 1.702754744f, 1.704934080f, 1.707106781f, 1.709272826f,
+    1.711432196f, 1.713584869f, 1.715730825f, 1.717870045f, 1.720002508f,
+    1.722128194f, 1.724247083f, 1.726359155f, 1.728464390f, 1.730562769f,
+    1.732654272f, 1.734738878f, 1.736816569f, 1.738887324f, 1.740951125f,
+    1.743007952f, 1.745057785f, 1.747100606f, 1.749136395f, 1.751165132f,
+    1.753186799f, 1.755201377f, 1.757208847f, 1.759209189f, 1.761202385f,
+    1.763188417f, 1.765167266f, 1.767138912f, 1.769103338f, 1.771060524f,
+    1.773010453f, 1.774953107f, 1.776888466f, 1.778816512f, 1.780737229f,
+    1.782650596f, 1.784556597f, 1.786455214f, 1.788346428f, 1.790230221f,
+    1.792106577f, 1.793975478f, 1.795836905f, 1.797690841f, 1.799537269f,
+    1.801376172f, 1.803207531f, 1.805031331f, 1.806847554f, 1.808656182f,
+    1.810457198f, 1.812250587f, 1.814036330f, 1.815814411f, 1.817584813f,
+    1.819347520f, 1.821102515f, 1.822849781f, 1.824589303f, 1.826321063f,
+    1.828045045f, 1.829761234f, 1.831469612f, 1.833170165f, 1.834862875f,
+    1.836547727f, 1.838224706f, 1.839893794f, 1.841554977f, 1.843208240f,
+    1.844853565f, 1.846490939f, 1.848120345f, 1.849741768f, 1.851355193f,
+    1.852960605f, 1.854557988f, 1.856147328f, 1.857728610f, 1.859301818f,
+    1.860866939f, 1.862423956f, 1.863972856f, 1.865513624f, 1.867046246f,
+    1.868570706f, 1.870086991f, 1.871595087f, 1.873094978f, 1.874586652f,
+    1.876070094f, 1.877545290f, 1.879012226f, 1.880470889f, 1.881921264f,
+    1.883363339f, 1.884797098f, 1.886222530f, 1.887639620f, 1.889048356f,
+    1.890448723f, 1.891840709f, 1.893224301f, 1.894599486f, 1.895966250f,
+    1.897324581f, 1.898674466f, 1.900015892f, 1.901348847f, 1.902673318f,
+    1.903989293f, 1.905296759f, 1.906595705f, 1.907886116f, 1.909167983f,
+    1.910441292f, 1.911706032f, 1.912962190f, 1.914209756f, 1.915448716f,
+    1.916679060f, 1.917900776f, 1.919113852f, 1.920318277f, 1.921514039f,
+    1.922701128f, 1.923879533f, 1.925049241f, 1.926210242f, 1.927362526f,
+    1.928506080f, 1.929640896f, 1.930766961f, 1.931884266f, 1.932992799f,
+    1.934092550f, 1.935183510f, 1.936265667f, 1.937339012f, 1.938403534f,
+    1.939459224f, 1.940506071f, 1.941544065f, 1.942573198f, 1.943593458f,
+    1.944604837f, 1.945607325f, 1.946600913f, 1.947585591f, 1.948561350f,
+    1.949528181f, 1.950486074f, 1.951435021f, 1.952375013f, 1.953306040f,
+    1.954228095f, 1.955141168f, 1.956045251f, 1.956940336f, 1.957826413f,
+    1.958703475f, 1.959571513f, 1.960430519f, 1.961280486f, 1.962121404f,
+    1.962953267f, 1.963776066f, 1.964589793f, 1.965394442f, 1.966190003f,
+    1.966976471f, 1.967753837f, 1.968522094f, 1.969281235f, 1.970031253f,
+    1.970772141f, 1.971503891f, 1.972226497f, 1.972939952f, 1.973644250f,
+    1.974339383f, 1.975025345f, 1.975702130f, 1.976369731f, 1.977028143f,
+    1.977677358f, 1.978317371f, 1.978948175f, 1.979569766f, 1.980182136f,
+    1.980785280f, 1.981379193f, 1.981963869f, 1.982539302f, 1.983105487f,
+    1.983662419f, 1.984210092f, 1.984748502f, 1.985277642f, 1.985797509f,
+    1.986308097f, 1.986809402f, 1.987301418f, 1.987784142f, 1.988257568f,
+    1.988721692f, 1.989176510f, 1.989622017f, 1.990058210f, 1.990485084f,
+    1.990902635f, 1.991310860f, 1.991709754f, 1.992099313f, 1.992479535f,
+    1.992850414f, 1.993211949f, 1.993564136f, 1.993906970f, 1.994240449f,
+    1.994564571f, 1.994879331f, 1.995184727f, 1.995480755f, 1.995767414f,
+    1.996044701f, 1.996312612f, 1.996571146f, 1.996820299f, 1.997060070f,
+    1.997290457f, 1.997511456f, 1.997723067f, 1.997925286f, 1.998118113f,
+    1.998301545f, 1.998475581f, 1.998640218f, 1.998795456f, 1.998941293f,
+    1.999077728f, 1.999204759f, 1.999322385f, 1.999430605f, 1.999529418f,
+    1.999618822f, 1.999698819f, 1.999769405f, 1.999830582f, 1.999882347f,
+    1.999924702f, 1.999957645f, 1.999981175f, 1.999995294f, 2.000000000f,
+    1.999995294f, 1.999981175f, 1.999957645f, 1.999924702f, 1.999882347f,
+    1.999830582f, 1.999769405f, 1.999698819f, 1.999618822f, 1.999529418f,
+    1.999430605f, 1.999322385f, 1.999204759f, 1.999077728f, 1.998941293f,
+    1.998795456f, 1.998640218f, 1.998475581f, 1.998301545f, 1.998118113f,
+    1.997925286f, 1.997723067f, 1.997511456f, 1.997290457f, 1.997060070f,
+    1.996820299f, 1.996571146f, 1.996312612f, 1.996044701f, 1.995767414f,
+    1.995480755f, 1.995184727f, 1.994879331f, 1.994564571f, 1.994240449f,
+    1.993906970f, 1.993564136f, 1.993211949f, 1.992850414f, 1.992479535f,
+    1.992099313f, 1.991709754f, 1.991310860f, 1.990902635f, 1.990485084f,
+    1.990058210f, 1.989622017f, 1.989176510f, 1.988721692f, 1.988257568f,
+    1.987784142f, 1.987301418f, 1.986809402f, 1.986308097f, 1.985797509f,
+    1.985277642f, 1.984748502f, 1.984210092f, 1.983662419f, 1.983105487f,
+    1.982539302f, 1.981963869f, 1.981379193f, 1.980785280f, 1.980182136f,
+    1.979569766f, 1.978948175f, 1.978317371f, 1.977677358f, 1.977028143f,
+    1.976369731f, 1.975702130f, 1.975025345f, 1.974339383f, 1.973644250f,
+    1.972939952f, 1.972226497f, 1.971503891f, 1.970772141f, 1.970031253f,
+    1.969281235f, 1.968522094f, 1.967753837f, 1.966976471f, 1.966190003f,
+    1.965394442f, 1.964589793f, 1.963776066f, 1.962953267f, 1.962121404f,
+    1.961280486f, 1.960430519f, 1.959571513f, 1.958703475f, 1.957826413f,
+    1.956940336f, 1.956045251f, 1.955141168f, 1.954228095f, 1.953306040f,
+    1.952375013f, 1.951435021f, 1.950486074f, 1.949528181f, 1.948561350f,
+    1.947585591f, 1.946600913f, 1.945607325f, 1.944604837f, 1.943593458f,
+    1.942573198f, 1.941544065f, 1.940506071f, 1.939459224f, 1.938403534f,
+    1.937339012f, 1.936265667f, 1.935183510f, 1.934092550f, 1.932992799f,
+    1.931884266f, 1.930766961f, 1.929640896f, 1.928506080f, 1.927362526f,
+    1.926210242f, 1.925049241f, 1.923879533f, 1.922701128f, 1.921514039f,
+    1.920318277f, 1.919113852f, 1.917900776f, 1.916679060f, 1.915448716f,
+    1.914209756f, 1.912962190f, 1.911706032f, 1.910441292f, 1.909167983f,
+    1.907886116f, 1.906595705f, 1.905296759f, 1.903989293f, 1.902673318f,
+    1.901348847f, 1.900015892f, 1.898674466f, 1.897324581f, 1.895966250f,
+    1.894599486f, 1.893224301f, 1.891840709f, 1.890448723f, 1.889048356f,
+    1.887639620f, 1.886222530f, 1.884797098f, 1.883363339f, 1.881921264f,
+    1.880470889f, 1.879012226f, 1.877545290f, 1.876070094f, 1.874586652f,
+    1.873094978f, 1.871595087f, 1.870086991f, 1.868570706f, 1.867046246f,
+    1.865513624f, 1.863972856f, 1.862423956f, 1.860866939f, 1.859301818f,
+    1.857728610f, 1.856147328f, 1.854557988f, 1.852960605f, 1.851355193f,
+    1.849741768f, 1.848120345f, 1.846490939f, 1.844853565f, 1.843208240f,
+    1.841554977f, 1.839893794f, 1.838224706f, 1.836547727f, 1.834862875f,
+    1.833170165f, 1.831469612f, 1.829761234f, 1.828045045f, 1.826321063f,
+    1.824589303f, 1.822849781f, 1.821102515f, 1.819347520f, 1.817584813f,
+    1.815814411f, 1.814036330f, 1.812250587f, 1.810457198f, 1.808656182f,
+    1.806847554f, 1.805031331f, 1.803207531f, 1.801376172f, 1.799537269f,
+    1.797690841f, 1.795836905f, 1.793975478f, 1.792106577f, 1.790230221f,
+    1.788346428f, 1.786455214f, 1.784556597f, 1.782650596f, 1.780737229f,
+    1.778816512f, 1.776888466f, 1.774953107f, 1.773010453f, 1.771060524f,
+    1.769103338f, 1.767138912f, 1.765167266f, 1.763188417f, 1.761202385f,
+    1.759209189f, 1.757208847f, 1.755201377f, 1.753186799f, 1.751165132f,
+    1.749136395f, 1.747100606f, 1.745057785f, 1.743007952f, 1.740951125f,
+    1.738887324f, 1.736816569f, 1.734738878f, 1.732654272f, 1.730562769f,
+    1.728464390f, 1.726359155f, 1.724247083f, 1.722128194f, 1.720002508f,
+    1.717870045f, 1.715730825f, 1.713584869f, 1.711432196f, 1.709272826f,
+    1.707106781f, 1.704934080f, 1.702754744f, 1.700568794f, 1.698376249f,
+    1.696177131f, 1.693971461f, 1.691759258f, 1.689540545f, 1.687315341f,
+    1.685083668f, 1.682845546f, 1.680600998f, 1.678350043f, 1.676092704f,
+    1.673829000f, 1.671558955f, 1.669282588f, 1.666999922f, 1.664710978f,
+    1.662415778f, 1.660114342f, 1.657806693f, 1.655492853f, 1.653172843f,
+    1.650846685f, 1.648514401f, 1.646176013f, 1.643831543f, 1.641481013f,
+    1.639124445f, 1.636761861f, 1.634393284f, 1.632018736f, 1.629638239f,
+    1.627251815f, 1.624859488f, 1.622461279f, 1.620057212f, 1.617647308f,
+    1.615231591f, 1.612810082f, 1.610382806f, 1.607949785f, 1.605511041f,
+    1.603066599f, 1.600616479f, 1.598160707f, 1.595699304f, 1.593232295f,
+    1.590759702f, 1.588281548f, 1.585797857f, 1.583308653f, 1.580813958f,
+    1.578313796f, 1.575808191f, 1.573297167f, 1.570780746f, 1.568258953f,
+    1.565731811f, 1.563199344f, 1.560661576f, 1.558118531f, 1.555570233f,
+    1.553016706f, 1.550457973f, 1.547894059f, 1.545324988f, 1.542750785f,
+    1.540171473f, 1.537587076f, 1.534997620f, 1.532403128f, 1.529803625f,
+    1.527199135f, 1.524589683f, 1.521975293f, 1.519355990f, 1.516731799f,
+    1.514102744f, 1.511468850f, 1.508830143f, 1.506186645f, 1.503538384f,
+    1.500885383f, 1.498227667f, 1.495565262f, 1.492898192f, 1.490226483f,
+    1.487550160f, 1.484869248f, 1.482183772f, 1.479493758f, 1.476799230f,
+    1.474100215f, 1.471396737f, 1.468688822f, 1.465976496f, 1.463259784f,
+    1.460538711f, 1.457813304f, 1.455083587f, 1.452349587f, 1.449611330f,
+    1.446868840f, 1.444122145f, 1.441371269f, 1.438616239f, 1.435857080f,
+    1.433093819f, 1.430326481f, 1.427555093f, 1.424779681f, 1.422000271f,
+    1.419216888f, 1.416429560f, 1.413638312f, 1.410843171f, 1.408044163f,
+    1.405241314f, 1.402434651f, 1.399624200f, 1.396809987f, 1.393992040f,
+    1.391170384f, 1.388345047f, 1.385516054f, 1.382683432f, 1.379847209f,
+    1.377007410f, 1.374164063f, 1.371317194f, 1.368466830f, 1.365612998f,
+    1.362755724f, 1.359895037f, 1.357030961f, 1.354163525f, 1.351292756f,
+    1.348418680f, 1.345541325f, 1.342660717f, 1.339776884f, 1.336889853f,
+    1.333999651f, 1.331106306f, 1.328209844f, 1.325310292f, 1.322407679f,
+    1.319502031f, 1.316593376f, 1.313681740f, 1.310767153f, 1.307849640f,
+    1.304929230f, 1.302005949f, 1.299079826f, 1.296150888f, 1.293219163f,
+    1.290284677f, 1.287347460f, 1.284407537f, 1.281464938f, 1.278519689f,
+    1.275571819f, 1.272621355f, 1.269668326f, 1.266712757f, 1.263754679f,
+    1.260794118f, 1.257831102f, 1.254865660f, 1.251897818f, 1.248927606f,
+    1.245955050f, 1.242980180f, 1.240003022f, 1.237023606f, 1.234041959f,
+    1.231058108f, 1.228072083f, 1.225083911f, 1.222093621f, 1.219101240f,
+    1.216106797f, 1.213110320f, 1.210111837f, 1.207111376f, 1.204108966f,
+    1.201104635f, 1.198098411f, 1.195090322f, 1.192080397f, 1.189068664f,
+    1.186055152f, 1.183039888f, 1.180022901f, 1.177004220f, 1.173983873f,
+    1.170961889f, 1.167938295f, 1.164913120f, 1.161886394f, 1.158858143f,
+    1.155828398f, 1.152797185f, 1.149764535f, 1.146730474f, 1.143695033f,
+    1.140658239f, 1.137620122f, 1.134580709f, 1.131540029f, 1.128498111f,
+    1.125454983f, 1.122410675f, 1.119365215f, 1.116318631f, 1.113270952f,
+    1.110222207f, 1.107172425f, 1.104121634f, 1.101069863f, 1.098017140f,
+    1.094963495f, 1.091908956f, 1.088853553f, 1.085797312f, 1.082740265f,
+    1.079682438f, 1.076623861f, 1.073564564f, 1.070504573f, 1.067443920f,
+    1.064382631f, 1.061320736f, 1.058258265f, 1.055195244f, 1.052131705f,
+    1.049067674f, 1.046003182f, 1.042938257f, 1.039872928f, 1.036807223f,
+    1.033741172f, 1.030674803f, 1.027608146f, 1.024541229f, 1.021474080f,
+    1.018406730f, 1.015339206f, 1.012271538f, 1.009203755f, 1.006135885f,
+    1.003067957f, 1.000000000f, 0.996932043f, 0.993864115f, 0.990796245f,
+    0.987728462f, 0.984660794f, 0.981593270f, 0.978525920f, 0.975458771f,
+    0.972391854f, 0.969325197f, 0.966258828f, 0.963192777f, 0.960127072f,
+    0.957061743f, 0.953996818f, 0.950932326f, 0.947868295f, 0.944804756f,
+    0.941741735f, 0.938679264f, 0.935617369f, 0.932556080f, 0.929495427f,
+    0.926435436f, 0.923376139f, 0.920317562f, 0.917259735f, 0.914202688f,
+    0.911146447f, 0.908091044f, 0.905036505f, 0.901982860f, 0.898930137f,
+    0.895878366f, 0.892827575f, 0.889777793f, 0.886729048f, 0.883681369f,
+    0.880634785f, 0.877589325f, 0.874545017f, 0.871501889f, 0.868459971f,
+    0.865419291f, 0.862379878f, 0.859341761f, 0.856304967f, 0.853269526f,
+    0.850235465f, 0.847202815f, 0.844171602f, 0.841141857f, 0.838113606f,
+    0.835086880f, 0.832061705f, 0.829038111f, 0.826016127f, 0.822995780f,
+    0.819977099f, 0.816960112f, 0.813944848f, 0.810931336f, 0.807919603f,
+    0.804909678f, 0.801901589f, 0.798895365f, 0.795891034f, 0.792888624f,
+    0.789888163f, 0.786889680f, 0.783893203f, 0.780898760f, 0.777906379f,
+    0.774916089f, 0.771927917f, 0.768941892f, 0.765958041f, 0.762976394f,
+    0.759996978f, 0.757019820f, 0.754044950f, 0.751072394f, 0.748102182f,
+    0.745134340f, 0.742168898f, 0.739205882f, 0.736245321f, 0.733287243f,
+    0.730331674f, 0.727378645f, 0.724428181f, 0.721480311f, 0.718535062f,
+    0.715592463f, 0.712652540f, 0.709715323f, 0.706780837f, 0.703849112f,
+    0.700920174f, 0.697994051f, 0.695070770f, 0.692150360f, 0.689232847f,
+    0.686318260f, 0.683406624f, 0.680497969f, 0.677592321f, 0.674689708f,
+    0.671790156f, 0.668893694f, 0.666000349f, 0.663110147f, 0.660223116f,
+    0.657339283f, 0.654458675f, 0.651581320f, 0.648707244f, 0.645836475f,
+    0.642969039f, 0.640104963f, 0.637244276f, 0.634387002f, 0.631533170f,
+    0.628682806f, 0.625835937f, 0.622992590f, 0.620152791f, 0.617316568f,
+    0.614483946f, 0.611654953f, 0.608829616f, 0.606007960f, 0.603190013f,
+    0.600375800f, 0.597565349f, 0.594758686f, 0.591955837f, 0.589156829f,
+    0.586361688f, 0.583570440f, 0.580783112f, 0.577999729f, 0.575220319f,
+    0.572444907f, 0.569673519f, 0.566906181f, 0.564142920f, 0.561383761f,
+    0.558628731f, 0.555877855f, 0.553131160f, 0.550388670f, 0.547650413f,
+    0.544916413f, 0.542186696f, 0.539461289f, 0.536740216f, 0.534023504f,
+    0.531311178f, 0.528603263f, 0.525899785f, 0.523200770f, 0.520506242f,
+    0.517816228f, 0.515130752f, 0.512449840f, 0.509773517f, 0.507101808f,
+    0.504434738f, 0.501772333f, 0.499114617f, 0.496461616f, 0.493813355f,
+    0.491169857f, 0.488531150f, 0.485897256f, 0.483268201f, 0.480644010f,
+    0.478024707f, 0.475410317f, 0.472800865f, 0.470196375f, 0.467596872f,
+    0.465002380f, 0.462412924f, 0.459828527f, 0.457249215f, 0.454675012f,
+    0.452105941f, 0.449542027f, 0.446983294f, 0.444429767f, 0.441881469f,
+    0.439338424f, 0.436800656f, 0.434268189f, 0.431741047f, 0.429219254f,
+    0.426702833f, 0.424191809f, 0.421686204f, 0.419186042f, 0.416691347f,
+    0.414202143f, 0.411718452f, 0.409240298f, 0.406767705f, 0.404300696f,
+    0.401839293f, 0.399383521f, 0.396933401f, 0.394488959f, 0.392050215f,
+    0.389617194f, 0.387189918f, 0.384768409f, 0.382352692f, 0.379942788f,
+    0.377538721f, 0.375140512f, 0.372748185f, 0.370361761f, 0.367981264f,
+    0.365606716f, 0.363238139f, 0.360875555f, 0.358518987f, 0.356168457f,
+    0.353823987f, 0.351485599f, 0.349153315f, 0.346827157f, 0.344507147f,
+    0.342193307f, 0.339885658f, 0.337584222f, 0.335289022f, 0.333000078f,
+    0.330717412f, 0.328441045f, 0.326171000f, 0.323907296f, 0.321649957f,
+    0.319399002f, 0.317154454f, 0.314916332f, 0.312684659f, 0.310459455f,
+    0.308240742f, 0.306028539f, 0.303822869f, 0.301623751f, 0.299431206f,
+    0.297245256f, 0.295065920f, 0.292893219f, 0.290727174f, 0.288567804f,
+    0.286415131f, 0.284269175f, 0.282129955f, 0.279997492f, 0.277871806f,
+    0.275752917f, 0.273640845f, 0.271535610f, 0.269437231f, 0.267345728f,
+    0.265261122f, 0.263183431f, 0.261112676f, 0.259048875f, 0.256992048f,
+    0.254942215f, 0.252899394f, 0.250863605f, 0.248834868f, 0.246813201f,
+    0.244798623f, 0.242791153f, 0.240790811f, 0.238797615f, 0.236811583f,
+    0.234832734f, 0.232861088f, 0.230896662f, 0.228939476f, 0.226989547f,
+    0.225046893f, 0.223111534f, 0.221183488f, 0.219262771f, 0.217349404f,
+    0.215443403f, 0.213544786f, 0.211653572f, 0.209769779f, 0.207893423f,
+    0.206024522f, 0.204163095f, 0.202309159f, 0.200462731f, 0.198623828f,
+    0.196792469f, 0.194968669f, 0.193152446f, 0.191343818f, 0.189542802f,
+    0.187749413f, 0.185963670f, 0.184185589f, 0.182415187f, 0.180652480f,
+    0.178897485f, 0.177150219f, 0.175410697f, 0.173678937f, 0.171954955f,
+    0.170238766f, 0.168530388f, 0.166829835f, 0.165137125f, 0.163452273f,
+    0.161775294f, 0.160106206f, 0.158445023f, 0.156791760f, 0.155146435f,
+    0.153509061f, 0.151879655f, 0.150258232f, 0.148644807f, 0.147039395f,
+    0.145442012f, 0.143852672f, 0.142271390f, 0.140698182f, 0.139133061f,
+    0.137576044f, 0.136027144f, 0.134486376f, 0.132953754f, 0.131429294f,
+    0.129913009f, 0.128404913f, 0.126905022f, 0.125413348f, 0.123929906f,
+    0.122454710f, 0.120987774f, 0.119529111f, 0.118078736f, 0.116636661f,
+    0.115202902f, 0.113777470f, 0.112360380f, 0.110951644f, 0.109551277f,
+    0.108159291f, 0.106775699f, 0.105400514f, 0.104033750f, 0.102675419f,
+    0.101325534f, 0.099984108f, 0.098651153f, 0.097326682f, 0.096010707f,
+    0.094703241f, 0.093404295f, 0.092113884f, 0.090832017f, 0.089558708f,
+    0.088293968f, 0.087037810f, 0.085790244f, 0.084551284f, 0.083320940f,
+    0.082099224f, 0.080886148f, 0.079681723f, 0.078485961f, 0.077298872f,
+    0.076120467f, 0.074950759f, 0.073789758f, 0.072637474f, 0.071493920f,
+    0.070359104f, 0.069233039f, 0.068115734f, 0.067007201f, 0.065907450f,
+    0.064816490f, 0.063734333f, 0.062660988f, 0.061596466f, 0.060540776f,
+    0.059493929f, 0.058455935f, 0.057426802f, 0.056406542f, 0.055395163f,
+    0.054392675f, 0.053399087f, 0.052414409f, 0.051438650f, 0.050471819f,
+    0.049513926f, 0.048564979f, 0.047624987f, 0.046693960f, 0.045771905f,
+    0.044858832f, 0.043954749f, 0.043059664f, 0.042173587f, 0.041296525f,
+    0.040428487f, 0.039569481f, 0.038719514f, 0.037878596f, 0.037046733f,
+    0.036223934f, 0.035410207f, 0.034605558f, 0.033809997f, 0.033023529f,
+    0.032246163f, 0.031477906f, 0.030718765f, 0.029968747f, 0.029227859f,
+    0.028496109f, 0.027773503f, 0.027060048f, 0.026355750f, 0.025660617f,
+    0.024974655f, 0.024297870f, 0.023630269f, 0.022971857f, 0.022322642f,
+    0.021682629f, 0.021051825f, 0.020430234f, 0.019817864f, 0.019214720f,
+    0.018620807f, 0.018036131f, 0.017460698f, 0.016894513f, 0.016337581f,
+    0.015789908f, 0.015251498f, 0.014722358f, 0.014202491f, 0.013691903f,
+    0.013190598f, 0.012698582f, 0.012215858f, 0.011742432f, 0.011278308f,
+    0.010823490f, 0.010377983f, 0.009941790f, 0.009514916f, 0.009097365f,
+    0.008689140f, 0.008290246f, 0.007900687f, 0.007520465f, 0.007149586f,
+    0.006788051f, 0.006435864f, 0.006093030f, 0.005759551f, 0.005435429f,
+    0.005120669f, 0.004815273f, 0.004519245f, 0.004232586f, 0.003955299f,
+    0.003687388f, 0.003428854f, 0.003179701f, 0.002939930f, 0.002709543f,
+    0.002488544f, 0.002276933f, 0.002074714f, 0.001881887f, 0.001698455f,
+    0.001524419f, 0.001359782f, 0.001204544f, 0.001058707f, 0.000922272f,
+    0.000795241f, 0.000677615f, 0.000569395f, 0.000470582f, 0.000381178f,
+    0.000301181f, 0.000230595f, 0.000169418f, 0.000117653f, 0.000075298f,
+    0.000042355f, 0.000018825f, 0.000004706f,
+};
+
+const uint16_t fft_bit_reverse[NUM_SAMPLES] = {
+       0, 1024,  512, 1536,  256, 1280,  768, 1792,  128, 1152,  640, 1664,
+     384, 1408,  896, 1920,   64, 1088,  576, 1600,  320, 1344,  832, 1856,
+     192, 1216,  704, 1728,  448, 1472,  960, 1984,   32, 1056,  544, 1568,
+     288, 1312,  800, 1824,  160, 1184,  672, 1696,  416, 1440,  928, 1952,
+      96, 1120,  608, 1632,  352, 1376,  864, 1888,  224, 1248,  736, 1760,
+     480, 1504,  992, 2016,   16, 1040,  528, 1552,  272, 1296,  784, 1808,
+     144, 1168,  656, 1680,  400, 1424,  912, 1936,   80, 1104,  592, 1616,
+     336, 1360,  848, 1872,  208, 1232,  720, 1744,  464, 1488,  976, 2000,
+      48, 1072,  560, 1584,  304, 1328,  816, 1840,  176, 1200,  688, 1712,
+     432, 1456,  944, 1968,  112, 1136,  624, 1648,  368, 1392,  880, 1904,
+     240, 1264,  752, 1776,  496, 1520, 1008, 2032,    8, 1032,  520, 1544,
+     264, 1288,  776, 1800,  136, 1160,  648, 1672,  392, 1416,  904, 1928,
+      72, 1096,  584, 1608,  328, 1352,  840, 1864,  200, 1224,  712, 1736,
+     456, 1480,  968, 1992,   40, 1064,  552, 1576,  296, 1320,  808, 1832,
+     168, 1192,  680, 1704,  424, 1448,  936, 1960,  104, 1128,  616, 1640,
+     360, 1384,  872, 1896,  232, 1256,  744, 1768,  488, 1512, 1000, 2024,
+      24, 1048,  536, 1560,  280, 1304,  792, 1816,  152, 1176,  664, 1688,
+     408, 1432,  920, 1944,   88, 1112,  600, 1624,  344, 1368,  856, 1880,
+     216, 1240,  728, 1752,  472, 1496,  984, 2008,   56, 1080,  568, 1592,
+     312, 1336,  824, 1848,  184, 1208,  696, 1720,  440, 1464,  952, 1976,
+     120, 1144,  632, 1656,  376, 1400,  888, 1912,  248, 1272,  760, 1784,
+     504, 1528, 1016, 2040,    4, 1028,  516, 1540,  260, 1284,  772, 1796,
+     132, 1156,  644, 1668,  388, 1412,  900, 1924,   68, 1092,  580, 1604,
+     324, 1348,  836, 1860,  196, 1220,  708, 1732,  452, 1476,  964, 1988,
+      36, 1060,  548, 1572,  292, 1316,  804, 1828,  164, 1188,  676, 1700,
+     420, 1444,  932, 1956,  100, 1124,  612, 1636,  356, 1380,  868, 1892,
+     228, 1252,  740, 1764,  484, 1508,  996, 2020,   20, 1044,  532, 1556,
+     276, 1300,  788, 1812,  148, 1172,  660, 1684,  404, 1428,  916, 1940,
+      84, 1108,  596, 1620,  340, 1364,  852, 1876,  212, 1236,  724, 1748,
+     468, 1492,  980, 2004,   52, 1076,  564, 1588,  308, 1332,  820, 1844,
+     180, 1204,  692, 1716,  436, 1460,  948, 1972,  116, 1140,  628, 1652,
+     372, 1396,  884, 1908,  244, 1268,  756, 1780,  500, 1524, 1012, 2036,
+      12, 1036,  524, 1548,  268, 1292,  780, 1804,  140, 1164,  652, 1676,
+     396, 1420,  908, 1932,   76, 1100,  588, 1612,  332, 1356,  844, 1868,
+     204, 1228,  716, 1740,  460, 1484,  972, 1996,   44, 1068,  556, 1580,
+     300, 1324,  812, 1836,  172, 1196,  684, 1708,  428, 1452,  940, 1964,
+     108, 1132,  620, 1644,  364, 1388,  876, 1900,  236, 1260,  748, 1772,
+     492, 1516, 1004, 2028,   28, 1052,  540, 1564,  284, 1308,  796, 1820,
+     156, 1180,  668, 1692,  412, 1436,  924, 1948,   92, 1116,  604, 1628,
+     348, 1372,  860, 1884,  220, 1244,  732, 1756,  476, 1500,  988, 2012,
+      60, 1084,  572, 1596,  316, 1340,  828, 1852,  188, 1212,  700, 1724,
+     444, 1468,  956, 1980,  124, 1148,  636, 1660,  380, 1404,  892, 1916,
+     252, 1276,  764, 1788,  508, 1532, 1020, 2044,    2, 1026,  514, 1538,
+     258, 1282,  770, 1794,  130, 1154,  642, 1666,  386, 1410,  898, 1922,
+      66, 1090,  578, 1602,  322, 1346,  834, 1858,  194, 1218,  706, 1730,
+     450, 1474,  962, 1986,   34, 1058,  546, 1570,  290, 1314,  802, 1826,
+     162, 1186,  674, 1698,  418, 1442,  930, 1954,   98, 1122,  610, 1634,
+     354, 1378,  866, 1890,  226, 1250,  738, 1762,  482, 1506,  994, 2018,
+      18, 1042,  530, 1554,  274, 1298,  786, 1810,  146, 1170,  658, 1682,
+     402, 1426,  914, 1938,   82, 1106,  594, 1618,  338, 1362,  850, 1874,
+     210, 1234,  722, 1746,  466, 1490,  978, 2002,   50, 1074,  562, 1586,
+     306, 1330,  818, 1842,  178, 1202,  690, 1714,  434, 1458,  946, 1970,
+     114, 1138,  626, 1650,  370, 1394,  882, 1906,  242, 1266,  754, 1778,
+     498, 1522, 1010, 2034,   10, 1034,  522, 1546,  266, 1290,  778, 1802,
+     138, 1162,  650, 1674,  394, 1418,  906, 1930,   74, 1098,  586, 1610,
+     330, 1354,  842, 1866,  202, 1226,  714, 1738,  458, 1482,  970, 1994,
+      42, 1066,  554, 1578,  298, 1322,  810, 1834,  170, 1194,  682, 1706,
+     426, 1450,  938, 1962,  106, 1130,  618, 1642,  362, 1386,  874, 1898,
+     234, 1258,  746, 1770,  490, 1514, 1002, 2026,   26, 1050,  538, 1562,
+     282, 1306,  794, 1818,  154, 1178,  666, 1690,  410, 1434,  922, 1946,
+      90, 1114,  602, 1626,  346, 1370,  858, 1882,  218, 1242,  730, 1754,
+     474, 1498,  986, 2010,   58, 1082,  570, 1594,  314, 1338,  826, 1850,
+     186, 1210,  698, 1722,  442, 1466,  954, 1978,  122, 1146,  634, 1658,
+     378, 1402,  890, 1914,  250, 1274,  762, 1786,  506, 1530, 1018, 2042,
+       6, 1030,  518, 1542,  262, 1286,  774, 1798,  134, 1158,  646, 1670,
+     390, 1414,  902, 1926,   70, 1094,  582, 1606,  326, 1350,  838, 1862,
+     198, 1222,  710, 1734,  454, 1478,  966, 1990,   38, 1062,  550, 1574,
+     294, 1318,  806, 1830,  166, 1190,  678, 1702,  422, 1446,  934, 1958,
+     102, 1126,  614, 1638,  358, 1382,  870, 1894,  230, 1254,  742, 1766,
+     486, 1510,  998, 2022,   22, 1046,  534, 1558,  278, 1302,  790, 1814,
+     150, 1174,  662, 1686,  406, 1430,  918, 1942,   86, 1110,  598, 1622,
+     342, 1366,  854, 1878,  214, 1238,  726, 1750,  470, 1494,  982, 2006,
+      54, 1078,  566, 1590,  310, 1334,  822, 1846,  182, 1206,  694, 1718,
+     438, 1462,  950, 1974,  118, 1142,  630, 1654,  374, 1398,  886, 1910,
+     246, 1270,  758, 1782,  502, 1526, 1014, 2038,   14, 1038,  526, 1550,
+     270, 1294,  782, 1806,  142, 1166,  654, 1678,  398, 1422,  910, 1934,
+      78, 1102,  590, 1614,  334, 1358,  846, 1870,  206, 1230,  718, 1742,
+     462, 1486,  974, 1998,   46, 1070,  558, 1582,  302, 1326,  814, 1838,
+     174, 1198,  686, 1710,  430, 1454,  942, 1966,  110, 1134,  622, 1646,
+     366, 1390,  878, 1902,  238, 1262,  750, 1774,  494, 1518, 1006, 2030,
+      30, 1054,  542, 1566,  286, 1310,  798, 1822,  158, 1182,  670, 1694,
+     414, 1438,  926, 1950,   94, 1118,  606, 1630,  350, 1374,  862, 1886,
+     222, 1246,  734, 1758,  478, 1502,  990, 2014,   62, 1086,  574, 1598,
+     318, 1342,  830, 1854,  190, 1214,  702, 1726,  446, 1470,  958, 1982,
+     126, 1150,  638, 1662,  382, 1406,  894, 1918,  254, 1278,  766, 1790,
+     510, 1534, 1022, 2046,    1, 1025,  513, 1537,  257, 1281,  769, 1793,
+     129, 1153,  641, 1665,  385, 1409,  897, 1921,   65, 1089,  577, 1601,
+     321, 1345,  833, 1857,  193, 1217,  705, 1729,  449, 1473,  961, 1985,
+      33, 1057,  545, 1569,  289, 1313,  801, 1825,  161, 1185,  673, 1697,
+     417, 1441,  929, 1953,   97, 1121,  609, 1633,  353, 1377,  865, 1889,
+     225, 1249,  737, 1761,  481, 1505,  993, 2017,   17, 1041,  529, 1553,
+     273, 1297,  785, 1809,  145, 1169,  657, 1681,  401, 1425,  913, 1937,
+      81, 1105,  593, 1617,  337, 1361,  849, 1873,  209, 1233,  721, 1745,
+     465, 1489,  977, 2001,   49, 1073,  561, 1585,  305, 1329,  817, 1841,
+     177, 1201,  689, 1713,  433, 1457,  945, 1969,  113, 1137,  625, 1649,
+     369, 1393,  881, 1905,  241, 1265,  753, 1777,  497, 1521, 1009, 2033,
+       9, 1033,  521, 1545,  265, 1289,  777, 1801,  137, 1161,  649, 1673,
+     393, 1417,  905, 1929,   73, 1097,  585, 1609,  329, 1353,  841, 1865,
+     201, 1225,  713, 1737,  457, 1481,  969, 1993,   41, 1065,  553, 1577,
+     297, 1321,  809, 1833,  169, 1193,  681, 1705,  425, 1449,  937, 1961,
+     105, 1129,  617, 1641,  361, 1385,  873, 1897,  233, 1257,  745, 1769,
+     489, 1513, 1001, 2025,   25, 1049,  537, 1561,  281, 1305,  793, 1817,
+     153, 1177,  665, 1689,  409, 1433,  921, 1945,   89, 1113,  601, 1625,
+     345, 1369,  857, 1881,  217, 1241,  729, 1753,  473, 1497,  985, 2009,
+      57, 1081,  569, 1593,  313, 1337,  825, 1849,  185, 1209,  697, 1721,
+     441, 1465,  953, 1977,  121, 1145,  633, 1657,  377, 1401,  889, 1913,
+     249, 1273,  761, 1785,  505, 1529, 1017, 2041,    5, 1029,  517, 1541,
+     261, 1285,  773, 1797,  133, 1157,  645, 1669,  389, 1413,  901, 1925,
+      69, 1093,  581, 1605,  325, 1349,  837, 1861,  197, 1221,  709, 1733,
+     453, 1477,  965, 1989,   37, 1061,  549, 1573,  293, 1317,  805, 1829,
+     165, 1189,  677, 1701,  421, 1445,  933, 1957,  101, 1125,  613, 1637,
+     357, 1381,  869, 1893,  229, 1253,  741, 1765,  485, 1509,  997, 2021,
+      21, 1045,  533, 1557,  277, 1301,  789, 1813,  149, 1173,  661, 1685,
+     405, 1429,  917, 1941,   85, 1109,  597, 1621,  341, 1365,  853, 1877,
+     213, 1237,  725, 1749,  469, 1493,  981, 2005,   53, 1077,  565, 1589,
+     309, 1333,  821, 1845,  181, 1205,  693, 1717,  437, 1461,  949, 1973,
+     117, 1141,  629, 1653,  373, 1397,  885, 1909,  245, 1269,  757, 1781,
+     501, 1525, 1013, 2037,   13, 1037,  525, 1549,  269, 1293,  781, 1805,
+     141, 1165,  653, 1677,  397, 1421,  909, 1933,   77, 1101,  589, 1613,
+     333, 1357,  845, 1869,  205, 1229,  717, 1741,  461, 1485,  973, 1997,
+      45, 1069,  557, 1581,  301, 1325,  813, 1837,  173, 1197,  685, 1709,
+     429, 1453,  941, 1965,  109, 1133,  621, 1645,  365, 1389,  877, 1901,
+     237, 1261,  749, 1773,  493, 1517, 1005, 2029,   29, 1053,  541, 1565,
+     285, 1309,  797, 1821,  157, 1181,  669, 1693,  413, 1437,  925, 1949,
+      93, 1117,  605, 1629,  349, 1373,  861, 1885,  221, 1245,  733, 1757,
+     477, 1501,  989, 2013,   61, 1085,  573, 1597,  317, 1341,  829, 1853,
+     189, 1213,  701, 1725,  445, 1469,  957, 1981,  125, 1149,  637, 1661,
+     381, 1405,  893, 1917,  253, 1277,  765, 1789,  509, 1533, 1021, 2045,
+       3, 1027,  515, 1539,  259, 1283,  771, 1795,  131, 1155,  643, 1667,
+     387, 1411,  899, 1923,   67, 1091,  579, 1603,  323, 1347,  835, 1859,
+     195, 1219,  707, 1731,  451, 1475,  963, 1987,   35, 1059,  547, 1571,
+     291, 1315,  803, 1827,  163, 1187,  675, 1699,  419, 1443,  931, 1955,
+      99, 1123,  611, 1635,  355, 1379,  867, 1891,  227, 1251,  739, 1763,
+     483, 1507,  995, 2019,   19, 1043,  531, 1555,  275, 1299,  787, 1811,
+     147, 1171,  659, 1683,  403, 1427,  915, 1939,   83, 1107,  595, 1619,
+     339, 1363,  851, 1875,  211, 1235,  723, 1747,  467, 1491,  979, 2003,
+      51, 1075,  563, 1587,  307, 1331,  819, 1843,  179, 1203,  691, 1715,
+     435, 1459,  947, 1971,  115, 1139,  627, 1651,  371, 1395,  883, 1907,
+     243, 1267,  755, 1779,  499, 1523, 1011, 2035,   11, 1035,  523, 1547,
+     267, 1291,  779, 1803,  139, 1163,  651, 1675,  395, 1419,  907, 1931,
+      75, 1099,  587, 1611,  331, 1355,  843, 1867,  203, 1227,  715, 1739,
+     459, 1483,  971, 1995,   43, 1067,  555, 1579,  299, 1323,  811, 1835,
+     171, 1195,  683, 1707,  427, 1451,  939, 1963,  107, 1131,  619, 1643,
+     363, 1387,  875, 1899,  235, 1259,  747, 1771,  491, 1515, 1003, 2027,
+      27, 1051,  539, 1563,  283, 1307,  795, 1819,  155, 1179,  667, 1691,
+     411, 1435,  923, 1947,   91, 1115,  603, 1627,  347, 1371,  859, 1883,
+     219, 1243,  731, 1755,  475, 1499,  987, 2011,   59, 1083,  571, 1595,
+     315, 1339,  827, 1851,  187, 1211,  699, 1723,  443, 1467,  955, 1979,
+     123, 1147,  635, 1659,  379, 1403,  891, 1915,  251, 1275,  763, 1787,
+     507, 1531, 1019, 2043,    7, 1031,  519, 1543,  263, 1287,  775, 1799,
+     135, 1159,  647, 1671,  391, 1415,  903, 1927,   71, 1095,  583, 1607,
+     327, 1351,  839, 1863,  199, 1223,  711, 1735,  455, 1479,  967, 1991,
+      39, 1063,  551, 1575,  295, 1319,  807, 1831,  167, 1191,  679, 1703,
+     423, 1447,  935, 1959,  103, 1127,  615, 1639,  359, 1383,  871, 1895,
+     231, 1255,  743, 1767,  487, 1511,  999, 2023,   23, 1047,  535, 1559,
+     279, 1303,  791, 1815,  151, 1175,  663, 1687,  407, 1431,  919, 1943,
+      87, 1111,  599, 1623,  343, 1367,  855, 1879,  215, 1239,  727, 1751,
+     471, 1495,  983, 2007,   55, 1079,  567, 1591,  311, 1335,  823, 1847,
+     183, 1207,  695, 1719,  439, 1463,  951, 1975,  119, 1143,  631, 1655,
+     375, 1399,  887, 1911,  247, 1271,  759, 1783,  503, 1527, 1015, 2039,
+      15, 1039,  527, 1551,  271, 1295,  783, 1807,  143, 1167,  655, 1679,
+     399, 1423,  911, 1935,   79, 1103,  591, 1615,  335, 1359,  847, 1871,
+     207, 1231,  719, 1743,  463, 1487,  975, 1999,   47, 1071,  559, 1583,
+     303, 1327,  815, 1839,  175, 1199,  687, 1711,  431, 1455,  943, 1967,
+     111, 1135,  623, 1647,  367, 1391,  879, 1903,  239, 1263,  751, 1775,
+     495, 1519, 1007, 2031,   31, 1055,  543, 1567,  287, 1311,  799, 1823,
+     159, 1183,  671, 1695,  415, 1439,  927, 1951,   95, 1119,  607, 1631,
+     351, 1375,  863, 1887,  223, 1247,  735, 1759,  479, 1503,  991, 2015,
+      63, 1087,  575, 1599,  319, 1343,  831, 1855,  191, 1215,  703, 1727,
+     447, 1471,  959, 1983,  127, 1151,  639, 1663,  383, 1407,  895, 1919,
+     255, 1279,  767, 1791,  511, 1535, 1023, 2047,
+};
+
+#else
+#  error "NUM_SAMPLES must be a power of 2 from 64 to 2048"
+#endif
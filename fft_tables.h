@@ -0,0 +1,27 @@
+//*****************************************************************************
+// FFT Lookup Tables
+// Usage: Constant tables for the NUM_SAMPLES-point FFTs and analysis window, 
+//   generated ahead of time by tools/gen_fft_tables.c so that they live in 
+//   flash.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __FFT_TABLES_H__
+#define __FFT_TABLES_H__
+
+#include <stdint.h>
+#include "fft.h"
+
+// e^(-2*pi*i*k/NUM_SAMPLES) as { real, imaginary } for k < 3*NUM_SAMPLES/4
+extern const float fft_twiddles[3*NUM_SAMPLES/4][2];
+
+// Same twiddle factors for k < NUM_SAMPLES/2 in packed Q15 (see fft_q15.h)
+extern const uint32_t fft_q15_twiddles[NUM_SAMPLES/2];
+
+// Periodic Hann window with unit coherent gain, i.e. 1 - cos(2*pi*n/N)
+extern const float fft_window[NUM_SAMPLES];
+
+// Bit-reversed value of each sample index
+extern const uint16_t fft_bit_reverse[NUM_SAMPLES];
+
+#endif
@@ -0,0 +1,130 @@
+//*****************************************************************************
+// Log-Frequency Filterbank Library
+// Usage: Call filterbank_init() once with the number of spectrum bins and a 
+//   function giving each bin's centre frequency. filterbank_apply() then 
+//   aggregates an integer power spectrum into FILTERBANK_NUM_BANDS 
+//   log-spaced triangular bands. Only the non-zero weights are stored, as 
+//   Q15 fractions, so each call costs one integer multiply-add per stored 
+//   weight.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "filterbank.h"
+
+// Weights are Q15, so a weight of 1 is 1 << WEIGHT_SHIFT
+#define WEIGHT_SHIFT 15
+
+// Sparse weight matrix: band b covers bins first_bin[b] onwards, using 
+// weights[offset[b]] up to (but excluding) weights[offset[b + 1]]
+static uint16_t first_bin[FILTERBANK_NUM_BANDS];
+static uint16_t offset[FILTERBANK_NUM_BANDS + 1];
+static uint16_t weights[FILTERBANK_MAX_WEIGHTS];
+
+// Weights of the band being built, before normalization
+static float raw_weights[FILTERBANK_MAX_BINS];
+
+// Band b rises from edges[b] to edges[b + 1] and falls back to 0 at 
+// edges[b + 2]
+static float edges[FILTERBANK_NUM_BANDS + 2];
+
+//*****************************************************************************
+// Frequency of the first bin above 'f', or 'f' itself if there is none.
+//*****************************************************************************
+static float next_bin_frequency(float f, uint16_t num_bins, float (*bin_frequency)(uint16_t)) {
+    uint16_t i;
+    
+    for (i = 1; i < num_bins; i++) {
+        if (bin_frequency(i) > f) return bin_frequency(i);
+    }
+    return f;
+}
+
+//*****************************************************************************
+// Places the band edges from FILTERBANK_MIN_FREQ up to FILTERBANK_MAX_FREQ. 
+// Each edge is log-spaced over the span still to cover, but at least one bin 
+// above the previous one, so where bins are sparser than the bands (the bass 
+// end of a short FFT) the bands fall back to one bin each instead of 
+// collapsing onto the same bin. Later edges are respaced so that the last 
+// still ends at FILTERBANK_MAX_FREQ where possible.
+//*****************************************************************************
+static void place_edges(uint16_t num_bins, float (*bin_frequency)(uint16_t)) {
+    uint16_t k;
+    
+    edges[0] = FILTERBANK_MIN_FREQ;
+    for (k = 1; k < FILTERBANK_NUM_BANDS + 2; k++) {
+        float ratio = powf(FILTERBANK_MAX_FREQ / edges[k - 1], 1.0f / (FILTERBANK_NUM_BANDS + 2 - k));
+        float next_bin = next_bin_frequency(edges[k - 1], num_bins, bin_frequency);
+        
+        edges[k] = edges[k - 1] * ratio;
+        if (edges[k] < next_bin) edges[k] = next_bin;
+    }
+}
+
+//*****************************************************************************
+// Builds the sparse weights for a spectrum of 'num_bins' bins.
+//*****************************************************************************
+void filterbank_init(uint16_t num_bins, float (*bin_frequency)(uint16_t)) {
+    uint16_t num_weights = 0;
+    uint16_t b, i;
+    
+    if (num_bins > FILTERBANK_MAX_BINS) num_bins = FILTERBANK_MAX_BINS;
+    
+    place_edges(num_bins, bin_frequency);
+    
+    for (b = 0; b < FILTERBANK_NUM_BANDS; b++) {
+        float low = edges[b];
+        float center = edges[b + 1];
+        float high = edges[b + 2];
+        uint16_t nearest = 1;
+        uint16_t num_raw = 0;
+        float sum = 0.0f;
+        
+        first_bin[b] = 0;
+        offset[b] = num_weights;
+        
+        for (i = 1; i < num_bins; i++) {
+            float f = bin_frequency(i);
+            float weight;
+            
+            if (fabsf(f - center) < fabsf(bin_frequency(nearest) - center)) nearest = i;
+            if ((f <= low) || (f >= high)) continue;
+            
+            // Frequencies increase with the index, so a band's bins are 
+            // contiguous
+            weight = (f < center) ? (f - low) / (center - low) : (high - f) / (high - center);
+            if (first_bin[b] == 0) first_bin[b] = i;
+            raw_weights[num_raw++] = weight;
+            sum += weight;
+        }
+        
+        if (sum > 0.0f) {
+            // Rounding down keeps the quantized weights' sum at most 1
+            for (i = 0; i < num_raw; i++) {
+                weights[num_weights++] = (uint16_t) (raw_weights[i] / sum * (1 << WEIGHT_SHIFT));
+            }
+        }
+        else {
+            first_bin[b] = nearest;
+            weights[num_weights++] = 1 << WEIGHT_SHIFT;
+        }
+    }
+    
+    offset[FILTERBANK_NUM_BANDS] = num_weights;
+}
+
+//*****************************************************************************
+// Aggregates 'power' into bands[1] to bands[FILTERBANK_NUM_BANDS].
+//*****************************************************************************
+void filterbank_apply(const uint32_t *power, uint32_t *bands) {
+    uint16_t b, w;
+    
+    for (b = 0; b < FILTERBANK_NUM_BANDS; b++) {
+        const uint32_t *bins = &power[first_bin[b]];
+        const uint16_t *band_weights = &weights[offset[b]];
+        uint16_t num_weights = offset[b + 1] - offset[b];
+        uint64_t sum = 0;
+        
+        for (w = 0; w < num_weights; w++) sum += (uint64_t) band_weights[w] * bins[w];
+        bands[b + 1] = (uint32_t) (sum >> WEIGHT_SHIFT);
+    }
+}
@@ -0,0 +1,44 @@
+//*****************************************************************************
+// Log-Frequency Filterbank Library
+// Usage: Call filterbank_init() once with the number of spectrum bins and a 
+//   function giving each bin's centre frequency. filterbank_apply() then 
+//   aggregates an integer power spectrum into FILTERBANK_NUM_BANDS 
+//   log-spaced triangular bands. Only the non-zero weights are stored, as 
+//   Q15 fractions, so each call costs one integer multiply-add per stored 
+//   weight.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __FILTERBANK_H__
+#define __FILTERBANK_H__
+
+#include <stdint.h>
+#include "fft.h"
+
+#define FILTERBANK_NUM_BANDS 24       // Number of output bands
+#define FILTERBANK_MIN_FREQ  40.0f    // Lower edge of the first band (Hz)
+#define FILTERBANK_MAX_FREQ  4800.0f  // Upper edge of the last band (Hz)
+
+// Largest supported spectrum; adjacent triangles overlap by half, so every 
+// bin has at most two weights, plus one fallback weight per band
+#define FILTERBANK_MAX_BINS    NUM_SAMPLES
+#define FILTERBANK_MAX_WEIGHTS (2*FILTERBANK_MAX_BINS + FILTERBANK_NUM_BANDS)
+
+//*****************************************************************************
+// Builds the sparse weights for a spectrum of 'num_bins' bins (index 0 is 
+// skipped) whose frequencies increase with the index. Each band is 
+// normalized so that its weights sum to (at most) 1, so a band never exceeds 
+// the largest bin it covers. Band edges are log-spaced but never closer than 
+// one bin apart, so at the bass end of a short FFT the bands are one bin 
+// each rather than several copies of the same bin; only a band beyond the 
+// last bin takes the bin nearest its centre.
+//*****************************************************************************
+void filterbank_init(uint16_t num_bins, float (*bin_frequency)(uint16_t));
+
+//*****************************************************************************
+// Writes band b of 'power' to bands[b + 1]; bands[0] is left untouched, 
+// matching the convention that index 0 of a spectrum is meaningless.
+//*****************************************************************************
+void filterbank_apply(const uint32_t *power, uint32_t *bands);
+
+#endif
@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Energy Gate Library
+// Usage: Initialize one gate_t per channel with gate_init(), then pass every 
+//   raw ADC sample through gate_update(), which returns the sample with its 
+//   DC offset removed. The same pass keeps a running mean square of the 
+//   DC-free signal, and 'open' says whether the channel currently carries 
+//   audio. Separate opening and closing levels (hysteresis) stop the gate 
+//   from chattering on signals near the threshold. Integer arithmetic only.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "gate.h"
+
+// Thresholds on the scaled energy
+#define OPEN_ENERGY  ((uint32_t) GATE_OPEN_RMS * GATE_OPEN_RMS << GATE_ENERGY_SHIFT)
+#define CLOSE_ENERGY ((uint32_t) GATE_CLOSE_RMS * GATE_CLOSE_RMS << GATE_ENERGY_SHIFT)
+
+//*****************************************************************************
+// Starts a gate closed; its DC estimate is seeded by the first sample.
+//*****************************************************************************
+void gate_init(gate_t *gate) {
+    gate->dc = 0;
+    gate->energy = 0;
+    gate->seeded = false;
+    gate->open = false;
+}
+
+//*****************************************************************************
+// One-pole DC blocker feeding an exponential moving average of the squared 
+// output. Both the sample and the DC estimate lie within 0 to 0xFFF, so the 
+// output's square is below 2^24 and the scaled energy fits in 32 bits.
+//*****************************************************************************
+int16_t gate_update(gate_t *gate, uint16_t sample) {
+    int32_t signal;
+    
+    // Starting from the first sample keeps the bias from reading as a loud 
+    // transient while the estimate settles
+    if (!gate->seeded) {
+        gate->dc = (int32_t) sample << GATE_DC_SHIFT;
+        gate->seeded = true;
+    }
+    
+    signal = (int32_t) sample - (gate->dc >> GATE_DC_SHIFT);
+    
+    gate->dc += signal;
+    gate->energy += (uint32_t) (signal*signal) - (gate->energy >> GATE_ENERGY_SHIFT);
+    
+    if (gate->open) {
+        if (gate->energy < CLOSE_ENERGY) gate->open = false;
+    }
+    else {
+        if (gate->energy > OPEN_ENERGY) gate->open = true;
+    }
+    
+    return (int16_t) signal;
+}
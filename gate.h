@@ -0,0 +1,46 @@
+//*****************************************************************************
+// Energy Gate Library
+// Usage: Initialize one gate_t per channel with gate_init(), then pass every 
+//   raw ADC sample through gate_update(), which returns the sample with its 
+//   DC offset removed. The same pass keeps a running mean square of the 
+//   DC-free signal, and 'open' says whether the channel currently carries 
+//   audio. Separate opening and closing levels (hysteresis) stop the gate 
+//   from chattering on signals near the threshold. Integer arithmetic only.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __GATE_H__
+#define __GATE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Time constants, in samples, are 2^shift: at 10 kHz the DC estimate follows 
+// about 0.4 s and the energy estimate about 26 ms
+#define GATE_DC_SHIFT     12
+#define GATE_ENERGY_SHIFT 8
+
+// RMS levels, in ADC counts, at which a closed gate opens and an open gate 
+// closes
+#define GATE_OPEN_RMS  24
+#define GATE_CLOSE_RMS 12
+
+typedef struct {
+    int32_t dc;       // DC estimate, scaled by 2^GATE_DC_SHIFT
+    uint32_t energy;  // Mean square of the DC-free signal, scaled by 2^GATE_ENERGY_SHIFT
+    bool seeded;      // Whether 'dc' has been set from a first sample
+    bool open;        // Whether the channel currently carries audio
+} gate_t;
+
+//*****************************************************************************
+// Starts a gate closed; its DC estimate is seeded by the first sample.
+//*****************************************************************************
+void gate_init(gate_t *gate);
+
+//*****************************************************************************
+// Updates the DC estimate, the energy estimate and the gate decision with a 
+// 12-bit 'sample'; returns the sample minus the DC estimate.
+//*****************************************************************************
+int16_t gate_update(gate_t *gate, uint16_t sample);
+
+#endif
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Goertzel Note Bank Library
+// Usage: Call goertzel_init() once with the sample rate, initialize one 
+//   goertzel_bank_t per channel with goertzel_bank_init(), then feed every 
+//   new sample to goertzel_update(). Each note is a Goertzel filter tuned to 
+//   an equal-tempered pitch, with a block length of about one semitone of 
+//   resolution at that pitch; 'powers' holds each note's latest result.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "goertzel.h"
+
+// Quality factor giving one semitone of resolution: f / (2^(1/12)*f - f)
+#define SEMITONE_Q 16.817f
+
+// Shared by all banks; set by goertzel_init()
+static float coefficients[GOERTZEL_NUM_NOTES];     // 2*cos(2*pi*f/fs)
+static uint16_t block_lengths[GOERTZEL_NUM_NOTES]; // Q*fs/f samples
+static float output_scales[GOERTZEL_NUM_NOTES];    // (NUM_SAMPLES/block length)^2
+
+//*****************************************************************************
+// Computes every note's coefficient and block length for 'sample_rate' Hz.
+//*****************************************************************************
+void goertzel_init(float sample_rate) {
+    uint8_t note;
+    
+    for (note = 0; note < GOERTZEL_NUM_NOTES; note++) {
+        // A4 (MIDI note 69) is 440 Hz
+        float frequency = 440.0f * powf(2.0f, (GOERTZEL_LOWEST_NOTE + note - 69) / 12.0f);
+        float length = roundf(SEMITONE_Q * sample_rate / frequency);
+        
+        coefficients[note] = 2.0f * cosf(2.0f * (float) PI * frequency / sample_rate);
+        block_lengths[note] = (uint16_t) length;
+        output_scales[note] = (NUM_SAMPLES / length) * (NUM_SAMPLES / length);
+    }
+}
+
+//*****************************************************************************
+// Clears a bank's filter states and results.
+//*****************************************************************************
+void goertzel_bank_init(goertzel_bank_t *bank) {
+    uint8_t note;
+    
+    for (note = 0; note < GOERTZEL_NUM_NOTES; note++) {
+        bank->s1[note] = 0.0f;
+        bank->s2[note] = 0.0f;
+        bank->count[note] = 0;
+        bank->powers[note] = 0.0f;
+    }
+}
+
+//*****************************************************************************
+// Runs one sample through every filter; O(notes) per sample.
+//*****************************************************************************
+void goertzel_update(goertzel_bank_t *bank, float sample) {
+    uint8_t note;
+    
+    for (note = 0; note < GOERTZEL_NUM_NOTES; note++) {
+        float s1 = bank->s1[note];
+        float s2 = bank->s2[note];
+        float s = sample + coefficients[note]*s1 - s2;
+        
+        if (++bank->count[note] < block_lengths[note]) {
+            bank->s2[note] = s1;
+            bank->s1[note] = s;
+            continue;
+        }
+        
+        // Block complete: |X|^2 = s[n]^2 + s[n-1]^2 - coeff*s[n]*s[n-1]
+        bank->powers[note] = (s*s + s1*s1 - coefficients[note]*s*s1) * output_scales[note];
+        bank->s1[note] = 0.0f;
+        bank->s2[note] = 0.0f;
+        bank->count[note] = 0;
+    }
+}
@@ -0,0 +1,43 @@
+//*****************************************************************************
+// Goertzel Note Bank Library
+// Usage: Call goertzel_init() once with the sample rate, initialize one 
+//   goertzel_bank_t per channel with goertzel_bank_init(), then feed every 
+//   new sample to goertzel_update(). Each note is a Goertzel filter tuned to 
+//   an equal-tempered pitch, with a block length of about one semitone of 
+//   resolution at that pitch; 'powers' holds each note's latest result.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __GOERTZEL_H__
+#define __GOERTZEL_H__
+
+#include <stdint.h>
+#include "fft.h"
+
+#define GOERTZEL_LOWEST_NOTE 36  // MIDI note number of the lowest note (C2)
+#define GOERTZEL_NUM_NOTES   60  // Number of consecutive semitones (to B6)
+
+typedef struct {
+    float s1[GOERTZEL_NUM_NOTES];          // Filter state, one sample ago
+    float s2[GOERTZEL_NUM_NOTES];          // Filter state, two samples ago
+    uint16_t count[GOERTZEL_NUM_NOTES];    // Samples in the current block
+    float powers[GOERTZEL_NUM_NOTES];      // Result of each note's last block
+} goertzel_bank_t;
+
+//*****************************************************************************
+// Computes every note's coefficient and block length for 'sample_rate' Hz.
+//*****************************************************************************
+void goertzel_init(float sample_rate);
+
+//*****************************************************************************
+// Clears a bank's filter states and results.
+//*****************************************************************************
+void goertzel_bank_init(goertzel_bank_t *bank);
+
+//*****************************************************************************
+// Runs one sample through every filter; a note whose block is complete gets 
+// a new power |X|^2, scaled to match a NUM_SAMPLES-point FFT bin.
+//*****************************************************************************
+void goertzel_update(goertzel_bank_t *bank, float sample);
+
+#endif
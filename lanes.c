@@ -0,0 +1,48 @@
+//*****************************************************************************
+// NeoPixel Lane Transpose Library
+// Usage: Give lanes_transpose() one GRB framebuffer per GPIO pin (NULL for 
+//   pins without a strip). It produces the byte to write to the 
+//   port's data register in each WS2812B bit slot, so that a single store 
+//   sends one bit to every strip at once. Plain C with no hardware 
+//   dependencies.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "lanes.h"
+
+//*****************************************************************************
+// Transposes an 8x8 bit matrix held one row per byte (Hacker's Delight 7-3): 
+// bit j of byte i moves to bit i of byte j.
+//*****************************************************************************
+static uint64_t transpose8(uint64_t x) {
+    uint64_t t;
+    
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAull;
+    x = x ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCull;
+    x = x ^ t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ull;
+    x = x ^ t ^ (t << 28);
+    return x;
+}
+
+//*****************************************************************************
+// Transposes each colour byte across lanes.
+//*****************************************************************************
+void lanes_transpose(const uint8_t *const lanes[LANES_MAX], uint16_t num_leds, uint8_t *slots) {
+    uint16_t i;
+    uint8_t lane;
+    int8_t bit;
+    
+    for (i = 0; i < 3*num_leds; i++) {
+        // Byte 'lane' holds that lane's colour byte
+        uint64_t matrix = 0;
+        for (lane = 0; lane < LANES_MAX; lane++) {
+            if (lanes[lane]) matrix |= (uint64_t) lanes[lane][i] << (8*lane);
+        }
+        
+        // Byte 'bit' now holds bit 'bit' of every lane; send MSB first
+        matrix = transpose8(matrix);
+        for (bit = 7; bit >= 0; bit--) *slots++ = (uint8_t) (matrix >> (8*bit));
+    }
+}
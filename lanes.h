@@ -0,0 +1,25 @@
+//*****************************************************************************
+// NeoPixel Lane Transpose Library
+// Usage: Give lanes_transpose() one GRB framebuffer per GPIO pin (NULL for 
+//   pins without a strip). It produces the byte to write to the 
+//   port's data register in each WS2812B bit slot, so that a single store 
+//   sends one bit to every strip at once. Plain C with no hardware 
+//   dependencies.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __LANES_H__
+#define __LANES_H__
+
+#include <stdint.h>
+
+#define LANES_MAX 8  // One lane per pin of a GPIO port
+
+//*****************************************************************************
+// Transposes the 3*num_leds GRB bytes of each lane into 24*num_leds slot 
+// bytes in transmission order, MSB first. Bit p of a slot byte is the bit for 
+// the strip on pin p; lanes that are NULL contribute zeros.
+//*****************************************************************************
+void lanes_transpose(const uint8_t *const lanes[LANES_MAX], uint16_t num_leds, uint8_t *slots);
+
+#endif
@@ -6,91 +6,46 @@
 
 #include "main.h"
 
-volatile uint32_t left_audio_sample;
-volatile uint32_t right_audio_sample;
-
-// Interrupt flags
-volatile bool Timer0A_flag;
-volatile bool ADC0SS0_flag;
-volatile bool ADC1SS0_flag;
-
-bool left_fft_done;
-bool right_fft_done;
-
-//*****************************************************************************
-// Note: Maximum frequency of music that can be detected is 10 kHz.
-//*****************************************************************************
-void timer_config(void) {
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
-    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER0));
-    TimerConfigure(TIMER0_BASE, TIMER_CFG_PERIODIC);
-    TimerLoadSet(TIMER0_BASE, TIMER_A, 5000);
-    TimerControlTrigger(TIMER0_BASE, TIMER_A, true);
-    IntEnable(INT_TIMER0A);
-    //TimerIntEnable(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
-    TimerEnable(TIMER0_BASE, TIMER_A);
-}
-
 //*****************************************************************************
 // Initialize and configure all the relevant hardware.
 //*****************************************************************************
 void hardware_config(void) {
     IntMasterDisable();
     
-    audio_config();
+    clock_config();
+    dma_config();
+    audio_config(capture_block_ready);
+#if NEOPIXELS_DRIVER == NEOPIXELS_SSI
+    neopixels_config(GPIOB_BASE, 7);  // SSI2Tx
+#else
     neopixels_config(GPIOB_BASE, 2);
+#endif
     print_config();
     
+    // Scheduler tick
+    SysTickPeriodSet(SysCtlClockGet() / SCHED_TICK_HZ);
+    SysTickIntEnable();
+    SysTickEnable();
+    
     IntMasterEnable();
 }
 
-//*****************************************************************************
-// ISRs for analog-to-digital conversions; they simply indicate that the 
-// handler has been entered and retrieve data.
-//*****************************************************************************
-void ADC0SS0_Handler(void) {
-    ADCIntClear(ADC0_BASE, 0);
-    ADC0SS0_flag = true;
-    ADCSequenceDataGet(ADC0_BASE, 0, &left_audio_sample);
-}
-
-void ADC1SS0_Handler(void) {
-    ADCIntClear(ADC1_BASE, 0);
-    ADC1SS0_flag = true;
-    ADCSequenceDataGet(ADC1_BASE, 0, &right_audio_sample);
-}
-
-double freq_band_to_wavelength(uint16_t idx) {
-    return 780.0 - 400.0*idx/(NUM_SAMPLES/2);
-}
-
-double led_index_to_wavelength(uint16_t idx) {
-    return 380.0 + 400.0*idx/NUM_NEOPIXELS;
-}
-
-uint32_t freq_band_to_rgb(uint16_t idx) {
-    return wavelength_to_rgb(freq_band_to_wavelength(idx), true);
-}
-
 uint32_t led_index_to_rgb(uint16_t idx) {
-    return wavelength_to_rgb(led_index_to_wavelength(idx), true);
+    return color_led_palette[idx];
 }
 
-bool music_playing(double complex *fft_output) {
-    const double EPSILON = 0.05;
-    uint8_t gt_epsilon = 0;
-    uint16_t i;
-    for (i = 1; i < NUM_SAMPLES/2; i++) {
-        if (cabs(fft_output[i]) > EPSILON) {
-            printf("%d: %f\n", i, cabs(fft_output[i]));
-            gt_epsilon++;
-            if (gt_epsilon >= NUM_SAMPLES/8.0) {
-                return true;
-            }
-        }
-        printf("%d: %f\n", i, cabs(fft_output[i]));
+//*****************************************************************************
+// Centre frequency in Hz of entry 'idx' of the analysis stage's spectrum.
+//*****************************************************************************
+float spectrum_bin_frequency(uint16_t idx) {
+#if ANALYSIS_MODE == ANALYSIS_MULTIRES
+    if (idx <= MULTIRES_LOW_BINS) {
+        return (float) idx * AUDIO_SAMPLE_RATE / (MULTIRES_DECIMATION * NUM_SAMPLES);
     }
-    return false;
+    return (float) (idx - MULTIRES_HIGH_INDEX(0)) * AUDIO_SAMPLE_RATE / NUM_SAMPLES;
+#else
+    return (float) idx * AUDIO_SAMPLE_RATE / NUM_SAMPLES;
+#endif
 }
 
 //*****************************************************************************
@@ -112,7 +67,7 @@ void test_neopixels1(void) {
     
     hardware_config();
     
-    for (i = 0; i < NUM_NEOPIXELS; i++) neopixel_data[i] = colorless;
+    for (i = 0; i < NUM_NEOPIXELS; i++) neopixel_set(i, colorless);
     
     while (1) {
         for (i = 0; i < 3; i++) {
@@ -128,7 +83,7 @@ void test_neopixels1(void) {
             }
             for (j = 0; j < NUM_NEOPIXELS; j++) {
                 for (k = 0; k < NUM_NEOPIXELS; k++) {
-                    neopixel_data[k] = (k <= j) ? color : colorless;
+                    neopixel_set(k, (k <= j) ? color : colorless);
                 }
                 flash_neopixels();
                 
@@ -172,7 +127,7 @@ void test_neopixels2(bool increase_wavelength) {
         
         color = wavelength_to_rgb(wavelength, true);
         for (i = 0; i < NUM_NEOPIXELS; i++) {
-            neopixel_data[i] = color;
+            neopixel_set(i, color);
         }
         flash_neopixels();
         
@@ -201,13 +156,13 @@ void test_neopixels3(void) {
     
     hardware_config();
     
-    for (i = 0; i < NUM_NEOPIXELS; i++) neopixel_data[i] = colorless;
+    for (i = 0; i < NUM_NEOPIXELS; i++) neopixel_set(i, colorless);
     
     while (1) {
         for (i = 0; i < NUM_NEOPIXELS; i++) {
             for (j = 0; j < NUM_NEOPIXELS; j++) {
                 color = led_index_to_rgb(j);
-                neopixel_data[j] = (j <= i) ? color : colorless;
+                neopixel_set(j, (j <= i) ? color : colorless);
             }
             flash_neopixels();
             
@@ -229,160 +184,409 @@ void test_neopixels3(void) {
 }
 //*/
 
-int main(void) {
-    double complex left_channel_samples[NUM_SAMPLES];
-    double complex right_channel_samples[NUM_SAMPLES];
-    uint16_t left_sample_num = 0;
-    uint16_t right_sample_num = 0;
-    double complex *left_channel_output;
-    double complex *right_channel_output;
+//*****************************************************************************
+// Analysis state, shared by the capture and analysis tasks
+//*****************************************************************************
+#if ANALYSIS_MODE == ANALYSIS_SLIDING_DFT
+// Each channel's spectrum is kept current on every sample
+static sdft_t left_sdft;
+static sdft_t right_sdft;
+#elif ANALYSIS_MODE == ANALYSIS_GOERTZEL
+// Each channel's note powers are kept current on every sample
+static goertzel_bank_t left_notes;
+static goertzel_bank_t right_notes;
+#else
+// The last NUM_SAMPLES samples of each channel, written circularly; each hop 
+// they are windowed into 'stereo_samples' (left in the real parts, right in 
+// the imaginary parts) and transformed with one FFT
+static float left_history[NUM_SAMPLES];
+static float right_history[NUM_SAMPLES];
+static uint16_t history_idx;
+static float complex stereo_samples[NUM_SAMPLES];
+#endif
+#if ANALYSIS_MODE == ANALYSIS_MULTIRES
+// Same as above for the decimated streams, which advance one sample for every 
+// MULTIRES_DECIMATION full-rate samples
+static multires_decimator_t left_decimator;
+static multires_decimator_t right_decimator;
+static float left_low_history[NUM_SAMPLES];
+static float right_low_history[NUM_SAMPLES];
+static uint16_t low_history_idx;
+static uint16_t low_sample_num;
+static float complex low_stereo_samples[NUM_SAMPLES];
+static bool low_frame_ready;
+#endif
+static gate_t left_gate;
+static gate_t right_gate;
+static uint16_t sample_num;
+
+#if (ANALYSIS_MODE == ANALYSIS_SLIDING_DFT) || (ANALYSIS_MODE == ANALYSIS_GOERTZEL)
+// Whether the per-sample transforms were skipped because both gates were 
+// closed; they restart from a cleared state when either gate opens
+static bool transforms_idle;
+#endif
+
+// Whether both gates were closed when the last frame was completed
+static bool frame_silent;
+
+// Whether a completed frame is waiting for the analysis task
+static bool frame_pending;
+
+// Index 0 is meaningless; powers are integers (see bands.h)
+static uint32_t left_power[NUM_SPECTRUM_BINS];
+static uint32_t right_power[NUM_SPECTRUM_BINS];
+#if FILTERBANK_ENABLED
+static uint32_t combined_power[NUM_SPECTRUM_BINS];
+#endif
+static uint32_t band_power[NUM_SELECTION_BANDS];
+static uint64_t band_averages[NUM_SELECTION_BANDS];
+
+// Onsets (kicks, snares) are found from the same band powers
+static onset_t onset;
+static uint16_t band_log_power[NUM_SELECTION_BANDS];
+
+// Beats detected so far
+static uint32_t beat_count;
+
+//*****************************************************************************
+// Analysis results, handed from the analysis task to the render task through 
+// a triple buffer so that each runs at its own rate
+//*****************************************************************************
+static band_frame_t band_frames[3];
+static triple_t band_exchange;
+
+//*****************************************************************************
+// Render state
+//*****************************************************************************
+// Effect layers, one byte per LED, padded and aligned for the packed 
+// arithmetic in effects.c: highlights set by the mapping, the peak-hold 
+// trails they leave, beat ripples, and the sum of trails and ripples, which 
+// is how far each LED is driven from its base colour towards white
+static uint8_t led_levels[EFFECTS_PADDED(NUM_NEOPIXELS)] __attribute__((aligned(4)));
+static uint8_t led_trails[EFFECTS_PADDED(NUM_NEOPIXELS)] __attribute__((aligned(4)));
+static uint8_t led_ripples[EFFECTS_PADDED(NUM_NEOPIXELS)] __attribute__((aligned(4)));
+static uint8_t led_display[EFFECTS_PADDED(NUM_NEOPIXELS)] __attribute__((aligned(4)));
+static effects_ripple_t ripple;
+
+// Scheduler task IDs
+static uint8_t capture_task_id;
+static uint8_t analysis_task_id;
+static uint8_t render_task_id;
+static uint8_t telemetry_task_id;
+
+//*****************************************************************************
+// Capture task: drains sample pairs from the capture ring up to the next 
+// frame boundary. Each sample passes through its channel's gate, which 
+// removes the DC offset and tracks whether the channel carries audio; the 
+// per-sample transforms are skipped while both gates are closed. At the 
+// boundary the frame is copied out and the analysis task posted, and capture 
+// stops until analysis has taken it, so that every frame is analysed. Only 
+// if analysis falls more than CAPTURE_MAX_BACKLOG pairs behind does capture 
+// drain on, and analysis then sees the newest frame.
+//*****************************************************************************
+void capture_task(void) {
+    uint16_t left_raw, right_raw;
+    int16_t signal;
+#if (ANALYSIS_MODE == ANALYSIS_SLIDING_DFT) || (ANALYSIS_MODE == ANALYSIS_GOERTZEL)
+    int16_t right_signal;
+#endif
+#if ANALYSIS_MODE == ANALYSIS_MULTIRES
+    float low_sample;
+#endif
     
-    // Index 0 is meaningless
-    double normalized_output;
-    double normalized_averages[NUM_SAMPLES/2];
-    double ratios[NUM_SAMPLES/2];
+    // Analysis posts capture again once it has taken the last frame
+    if (frame_pending) return;
     
-    uint16_t best_bands[NUM_BANDS];
-    double best_ratios[NUM_BANDS];
+    while (audio_read(&left_raw, &right_raw)) {
+#if (ANALYSIS_MODE == ANALYSIS_SLIDING_DFT) || (ANALYSIS_MODE == ANALYSIS_GOERTZEL)
+        signal = gate_update(&left_gate, left_raw);
+        right_signal = gate_update(&right_gate, right_raw);
+        
+        // Analysis skips silent frames, so the transforms only run while a 
+        // gate is open; the samples they missed are dropped from the window
+        if (!left_gate.open && !right_gate.open) {
+            transforms_idle = true;
+        } else {
+#if ANALYSIS_MODE == ANALYSIS_SLIDING_DFT
+            if (transforms_idle) {
+                sdft_init(&left_sdft);
+                sdft_init(&right_sdft);
+                transforms_idle = false;
+            }
+            sdft_update(&left_sdft, (float) signal / 0xFFF);
+            sdft_update(&right_sdft, (float) right_signal / 0xFFF);
+#else
+            if (transforms_idle) {
+                goertzel_bank_init(&left_notes);
+                goertzel_bank_init(&right_notes);
+                transforms_idle = false;
+            }
+            goertzel_update(&left_notes, (float) signal / 0xFFF);
+            goertzel_update(&right_notes, (float) right_signal / 0xFFF);
+#endif
+        }
+        
+        if (++sample_num < SAMPLE_RENDER_INTERVAL) continue;
+#else
+        signal = gate_update(&left_gate, left_raw);
+        left_history[(history_idx + sample_num) & (NUM_SAMPLES - 1)] = (float) signal / 0xFFF;
+#if ANALYSIS_MODE == ANALYSIS_MULTIRES
+        if (multires_decimate(&left_decimator, (float) signal / 0xFFF, &low_sample)) {
+            left_low_history[(low_history_idx + low_sample_num) & (NUM_SAMPLES - 1)] = low_sample;
+        }
+#endif
+        signal = gate_update(&right_gate, right_raw);
+        right_history[(history_idx + sample_num) & (NUM_SAMPLES - 1)] = (float) signal / 0xFFF;
+#if ANALYSIS_MODE == ANALYSIS_MULTIRES
+        // Both decimators see the same number of samples, so they produce 
+        // output together
+        if (multires_decimate(&right_decimator, (float) signal / 0xFFF, &low_sample)) {
+            right_low_history[(low_history_idx + low_sample_num) & (NUM_SAMPLES - 1)] = low_sample;
+            low_sample_num++;
+        }
+#endif
+        
+        if (++sample_num < STFT_HOP_SIZE) continue;
+        history_idx = (history_idx + STFT_HOP_SIZE) & (NUM_SAMPLES - 1);
+        
+        // 'history_idx' now points at the oldest sample
+        fft_stereo_load(stereo_samples, left_history, right_history, history_idx);
+#if ANALYSIS_MODE == ANALYSIS_MULTIRES
+        
+        // Low-band frames hop the same number of (decimated) samples
+        if (low_sample_num >= STFT_HOP_SIZE) {
+            low_sample_num -= STFT_HOP_SIZE;
+            low_history_idx = (low_history_idx + STFT_HOP_SIZE) & (NUM_SAMPLES - 1);
+            fft_stereo_load(low_stereo_samples, left_low_history, right_low_history, low_history_idx);
+            low_frame_ready = true;
+        }
+#endif
+#endif
+        
+        sample_num = 0;
+        frame_silent = !left_gate.open && !right_gate.open;
+        frame_pending = true;
+        sched_post(analysis_task_id);
+        if (audio_pending() <= CAPTURE_MAX_BACKLOG) return;
+    }
+}
+
+//*****************************************************************************
+// Analysis task: turns the frame capture completed into band selections and 
+// onsets, and publishes them for the render task. Nothing but the gate 
+// decision is computed while both channels are quiet.
+//*****************************************************************************
+void analysis_task(void) {
+    band_frame_t *result = &band_frames[triple_write_slot(&band_exchange)];
+    uint16_t i;
     
-    uint16_t restore_indices[NUM_BANDS];
+    // Tasks run to completion, so capture cannot touch the frame before this 
+    // task returns
+    frame_pending = false;
+    sched_post(capture_task_id);
     
-    double led_wavelengths[NUM_NEOPIXELS];
+    result->silent = frame_silent;
+    result->num_bands = 0;
+    result->beat_count = beat_count;
+    if (frame_silent) {
+#if ANALYSIS_MODE == ANALYSIS_MULTIRES
+        low_frame_ready = false;
+#endif
+        // Flux across a pause is meaningless; start over afterwards
+        onset_init(&onset);
+        triple_publish(&band_exchange);
+        return;
+    }
     
-    uint16_t dead_ctr = 0;
+#if ANALYSIS_MODE == ANALYSIS_SLIDING_DFT
+    for (i = 1; i < NUM_SPECTRUM_BINS; i++) {
+        left_power[i] = bands_power(left_sdft.bins[i]);
+        right_power[i] = bands_power(right_sdft.bins[i]);
+    }
+#elif ANALYSIS_MODE == ANALYSIS_GOERTZEL
+    for (i = 1; i < NUM_SPECTRUM_BINS; i++) {
+        left_power[i] = bands_quantize(left_notes.powers[i - 1]);
+        right_power[i] = bands_quantize(right_notes.powers[i - 1]);
+    }
+#else
+    fft_stereo_bit_reversed(stereo_samples);
+#if ANALYSIS_MODE == ANALYSIS_MULTIRES
+    // Full-rate bins fill the upper part of the merged spectrum
+    for (i = MULTIRES_FIRST_HIGH_BIN; i < NUM_SAMPLES/2; i++) {
+        left_power[MULTIRES_HIGH_INDEX(i)] = bands_power(STEREO_LEFT(stereo_samples, i));
+        right_power[MULTIRES_HIGH_INDEX(i)] = bands_power(STEREO_RIGHT(stereo_samples, i));
+    }
     
-    uint32_t num_cycles = 0;
-    double band_color, led_index_color;
-    double difference, best_difference;
-    uint16_t i;
-    uint8_t j, k;
+    if (low_frame_ready) {
+        low_frame_ready = false;
+        fft_stereo_bit_reversed(low_stereo_samples);
+        for (i = 1; i <= MULTIRES_LOW_BINS; i++) {
+            left_power[i] = bands_power(STEREO_LEFT(low_stereo_samples, i));
+            right_power[i] = bands_power(STEREO_RIGHT(low_stereo_samples, i));
+        }
+    }
+#else
+    for (i = 1; i < NUM_SAMPLES/2; i++) {
+        left_power[i] = bands_power(STEREO_LEFT(stereo_samples, i));
+        right_power[i] = bands_power(STEREO_RIGHT(stereo_samples, i));
+    }
+#endif
+#endif
     
-    int times_expressed[NUM_SAMPLES/2];//
+    // Take the sum of the corresponding channel powers to be the 
+    // "normalized output"; the filterbank is linear, so the channels are 
+    // summed first
+#if FILTERBANK_ENABLED
+    bands_combine(left_power, right_power, combined_power, NUM_SPECTRUM_BINS);
+    filterbank_apply(combined_power, band_power);
+#else
+    bands_combine(left_power, right_power, band_power, NUM_SPECTRUM_BINS);
+#endif
     
-    hardware_config();
+    // Compare each normalized output to its moving average and keep the 
+    // bands that stand out the most
+    bands_update_averages(band_power, band_averages, NUM_SELECTION_BANDS);
+    result->num_bands = bands_select(band_power, band_averages, NUM_SELECTION_BANDS, result->bands, NUM_BANDS);
     
-    //for (i = 0; i < NUM_NEOPIXELS; i++) neopixel_data[i] = led_index_to_rgb(i);
+    // Beats are counted rather than flagged, so the render task notices one 
+    // even if the frame it was found in is never rendered
+    onset_update(&onset, band_power, band_log_power, NUM_SELECTION_BANDS);
+    if (onset.beat) beat_count++;
+    result->beat_count = beat_count;
     
-    while (1) {
-        if (ADC0SS0_flag) {
-            ADC0SS0_flag = false;
-            left_channel_samples[left_sample_num] = (double complex) left_audio_sample / 0xFFF;
-            left_sample_num++;
-            if (left_sample_num >= NUM_SAMPLES) {
-                left_sample_num = 0;
-                left_channel_output = fft(left_channel_samples);
-                left_fft_done = true;
-            }
-        }
-        
-        if (ADC1SS0_flag) {
-            ADC1SS0_flag = false;
-            right_channel_samples[right_sample_num] = (double complex) right_audio_sample / 0xFFF;
-            right_sample_num++;
-            if (right_sample_num >= NUM_SAMPLES) {
-                right_sample_num = 0;
-                right_channel_output = fft(right_channel_samples);
-                right_fft_done = true;
-            }
+    triple_publish(&band_exchange);
+}
+
+//*****************************************************************************
+// Blends 24-bit RGB code 'rgb' towards white by 'level'/256.
+//*****************************************************************************
+uint32_t blend_to_white(uint32_t rgb, uint8_t level) {
+    uint32_t blended = 0;
+    uint8_t shift;
+    
+    for (shift = 0; shift < 24; shift += 8) {
+        uint32_t c = (rgb >> shift) & 0xFF;
+        blended |= (c + (((0xFF - c) * level) >> 8)) << shift;
+    }
+    return blended;
+}
+
+//*****************************************************************************
+// Render task: runs every RENDER_PERIOD ticks whatever the analysis rate, 
+// showing the newest published results. Highlighted LEDs jump towards white 
+// (all the way on a beat, half way otherwise) and then fade back to their 
+// base colours over the following frames, leaving slower trails; a beat also 
+// sends a ripple out from the strongest band.
+//*****************************************************************************
+void render_task(void) {
+    static uint16_t dead_ctr = 0;
+    static uint32_t last_beat_count = 0;
+    const band_frame_t *frame;
+    bool beat;
+    uint8_t target;
+    uint16_t i;
+    
+    triple_acquire(&band_exchange);
+    frame = &band_frames[triple_read_slot(&band_exchange)];
+    
+    if (frame->silent) {
+        dead_ctr++;
+        if (dead_ctr > RENDER_IDLE_FRAMES) {
+            clear_neopixels();
+            dead_ctr = RENDER_IDLE_FRAMES;
         }
-        
-        if (left_fft_done && right_fft_done) {
-            left_fft_done = false;
-            right_fft_done = false;
-            
-            if (!music_playing(left_channel_output) && !music_playing(right_channel_output)) {
-                dead_ctr++;
-                if (dead_ctr > 50) {
-                    clear_neopixels();
-                    dead_ctr = 50;
-                }
-                else {
-                    for (i = 0; i < NUM_NEOPIXELS; i++) neopixel_data[i] = led_index_to_rgb(i);
-                    flash_neopixels();
-                }
-                continue;
-            }
-            
-            dead_ctr = 0;
-            
-            for (i = 0; i < NUM_NEOPIXELS; i++) neopixel_data[i] = led_index_to_rgb(i);
-            
-            for (i = 1; i < NUM_SAMPLES/2; i++) {
-                // Take the sum of the corresponding FFT outputs to be the "normalized output"
-                normalized_output = cabs(left_channel_output[i]) + cabs(right_channel_output[i]);
-                
-                // Update rolling averages
-                normalized_averages[i] = (num_cycles*normalized_averages[i] + normalized_output) / (num_cycles + 1);
-                
-                // Compare each normalized output to its average
-                ratios[i] = normalized_output / normalized_averages[i];
-            }
-            num_cycles++;
-            
-            // Initialize 'best_bands' and 'best_ratios' for current iteration
-            for (i = 0; i < NUM_BANDS; i++) best_ratios[i] = -1.0;
-            
-            for (i = 1; i < NUM_SAMPLES/2; i++) {
-                for (j = 0; j < NUM_BANDS; j++) {
-                    if (ratios[i] > best_ratios[j]) {
-                        for (k = NUM_BANDS - 1; k > j; k--) {
-                            best_bands[k] = best_bands[k - 1];
-                            best_ratios[k] = best_ratios[k - 1];
-                        }
-                        best_bands[j] = i;
-                        best_ratios[j] = ratios[i];
-                        break;
-                    }
-                }
-            }
-            
-            /*for (i = 0; i < NUM_BANDS; i++) {
-                times_expressed[best_bands[i]]++;
-            }
-            for (i = 1; i < NUM_SAMPLES/2; i++) {
-                printf("%d: %d\n", i, times_expressed[i]);
-            }
-            */
-            
-            for (i = 0; i < NUM_BANDS; i++) {
-                best_difference = 400.0;
-                band_color = freq_band_to_wavelength(best_bands[i]);
-                for (j = 0; j < NUM_NEOPIXELS; j++) {
-                    led_index_color = led_index_to_wavelength(j);
-                    difference = abs(band_color - led_index_color);
-                    if (difference > best_difference) {
-                        neopixel_data[j - 1] = 0x00FFFFFF;
-                        restore_indices[i] = j - 1;
-                        break;
-                    }
-                    best_difference = difference;
-                }
-                if (j == NUM_NEOPIXELS) {
-                    neopixel_data[NUM_NEOPIXELS - 1] = 0x00FFFFFF;
-                }
-            }
-            
-            flash_neopixels();
-            
-            for (i = 0; i < NUM_BANDS; i++) {
-                neopixel_data[restore_indices[i]] = led_index_to_rgb(restore_indices[i]);
-            }
-            
-            /*
-            for (i = 0; i < NUM_NEOPIXELS; i++) {
-                led_wavelengths[i] = -1.0;
-            }
-            
-            for (i = 0; i < NUM_BANDS; i++) {
-                band_color = freq_band_to_wavelength(best_bands[i]);
-                for (j = 0; j < NUM_NEOPIXELS; j++) {
-                    led_index_color = led_index_to_wavelength(j);
-                    neopixel_data[j] = (abs(band_color - led_index_color) < 75.0) ? wavelength_to_rgb(band_color, true) : wavelength_to_rgb(led_index_color, true);
-                }
-            }
-            
+        else {
+            for (i = 0; i < NUM_NEOPIXELS; i++) neopixel_set(i, led_index_to_rgb(i));
             flash_neopixels();
-            */
         }
+        memset(led_levels, 0, sizeof(led_levels));
+        memset(led_trails, 0, sizeof(led_trails));
+        memset(led_ripples, 0, sizeof(led_ripples));
+        ripple.level = 0;
+        return;
     }
+    
+    dead_ctr = 0;
+    
+    beat = frame->beat_count != last_beat_count;
+    target = beat ? 0xFF : 0x80;
+    last_beat_count = frame->beat_count;
+    
+    effects_fade(led_levels, NUM_NEOPIXELS, RENDER_FADE_SHIFT);
+    for (i = 0; i < frame->num_bands; i++) mapping_apply(frame->bands[i], target, led_levels);
+    effects_peak_hold(led_trails, led_levels, NUM_NEOPIXELS, RENDER_TRAIL_SHIFT);
+    
+    if (beat && frame->num_bands) effects_ripple_start(&ripple, mapping_center(frame->bands[0]), target);
+    effects_fade(led_ripples, NUM_NEOPIXELS, RENDER_FADE_SHIFT);
+    effects_ripple_step(&ripple, led_ripples, NUM_NEOPIXELS, RENDER_RIPPLE_SHIFT);
+    
+    memcpy(led_display, led_trails, sizeof(led_display));
+    effects_add(led_display, led_ripples, NUM_NEOPIXELS);
+    
+    for (i = 0; i < NUM_NEOPIXELS; i++) neopixel_set(i, blend_to_white(led_index_to_rgb(i), led_display[i]));
+    
+    flash_neopixels();
+}
+
+//*****************************************************************************
+// Telemetry task: reports capture overruns and high-water marks, and 
+// deadline misses, over the UART.
+//*****************************************************************************
+void telemetry_task(void) {
+    printf("overruns %u, high water %u, misses capture %u analysis %u\n", 
+           (unsigned) audio_overruns(), (unsigned) audio_high_water(), 
+           (unsigned) sched_misses(capture_task_id), (unsigned) sched_misses(analysis_task_id));
+}
+
+//*****************************************************************************
+// Called by the capture ISR for every completed block.
+//*****************************************************************************
+void capture_block_ready(void) {
+    sched_post(capture_task_id);
+}
+
+//*****************************************************************************
+// ISR for the scheduler tick.
+//*****************************************************************************
+void SysTick_Handler(void) {
+    sched_tick();
+}
+
+int main(void) {
+    // Draining capture comes first so that it never waits behind bulk work 
+    // such as LED output
+    sched_init();
+    capture_task_id = sched_add(capture_task, 0, CAPTURE_DEADLINE, 0);
+    analysis_task_id = sched_add(analysis_task, 1, ANALYSIS_DEADLINE, 0);
+    render_task_id = sched_add(render_task, 2, 0, RENDER_PERIOD);
+    telemetry_task_id = sched_add(telemetry_task, 3, 0, TELEMETRY_PERIOD);
+    
+    gate_init(&left_gate);
+    gate_init(&right_gate);
+    onset_init(&onset);
+    triple_init(&band_exchange);
+    mapping_init(RENDER_MAPPING, NUM_SELECTION_BANDS, NUM_NEOPIXELS);
+    
+#if FILTERBANK_ENABLED
+    filterbank_init(NUM_SPECTRUM_BINS, spectrum_bin_frequency);
+#endif
+    
+#if ANALYSIS_MODE == ANALYSIS_SLIDING_DFT
+    sdft_init(&left_sdft);
+    sdft_init(&right_sdft);
+#elif ANALYSIS_MODE == ANALYSIS_GOERTZEL
+    goertzel_init(AUDIO_SAMPLE_RATE);
+    goertzel_bank_init(&left_notes);
+    goertzel_bank_init(&right_notes);
+#endif
+#if ANALYSIS_MODE == ANALYSIS_MULTIRES
+    multires_init(&left_decimator);
+    multires_init(&right_decimator);
+#endif
+    
+    hardware_config();
+    
+    //for (i = 0; i < NUM_NEOPIXELS; i++) neopixel_set(i, led_index_to_rgb(i));
+    
+    sched_run();
 }
@@ -7,15 +7,133 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include "TM4C123.h"
 #include "driverlib/interrupt.h"
+#include "driverlib/systick.h"
 #include "driverlib/timer.h"
 #include "inc/hw_ints.h"
 #include "audio.h"
+#include "bands.h"
+#include "clock.h"
+#include "dma.h"
+#include "effects.h"
 #include "fft.h"
+#include "filterbank.h"
+#include "gate.h"
+#include "goertzel.h"
+#include "mapping.h"
+#include "multires.h"
+#include "sdft.h"
 #include "neopixels.h"
+#include "onset.h"
 #include "print.h"
+#include "sched.h"
+#include "triple.h"
 
 #define NUM_BANDS 3  // Number of bands that are expressed
 
+// Scheduler timing, in ticks (1/SCHED_TICK_HZ s), rounded down: capture 
+// must start within one DMA block (12.8 ms at the defaults) of being posted 
+// and analysis within one frame hop (3.2 ms), so that neither falls behind 
+// the audio; telemetry is reported every TELEMETRY_PERIOD ticks
+#define SAMPLES_TO_TICKS(n) ((n)*SCHED_TICK_HZ/AUDIO_SAMPLE_RATE)
+#define CAPTURE_DEADLINE    SAMPLES_TO_TICKS(AUDIO_BLOCK_SIZE)
+#define ANALYSIS_DEADLINE   SAMPLES_TO_TICKS(ANALYSIS_HOP)
+#define TELEMETRY_PERIOD    SCHED_TICK_HZ
+
+// The LEDs are refreshed at a fixed rate, independent of the analysis rate. 
+// Periodic tasks run every whole number of ticks, so the rate must divide 
+// the tick rate exactly or the LEDs would run at a different rate.
+#define RENDER_RATE_HZ 60
+#define RENDER_PERIOD  (SCHED_TICK_HZ / RENDER_RATE_HZ)  // Ticks
+
+#if SCHED_TICK_HZ % RENDER_RATE_HZ
+#  error "RENDER_RATE_HZ must divide SCHED_TICK_HZ"
+#endif
+
+// Each render frame fades highlights and ripples by 1/2^RENDER_FADE_SHIFT, 
+// the trails they leave by 1/2^RENDER_TRAIL_SHIFT, and a beat's ripple by 
+// 1/2^RENDER_RIPPLE_SHIFT per LED it spreads. The strip is cleared after 
+// RENDER_IDLE_FRAMES silent frames (about 0.8 s).
+#define RENDER_FADE_SHIFT   2
+#define RENDER_TRAIL_SHIFT  3
+#define RENDER_RIPPLE_SHIFT 3
+#define RENDER_IDLE_FRAMES  50
+
+// How the expressed bands are laid out on the strip (see mapping.h)
+#define RENDER_MAPPING MAPPING_SINGLE
+
+// Spectral analysis modes
+#define ANALYSIS_BLOCK_FFT   0  // Windowed fft_stereo() every STFT_HOP_SIZE samples
+#define ANALYSIS_SLIDING_DFT 1  // sdft_update() on every sample
+#define ANALYSIS_GOERTZEL    2  // goertzel_update() on every sample
+#define ANALYSIS_MULTIRES    3  // Block FFT plus a decimated low-band FFT
+
+#define ANALYSIS_MODE ANALYSIS_BLOCK_FFT
+
+// In the block FFT modes, frames overlap and start this many samples apart; 
+// must divide NUM_SAMPLES (NUM_SAMPLES gives back-to-back frames)
+#define STFT_HOP_SIZE 32
+
+#if (ANALYSIS_MODE == ANALYSIS_MULTIRES) && (STFT_HOP_SIZE % MULTIRES_DECIMATION)
+#  error "STFT_HOP_SIZE must be a multiple of MULTIRES_DECIMATION"
+#endif
+
+// In the per-sample modes (sliding DFT, Goertzel), the spectrum is analysed 
+// every this many samples
+#define SAMPLE_RENDER_INTERVAL 32
+
+// Samples between analysis frames in the selected mode
+#if (ANALYSIS_MODE == ANALYSIS_SLIDING_DFT) || (ANALYSIS_MODE == ANALYSIS_GOERTZEL)
+#  define ANALYSIS_HOP SAMPLE_RENDER_INTERVAL
+#else
+#  define ANALYSIS_HOP STFT_HOP_SIZE
+#endif
+
+#if ANALYSIS_DEADLINE < 1
+#  error "ANALYSIS_HOP must span at least one scheduler tick"
+#endif
+
+// A DMA block holds several frames. Capture stops after each frame until 
+// analysis has taken it, unless more than this many sample pairs are already 
+// waiting; analysis has then fallen behind, and frames are skipped rather 
+// than letting the ring overflow
+#define CAPTURE_MAX_BACKLOG (RING_SIZE/2)
+
+// Number of entries in the spectrum handed to band selection; index 0 is 
+// meaningless (DC for the FFT modes), so Goertzel note n lives at index n + 1
+#if ANALYSIS_MODE == ANALYSIS_GOERTZEL
+#  define NUM_SPECTRUM_BINS (GOERTZEL_NUM_NOTES + 1)
+#elif ANALYSIS_MODE == ANALYSIS_MULTIRES
+#  define NUM_SPECTRUM_BINS MULTIRES_NUM_BINS
+#else
+#  define NUM_SPECTRUM_BINS (NUM_SAMPLES/2)
+#endif
+
+// Aggregate the spectrum into log-spaced filterbank bands before band 
+// selection; Goertzel notes are already log-spaced, so they are used as is
+#define FILTERBANK_ENABLED (ANALYSIS_MODE != ANALYSIS_GOERTZEL)
+
+// Number of entries (again with index 0 unused) that band selection sees
+#if FILTERBANK_ENABLED
+#  define NUM_SELECTION_BANDS (FILTERBANK_NUM_BANDS + 1)
+#else
+#  define NUM_SELECTION_BANDS NUM_SPECTRUM_BINS
+#endif
+
+// Analysis results for one frame
+typedef struct {
+    bool silent;                // Whether both channels were quiet
+    uint8_t num_bands;          // Number of entries in 'bands'
+    uint16_t bands[NUM_BANDS];  // Selection bands that stand out, strongest first
+    uint32_t beat_count;        // Beats detected up to this frame
+} band_frame_t;
+
+//*****************************************************************************
+// Called by the capture ISR for every completed block; posts the capture 
+// task.
+//*****************************************************************************
+void capture_block_ready(void);
+
 #endif
@@ -0,0 +1,124 @@
+//*****************************************************************************
+// Band to LED Mapping Library
+// Usage: Call mapping_init() once with a mode, the number of bands (index 0 
+//   is meaningless) and the number of LEDs. mapping_apply() then raises the 
+//   levels of the LEDs a band covers, using spans precomputed in integers, 
+//   so each call costs one step per LED touched. Band 1 is the lowest 
+//   frequency and sits at the red (last) end of the strip, matching the 
+//   LED palette.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "mapping.h"
+
+#define FULL_WEIGHT (1 << MAPPING_WEIGHT_SHIFT)
+
+// Set by mapping_init()
+static uint8_t mapping_mode;
+static uint16_t mapping_num_bands;
+static uint16_t mapping_num_leds;
+
+// Band b covers LEDs first_led[b] to last_led[b] inclusive; the end LEDs are 
+// weighted by first_weight[b] and last_weight[b], the rest fully
+static uint16_t first_led[MAPPING_MAX_BANDS];
+static uint16_t last_led[MAPPING_MAX_BANDS];
+static uint16_t first_weight[MAPPING_MAX_BANDS];
+static uint16_t last_weight[MAPPING_MAX_BANDS];
+
+//*****************************************************************************
+// Places band 'b' in slot 'slot' of 'num_slots' equal bars over the 'length' 
+// LEDs from 'start', with fractional ends in Q8.
+//*****************************************************************************
+static void build_bar(uint16_t b, uint16_t slot, uint16_t num_slots, uint16_t start, uint16_t length) {
+    uint32_t low = ((uint32_t) slot * length << MAPPING_WEIGHT_SHIFT) / num_slots;
+    uint32_t high = ((uint32_t) (slot + 1) * length << MAPPING_WEIGHT_SHIFT) / num_slots;
+    uint16_t first = low >> MAPPING_WEIGHT_SHIFT;
+    uint16_t last = (high - 1) >> MAPPING_WEIGHT_SHIFT;
+    
+    first_led[b] = start + first;
+    last_led[b] = start + last;
+    if (first == last) {
+        // The whole bar lies within one LED
+        first_weight[b] = high - low;
+        last_weight[b] = high - low;
+    }
+    else {
+        first_weight[b] = FULL_WEIGHT - (low & (FULL_WEIGHT - 1));
+        last_weight[b] = high - ((uint32_t) last << MAPPING_WEIGHT_SHIFT);
+    }
+}
+
+//*****************************************************************************
+// Precomputes every band's span.
+//*****************************************************************************
+void mapping_init(uint8_t mode, uint16_t num_bands, uint16_t num_leds) {
+    uint16_t num_slots, half, b;
+    
+    if (num_bands > MAPPING_MAX_BANDS) num_bands = MAPPING_MAX_BANDS;
+    mapping_mode = mode;
+    mapping_num_bands = num_bands;
+    mapping_num_leds = num_leds;
+    if ((num_bands < 2) || (num_leds == 0)) return;
+    
+    num_slots = num_bands - 1;
+    half = num_leds / 2;
+    
+    for (b = 1; b < num_bands; b++) {
+        switch (mode) {
+            case MAPPING_BARS:
+                build_bar(b, num_slots - b, num_slots, 0, num_leds);
+                break;
+            case MAPPING_MIRRORED:
+                // Right half only, centre outwards; mapping_apply() mirrors it
+                build_bar(b, b - 1, num_slots, half, num_leds - half);
+                break;
+            default: {
+                // LED whose wavelength in the palette is nearest the band's, 
+                // i.e. round(num_leds*(num_bands - b)/num_bands)
+                uint32_t led = ((uint32_t) 2*num_leds*(num_bands - b) + num_bands) / (2*num_bands);
+                if (led >= num_leds) led = num_leds - 1;
+                first_led[b] = led;
+                last_led[b] = led;
+                first_weight[b] = FULL_WEIGHT;
+                last_weight[b] = FULL_WEIGHT;
+                break;
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+// Middle LED of a band's span.
+//*****************************************************************************
+uint16_t mapping_center(uint16_t band) {
+    if ((band == 0) || (band >= mapping_num_bands)) return 0;
+    return (first_led[band] + last_led[band]) / 2;
+}
+
+//*****************************************************************************
+// Raises levels[led] to 'level' if it is lower.
+//*****************************************************************************
+static void raise_level(uint8_t *levels, uint16_t led, uint8_t level) {
+    if (levels[led] < level) levels[led] = level;
+}
+
+//*****************************************************************************
+// Raises the LEDs band 'band' covers.
+//*****************************************************************************
+void mapping_apply(uint16_t band, uint8_t level, uint8_t *levels) {
+    uint16_t led;
+    
+    if ((band == 0) || (band >= mapping_num_bands)) return;
+    
+    for (led = first_led[band]; led <= last_led[band]; led++) {
+        uint16_t weight = FULL_WEIGHT;
+        uint8_t value;
+        
+        if (led == first_led[band]) weight = first_weight[band];
+        else if (led == last_led[band]) weight = last_weight[band];
+        value = (uint8_t) ((level * weight) >> MAPPING_WEIGHT_SHIFT);
+        
+        raise_level(levels, led, value);
+        if (mapping_mode == MAPPING_MIRRORED) raise_level(levels, mapping_num_leds - 1 - led, value);
+    }
+}
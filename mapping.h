@@ -0,0 +1,47 @@
+//*****************************************************************************
+// Band to LED Mapping Library
+// Usage: Call mapping_init() once with a mode, the number of bands (index 0 
+//   is meaningless) and the number of LEDs. mapping_apply() then raises the 
+//   levels of the LEDs a band covers, using spans precomputed in integers, 
+//   so each call costs one step per LED touched. Band 1 is the lowest 
+//   frequency and sits at the red (last) end of the strip, matching the 
+//   LED palette.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __MAPPING_H__
+#define __MAPPING_H__
+
+#include <stdint.h>
+#include "fft.h"
+
+// Mapping modes
+#define MAPPING_SINGLE   0  // Each band lights the one LED nearest its colour
+#define MAPPING_BARS     1  // Bands split the strip into equal bars
+#define MAPPING_MIRRORED 2  // Bars on each half, lowest band at the centre
+
+// Largest supported number of bands
+#define MAPPING_MAX_BANDS NUM_SAMPLES
+
+// Bar edges are weighted in Q8 by how much of the LED the bar covers
+#define MAPPING_WEIGHT_SHIFT 8
+
+//*****************************************************************************
+// Precomputes the span of each of bands 1 to num_bands - 1 across 'num_leds' 
+// LEDs for 'mode'. Extra bands beyond MAPPING_MAX_BANDS are ignored.
+//*****************************************************************************
+void mapping_init(uint8_t mode, uint16_t num_bands, uint16_t num_leds);
+
+//*****************************************************************************
+// Returns the LED in the middle of band 'band''s span (on the right half for 
+// MAPPING_MIRRORED), or 0 for an invalid band.
+//*****************************************************************************
+uint16_t mapping_center(uint16_t band);
+
+//*****************************************************************************
+// Raises each LED band 'band' covers to at least 'level', scaled by the 
+// LED's weight; 'levels' has one entry per LED.
+//*****************************************************************************
+void mapping_apply(uint16_t band, uint8_t level, uint8_t *levels);
+
+#endif
@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Multi-Resolution Analysis Library
+// Usage: Run each channel through a multires_decimator_t with 
+//   multires_decimate(); the decimated stream feeds a second NUM_SAMPLES-point 
+//   FFT whose bins are MULTIRES_DECIMATION times narrower. The low bins of 
+//   that FFT and the remaining bins of the full-rate FFT form one merged 
+//   spectrum, laid out by the MULTIRES_* macros in multires.h.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "multires.h"
+
+// Halfband lowpass (0.5 at the centre tap, every other tap zero): 
+// [3, 0, -25, 0, 150, 256, 150, 0, -25, 0, 3] / 512; unity gain at DC
+#define HALFBAND_CENTER 0.5f
+#define HALFBAND_1      (150.0f/512)
+#define HALFBAND_3      (-25.0f/512)
+#define HALFBAND_5      (3.0f/512)
+
+//*****************************************************************************
+// Clears a decimator's delay lines.
+//*****************************************************************************
+void multires_init(multires_decimator_t *decimator) {
+    uint8_t stage, tap;
+    
+    for (stage = 0; stage < MULTIRES_NUM_STAGES; stage++) {
+        for (tap = 0; tap < MULTIRES_TAPS; tap++) decimator->delay[stage][tap] = 0.0f;
+    }
+    decimator->odd = 0;
+}
+
+//*****************************************************************************
+// Pushes one full-rate sample through the halfband cascade. Each stage only 
+// computes an output on every second input, using its 4 non-zero tap pairs.
+//*****************************************************************************
+bool multires_decimate(multires_decimator_t *decimator, float sample, float *output) {
+    uint8_t stage, tap;
+    
+    for (stage = 0; stage < MULTIRES_NUM_STAGES; stage++) {
+        float *x = decimator->delay[stage];
+        
+        for (tap = MULTIRES_TAPS - 1; tap > 0; tap--) x[tap] = x[tap - 1];
+        x[0] = sample;
+        
+        // Every other input only fills the delay line
+        decimator->odd ^= 1 << stage;
+        if (decimator->odd & (1 << stage)) return false;
+        
+        sample = HALFBAND_CENTER * x[5] + 
+                 HALFBAND_1 * (x[4] + x[6]) + 
+                 HALFBAND_3 * (x[2] + x[8]) + 
+                 HALFBAND_5 * (x[0] + x[10]);
+    }
+    
+    *output = sample;
+    return true;
+}
@@ -0,0 +1,50 @@
+//*****************************************************************************
+// Multi-Resolution Analysis Library
+// Usage: Run each channel through a multires_decimator_t with 
+//   multires_decimate(); the decimated stream feeds a second NUM_SAMPLES-point 
+//   FFT whose bins are MULTIRES_DECIMATION times narrower. The low bins of 
+//   that FFT and the remaining bins of the full-rate FFT form one merged 
+//   spectrum, laid out by the MULTIRES_* macros below.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __MULTIRES_H__
+#define __MULTIRES_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "fft.h"
+
+#define MULTIRES_NUM_STAGES 3  // Halfband stages, each decimating by 2
+#define MULTIRES_DECIMATION (1 << MULTIRES_NUM_STAGES)
+#define MULTIRES_TAPS       11 // Length of each halfband filter
+
+// Low-band bins used in the merged spectrum; stopping at 3/4 of the low-band 
+// Nyquist frequency keeps out the halfband filters' transition band
+#define MULTIRES_LOW_BINS (NUM_SAMPLES*3/8)
+
+// First full-rate bin above the highest low-band bin
+#define MULTIRES_FIRST_HIGH_BIN (MULTIRES_LOW_BINS/MULTIRES_DECIMATION + 1)
+
+// Merged spectrum: index 0 is meaningless, indices 1 to MULTIRES_LOW_BINS are 
+// low-band bins, and the rest are full-rate bins from MULTIRES_FIRST_HIGH_BIN
+#define MULTIRES_NUM_BINS (1 + MULTIRES_LOW_BINS + NUM_SAMPLES/2 - MULTIRES_FIRST_HIGH_BIN)
+#define MULTIRES_HIGH_INDEX(k) (MULTIRES_LOW_BINS + 1 + (k) - MULTIRES_FIRST_HIGH_BIN)
+
+typedef struct {
+    float delay[MULTIRES_NUM_STAGES][MULTIRES_TAPS];  // Newest sample first
+    uint8_t odd;  // Bit s is set when stage s is between output samples
+} multires_decimator_t;
+
+//*****************************************************************************
+// Clears a decimator's delay lines.
+//*****************************************************************************
+void multires_init(multires_decimator_t *decimator);
+
+//*****************************************************************************
+// Pushes one full-rate sample through the halfband cascade. Returns true and 
+// writes 'output' once every MULTIRES_DECIMATION samples.
+//*****************************************************************************
+bool multires_decimate(multires_decimator_t *decimator, float sample, float *output);
+
+#endif
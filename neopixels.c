@@ -10,14 +10,137 @@
 #include "neopixels.h"
 #include "print.h"
 
+#if NEOPIXELS_DRIVER == NEOPIXELS_SSI
+#  ifndef PART_TM4C123GH6PM
+#    define PART_TM4C123GH6PM
+#  endif
+#  include "driverlib/pin_map.h"
+#  include "driverlib/ssi.h"
+#  include "driverlib/udma.h"
+#  include "inc/hw_ints.h"
+#  include "inc/hw_memmap.h"
+#  include "inc/hw_ssi.h"
+#endif
+
 // Set by neopixels_config(); used as arguments for flash_neopixels()
 static uint32_t gpio_base;
 static uint8_t pin_mask;
 
-// Array stores the color of each LED as a 24-bit RGB code; the upper byte is 
-// ignored, and the remaining 24 bits are the RGB code
-uint32_t neopixel_data[NUM_NEOPIXELS];
-static uint32_t dud[NUM_NEOPIXELS];
+// Called when a frame has been sent
+static void (*frame_sent_callback)(void);
+
+#if NEOPIXELS_MULTI_LANE
+// Set by neopixel_lanes_config()
+static uint32_t lanes_gpio_base;
+static uint8_t lanes_pin_mask;
+
+// Port value for each bit slot, filled by lanes_transpose() before sending
+static uint8_t slots[24*NUM_NEOPIXELS];
+#endif
+
+#if NEOPIXELS_DRIVER == NEOPIXELS_SSI
+// SSI module and uDMA channel selected by neopixels_config()
+static uint32_t ssi_base;
+static uint32_t dma_channel;
+
+// Encoded frame; not touched while 'busy' is set
+static uint16_t encoded[WS2812_ENCODED_WORDS(NUM_NEOPIXELS)];
+static volatile bool busy;
+#endif
+
+// Array stores the color of each LED as three bytes in the order the LEDs 
+// receive them: green, red, blue. The drivers map every byte through 
+// color_output as they send it.
+static uint8_t neopixel_data[3*NUM_NEOPIXELS];
+
+// One past the last LED changed since the last flash, and one past the last 
+// LED that may be lit; the strip only needs the prefix up to 'dirty_end'
+static uint16_t dirty_end;
+static uint16_t lit_end;
+
+#if NEOPIXELS_DRIVER == NEOPIXELS_SSI
+//*****************************************************************************
+// Hands the SSI transmit pin to the SSI module matching it, clocked at 
+// WS2812_BIT_RATE with 16-bit frames, and points its transmit uDMA channel 
+// at 'encoded'. Freescale SPI mode 1 keeps back-to-back frames gapless. 
+// Returns without configuring anything for other pins.
+//*****************************************************************************
+static void ssi_config(uint32_t pin_value) {
+    uint32_t sysctl_periph_value;
+    uint32_t interrupt;
+    
+    if ((gpio_base == GPIOA_BASE) && (pin_value == GPIO_PIN_5)) {
+        GPIOPinConfigure(GPIO_PA5_SSI0TX);
+        ssi_base = SSI0_BASE;
+        sysctl_periph_value = SYSCTL_PERIPH_SSI0;
+        dma_channel = UDMA_CH11_SSI0TX;
+        interrupt = INT_SSI0;
+    }
+    else if ((gpio_base == GPIOB_BASE) && (pin_value == GPIO_PIN_7)) {
+        GPIOPinConfigure(GPIO_PB7_SSI2TX);
+        ssi_base = SSI2_BASE;
+        sysctl_periph_value = SYSCTL_PERIPH_SSI2;
+        dma_channel = UDMA_CH13_SSI2TX;
+        interrupt = INT_SSI2;
+    }
+    else {
+        return;
+    }
+    GPIOPinTypeSSI(gpio_base, pin_value);
+    
+    SysCtlPeripheralEnable(sysctl_periph_value);
+    while (!SysCtlPeripheralReady(sysctl_periph_value));
+    SSIConfigSetExpClk(ssi_base, SysCtlClockGet(), SSI_FRF_MOTO_MODE_1, 
+                       SSI_MODE_MASTER, WS2812_BIT_RATE, 16);
+    SSIEnable(ssi_base);
+    SSIDMAEnable(ssi_base, SSI_DMA_TX);
+    
+    // The FIFO requests words as it drains; the SSI interrupt fires when the 
+    // transfer completes
+    uDMAChannelAssign(dma_channel);
+    uDMAChannelAttributeDisable(dma_channel, UDMA_ATTR_ALL);
+    uDMAChannelControlSet(dma_channel | UDMA_PRI_SELECT, 
+                          UDMA_SIZE_16 | UDMA_SRC_INC_16 | UDMA_DST_INC_NONE | UDMA_ARB_4);
+    IntEnable(interrupt);
+}
+
+//*****************************************************************************
+// Encodes 'num_leds' LEDs from 'grb' through color_output (NULL for all off) 
+// once the previous frame has been sent, and starts the uDMA controller 
+// feeding it to the SSI transmit FIFO.
+//*****************************************************************************
+static void send_frame(const uint8_t *grb, uint16_t num_leds) {
+    if (!ssi_base) return;
+    while (busy);
+    
+    ws2812_encode(grb, color_output, num_leds, encoded);
+    busy = true;
+    uDMAChannelTransferSet(dma_channel | UDMA_PRI_SELECT, UDMA_MODE_BASIC, 
+                           encoded, (void *) (ssi_base + SSI_O_DR), 
+                           WS2812_ENCODED_WORDS(num_leds));
+    uDMAChannelEnable(dma_channel);
+}
+
+//*****************************************************************************
+// Completion of the transmit transfer; the trailing reset words are still 
+// in the FIFO, so the next frame may start right away.
+//*****************************************************************************
+static void ssi_handler(void) {
+    SSIIntClear(ssi_base, SSIIntStatus(ssi_base, true));
+    if (busy && (uDMAChannelModeGet(dma_channel | UDMA_PRI_SELECT) == UDMA_MODE_STOP)) {
+        busy = false;
+        if (frame_sent_callback) frame_sent_callback();
+    }
+}
+
+void SSI0_Handler(void) {
+    ssi_handler();
+}
+
+void SSI2_Handler(void) {
+    ssi_handler();
+}
+#endif
 
 //*****************************************************************************
 // Configures the GPIO pin connected to the NeoPixels appropriately.
@@ -94,8 +217,12 @@ void neopixels_config(uint32_t new_gpio_base, uint8_t pin_number) {
     SysCtlPeripheralEnable(sysctl_periph_value);
     while (!SysCtlPeripheralReady(sysctl_periph_value));
     
+#if NEOPIXELS_DRIVER == NEOPIXELS_SSI
+    ssi_config(pin_value);
+#else
     // Configure pin as digital output
     GPIOPinTypeGPIOOutput(gpio_base, pin_value);
+#endif
 }
 
 //*****************************************************************************
@@ -164,42 +291,156 @@ static uint32_t wavelength_to_rgb_helper(double wavelength) {
 }
 
 uint32_t wavelength_to_rgb(double wavelength, bool lookup) {
-    static uint32_t lut[401];
-    uint16_t idx;
-    
     if (!lookup) return wavelength_to_rgb_helper(wavelength);
     
-    if ((wavelength < 380.0) || (wavelength > 780.0)) return 0x00000000;
+    if ((wavelength < COLOR_MIN_WAVELENGTH) || (wavelength > COLOR_MAX_WAVELENGTH)) return 0x00000000;
     
-    wavelength = round(wavelength);
-    idx = wavelength - 380;
-    if (lut[idx]) return lut[idx];
-    lut[idx] = wavelength_to_rgb_helper(wavelength);
-    return lut[idx];
+    return color_wavelength_palette[(uint16_t) (wavelength - COLOR_MIN_WAVELENGTH + 0.5)];
 }
 
 //*****************************************************************************
-// EABI compliant wrapper function that calls send_neopixels_data().
+// Sets LED 'idx' to 24-bit RGB code 'rgb', extending the range the next 
+// flash sends if the LED changed.
 //*****************************************************************************
-void flash_neopixels(void) {
+void neopixel_set(uint16_t idx, uint32_t rgb) {
+    uint8_t green = (uint8_t) (rgb >> 8);
+    uint8_t red = (uint8_t) (rgb >> 16);
+    uint8_t blue = (uint8_t) rgb;
+    uint8_t *pixel;
+    
+    if (idx >= NUM_NEOPIXELS) return;
+    pixel = &neopixel_data[3*idx];
+    if ((pixel[0] == green) && (pixel[1] == red) && (pixel[2] == blue)) return;
+    
+    pixel[0] = green;
+    pixel[1] = red;
+    pixel[2] = blue;
+    if (idx >= dirty_end) dirty_end = idx + 1;
+    if ((green | red | blue) && (idx >= lit_end)) lit_end = idx + 1;
+}
+
+uint32_t neopixel_get(uint16_t idx) {
+    const uint8_t *pixel;
+    
+    if (idx >= NUM_NEOPIXELS) return 0;
+    pixel = &neopixel_data[3*idx];
+    return ((uint32_t) pixel[1] << 16) | ((uint32_t) pixel[0] << 8) | pixel[2];
+}
+
+#if NEOPIXELS_DRIVER == NEOPIXELS_SSI
+//*****************************************************************************
+// Encodes the first 'num_leds' LEDs from 'grb' (NULL for all off) and sends 
+// them in the background.
+//*****************************************************************************
+static void send_leds(const uint8_t *grb, uint16_t num_leds) {
+    send_frame(grb, num_leds);
+}
+
+bool neopixels_busy(void) {
+    return busy;
+}
+#else
+//*****************************************************************************
+// EABI compliant wrapper function that calls send_neopixels_data() for the 
+// first 'num_leds' LEDs from 'grb', through color_output; NULL sends zeros 
+// without reading memory.
+//*****************************************************************************
+static void send_leds(const uint8_t *grb, uint16_t num_leds) {
     // Save 'gpio_base' as it is overwritten in send_neopixels_data()
     uint32_t temp = gpio_base;
     send_neopixels_data(
         gpio_base + 255*sizeof(uint32_t),  // GPIO data register address
         pin_mask,                          // GPIO pin mask
-        (uint32_t) neopixel_data,          // Data array address
-        NUM_NEOPIXELS                      // Number of NeoPixels
+        (uint32_t) grb,                    // GRB byte array address, or 0
+        3*num_leds,                        // Number of bytes
+        (uint32_t) color_output            // Output curve address
     );
     gpio_base = temp;
+    if (frame_sent_callback) frame_sent_callback();
+}
+
+bool neopixels_busy(void) {
+    return false;
+}
+#endif
+
+//*****************************************************************************
+// Sends the LEDs up to the last one changed; LEDs past it keep their colours.
+//*****************************************************************************
+void flash_neopixels(void) {
+    uint16_t num_leds = dirty_end;
+    
+    if (!num_leds) return;
+    dirty_end = 0;
+    send_leds(neopixel_data, num_leds);
 }
 
+//*****************************************************************************
+// Zeroes only the LEDs that may be lit, so clearing a dark strip sends 
+// nothing. The strip is sent zeros directly rather than the framebuffer.
+//*****************************************************************************
 void clear_neopixels(void) {
-    uint32_t temp = gpio_base;
-    send_neopixels_data(
-        gpio_base + 255*sizeof(uint32_t),  // GPIO data register address
-        pin_mask,                          // GPIO pin mask
-        (uint32_t) dud,                    // Dud array address
-        NUM_NEOPIXELS                      // Number of NeoPixels
+    uint16_t num_leds = (lit_end > dirty_end) ? lit_end : dirty_end;
+    
+    memset(neopixel_data, 0, 3*lit_end);
+    lit_end = 0;
+    dirty_end = 0;
+    if (num_leds) send_leds(NULL, num_leds);
+}
+
+void neopixels_set_callback(void (*frame_sent)(void)) {
+    frame_sent_callback = frame_sent;
+}
+
+#if NEOPIXELS_MULTI_LANE
+//*****************************************************************************
+// Configures the lane pins as digital outputs.
+//*****************************************************************************
+void neopixel_lanes_config(uint32_t lane_gpio_base, uint8_t lane_pin_mask) {
+    uint32_t sysctl_periph_value;
+    
+    switch (lane_gpio_base) {
+        case GPIOA_BASE:
+            sysctl_periph_value = SYSCTL_PERIPH_GPIOA;
+            break;
+        case GPIOB_BASE:
+            sysctl_periph_value = SYSCTL_PERIPH_GPIOB;
+            break;
+        case GPIOC_BASE:
+            sysctl_periph_value = SYSCTL_PERIPH_GPIOC;
+            break;
+        case GPIOD_BASE:
+            sysctl_periph_value = SYSCTL_PERIPH_GPIOD;
+            break;
+        case GPIOE_BASE:
+            sysctl_periph_value = SYSCTL_PERIPH_GPIOE;
+            break;
+        case GPIOF_BASE:
+            sysctl_periph_value = SYSCTL_PERIPH_GPIOF;
+            break;
+        default:
+            return;
+    }
+    lanes_gpio_base = lane_gpio_base;
+    lanes_pin_mask = lane_pin_mask;
+    
+    SysCtlPeripheralEnable(sysctl_periph_value);
+    while (!SysCtlPeripheralReady(sysctl_periph_value));
+    GPIOPinTypeGPIOOutput(lanes_gpio_base, lanes_pin_mask);
+}
+
+//*****************************************************************************
+// Transposes every lane into slots, then sends them all at once.
+//*****************************************************************************
+void flash_neopixel_lanes(const uint8_t *const lanes[LANES_MAX]) {
+    if (!lanes_pin_mask) return;
+    
+    lanes_transpose(lanes, NUM_NEOPIXELS, slots);
+    send_neopixels_slots(
+        lanes_gpio_base + (lanes_pin_mask << 2),  // Data register masked to the lanes
+        lanes_pin_mask,                           // GPIO pin mask
+        (uint32_t) slots,                         // Slot array address
+        24*NUM_NEOPIXELS                          // Number of slots
     );
-    gpio_base = temp;
 }
+#endif
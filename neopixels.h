@@ -3,7 +3,9 @@
 // Usage: Configure the desired GPIO pin for driving a NeoPixels. If needed, 
 //   convert desired frequencies of light on the visible spectrum to 24-bit 
 //   RGB codes. Connect the NeoPixels' data line to the specified pin to flash 
-//   them.
+//   them. With NEOPIXELS_DRIVER set to NEOPIXELS_SSI the strip is driven by 
+//   an SSI transmitter fed by the uDMA controller, so call dma_config() 
+//   first and use an SSI transmit pin.
 // Author: Zachary Zhou
 //*****************************************************************************
 
@@ -12,32 +14,95 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include <math.h>
 #include "driverlib/gpio.h"
 #include "driverlib/interrupt.h"
 #include "driverlib/sysctl.h"
 #include "TM4C123.h"
+#include "clock.h"
+#include "color_tables.h"
+#include "lanes.h"
+#include "ws2812.h"
 
 #define NUM_NEOPIXELS 150  // Number of NeoPixels
 
-extern uint32_t neopixel_data[NUM_NEOPIXELS];
+// Output drivers
+#define NEOPIXELS_GPIO 0  // Bit-banged by send_neopixels_data() with interrupts masked
+#define NEOPIXELS_SSI  1  // Encoded by ws2812_encode(), then sent by SSI and uDMA in the background
+
+#define NEOPIXELS_DRIVER NEOPIXELS_GPIO
+
+// Set to 1 to compile flash_neopixel_lanes(), which drives up to LANES_MAX 
+// strips of NUM_NEOPIXELS from one GPIO port at once, and its 
+// 24*NUM_NEOPIXELS-byte slot buffer
+#define NEOPIXELS_MULTI_LANE 0
+
+#if (NEOPIXELS_DRIVER == NEOPIXELS_SSI) && (WS2812_ENCODED_WORDS(NUM_NEOPIXELS) > 1024)
+#  error "NUM_NEOPIXELS exceeds a single uDMA transfer"
+#endif
 
 //*****************************************************************************
-// Configures the GPIO pin appropriately.
+// Configures the GPIO pin appropriately. The SSI driver supports PA5 (SSI0Tx) 
+// and PB7 (SSI2Tx).
 //*****************************************************************************
 void neopixels_config(uint32_t new_gpio_base, uint8_t pin_number);
 
 //*****************************************************************************
 // Converts a wavelength in nanometers to its corresponding 24-bit RGB code. 
-// Algorithm based on Dan Bruton's.
+// Algorithm based on Dan Bruton's. With 'lookup' the wavelength is rounded 
+// to the nearest nanometer and read from color_wavelength_palette.
 //*****************************************************************************
 uint32_t wavelength_to_rgb(double wavelength, bool lookup);
 
+//*****************************************************************************
+// Sets or returns the 24-bit RGB code of LED 'idx' in the framebuffer, which 
+// holds 3 bytes per LED in GRB wire order. neopixel_get() returns exactly 
+// what was set; the drivers map each byte through the output curve 
+// color_output only as they send it. Writes record the last LED changed 
+// since the previous flash; writes of an unchanged colour are free.
+//*****************************************************************************
+void neopixel_set(uint16_t idx, uint32_t rgb);
+uint32_t neopixel_get(uint16_t idx);
+
 //*****************************************************************************
 // Sends data to the LED strip following the protocol specified by the 
-// datasheet. I verified timing correctness using an oscilloscope.
+// datasheet. I verified timing correctness using an oscilloscope. Only the 
+// LEDs up to the last one changed are sent, as the rest keep their latched 
+// colours; nothing is sent if nothing changed. clear_neopixels() turns off 
+// every LED (framebuffer included) up to the last one that may be lit. The 
+// SSI driver returns as soon as the frame is encoded, first waiting for the 
+// previous frame if it is still being sent.
 //*****************************************************************************
 void flash_neopixels(void);
 void clear_neopixels(void);
 
+//*****************************************************************************
+// Returns true while a frame is still being sent; always false for the GPIO 
+// driver, which sends frames synchronously.
+//*****************************************************************************
+bool neopixels_busy(void);
+
+//*****************************************************************************
+// Sets a function called each time a frame has been sent, from the SSI 
+// interrupt with the SSI driver. NULL disables the callback.
+//*****************************************************************************
+void neopixels_set_callback(void (*frame_sent)(void));
+
+#if NEOPIXELS_MULTI_LANE
+//*****************************************************************************
+// Configures the pins in 'lane_pin_mask' on one GPIO port as outputs, one 
+// strip per pin.
+//*****************************************************************************
+void neopixel_lanes_config(uint32_t lane_gpio_base, uint8_t lane_pin_mask);
+
+//*****************************************************************************
+// Sends 'lanes[p]' (3*NUM_NEOPIXELS GRB bytes) to the strip on pin p of every 
+// configured pin, all strips in parallel, with interrupts disabled as for 
+// flash_neopixels(). The bytes are sent as they are, without the output 
+// curve. A NULL lane turns its strip off.
+//*****************************************************************************
+void flash_neopixel_lanes(const uint8_t *const lanes[LANES_MAX]);
+#endif
+
 #endif
@@ -1,9 +1,9 @@
 ;******************************************************************************
 ; NeoPixel (WS2812B) Driver for Tiva LaunchPad
 ; Usage: Connect data line on a NeoPixel strip to the specified GPIO pin. Also 
-;   provide the address and length of an array of 32-bit integers whose values 
-;   are 24-bit RGB codes of each of the NeoPixels, with the first element 
-;   corresponding to the LED closest to the GPIO pin.
+;   provide the address and length of an array of bytes holding the green, 
+;   red and blue values of each of the NeoPixels in that order, with the 
+;   first three bytes corresponding to the LED closest to the GPIO pin.
 ; Note: neopixels.s can be used independently of neopixels.c/.h, but for ease 
 ;   of use, do NOT directly call send_neopixels_data() from here; instead, use 
 ;   the wrapper function flash_neopixels().
@@ -11,23 +11,89 @@
 ;******************************************************************************
 
     export send_neopixels_data
+    export send_neopixels_slots
 
-GREEN_MASK EQU 0x00008000
-RED_MASK   EQU 0x80000000
-BLUE_MASK  EQU 0x00800000
+; Assemble with --cpreproc: the clock and the timing come from the same 
+; headers as the C sources and tools/check_neopixel_timing.c
+#include "clock_hz.h"
+#include "neopixels_timing.h"
+
+#ifndef CLOCK_HZ
+#error "CLOCK_HZ is not defined; see clock_hz.h"
+#endif
+
+BIT_MASK EQU 0x80
+
+CLOCK_MHZ EQU CLOCK_HZ/1000000
+
+; Datasheet phases and reset time, and instruction cycles
+T0H_NS   EQU NEOPIXELS_T0H_NS
+T1H_NS   EQU NEOPIXELS_T1H_NS
+T1L_NS   EQU NEOPIXELS_T1L_NS
+RESET_US EQU NEOPIXELS_RESET_US
+
+STORE_CYCLES  EQU NEOPIXELS_STORE_CYCLES
+LOAD_CYCLES   EQU NEOPIXELS_LOAD_CYCLES
+BRANCH_CYCLES EQU NEOPIXELS_BRANCH_CYCLES
+
+; Phase lengths, rounded to the nearest cycle
+T0H_CYCLES EQU (T0H_NS*CLOCK_MHZ + 500)/1000
+T1H_CYCLES EQU (T1H_NS*CLOCK_MHZ + 500)/1000
+T1L_CYCLES EQU (T1L_NS*CLOCK_MHZ + 500)/1000
+
+; NOPs padding each phase of send_neopixels_data(), net of its other 
+; instructions. tools/check_neopixel_timing.c repeats these calculations for 
+; every supported clock and checks them against the datasheet tolerances.
+    ASSERT T0H_CYCLES >= 3 + STORE_CYCLES
+    ASSERT T1H_CYCLES - T0H_CYCLES >= 1 + STORE_CYCLES
+    ASSERT T1L_CYCLES >= 2 + BRANCH_CYCLES + STORE_CYCLES
+T0H_PAD EQU T0H_CYCLES - (3 + STORE_CYCLES)
+T1H_PAD EQU T1H_CYCLES - T0H_CYCLES - (1 + STORE_CYCLES)
+T1L_PAD EQU T1L_CYCLES - (2 + BRANCH_CYCLES + STORE_CYCLES)
+
+; Same for send_neopixels_slots(), whose middle phase matches
+    ASSERT T0H_CYCLES >= LOAD_CYCLES + STORE_CYCLES
+    ASSERT T1L_CYCLES >= 1 + BRANCH_CYCLES + STORE_CYCLES
+SLOT_T0H_PAD EQU T0H_CYCLES - (LOAD_CYCLES + STORE_CYCLES)
+SLOT_T1H_PAD EQU T1H_PAD
+SLOT_T1L_PAD EQU T1L_CYCLES - (1 + BRANCH_CYCLES + STORE_CYCLES)
+
+; Reset wait: WAIT_PAD NOPs, a SUBS and a taken branch per iteration, 
+; rounded up to whole iterations
+WAIT_PAD   EQU NEOPIXELS_WAIT_PAD
+WAIT_LOOPS EQU (RESET_US*CLOCK_MHZ + WAIT_PAD + BRANCH_CYCLES)/(WAIT_PAD + 1 + BRANCH_CYCLES)
 
 gpio_data_addr   RN r0
 gpio_pin_m       RN r1
 neopixel_data    RN r2
-num_neopixels    RN r3
+num_bytes        RN r3
 gpio_data        RN r4
 inv_gpio_pin_m   RN r5
-rgb_code         RN r6
-color_mask        RN r7
-color_loop_cnt   RN r8
+grb_byte         RN r6
+curve            RN r7
 bits_loop_cnt    RN r9
 wait_cnt         RN r10
 
+; send_neopixels_slots()
+slot_data_addr   RN r0
+lane_pin_m       RN r1
+slots            RN r2
+num_slots        RN r3
+slot             RN r4
+
+;******************************************************************************
+; Inserts 'cycles' NOPs.
+;******************************************************************************
+    MACRO
+    DELAY $cycles
+    LCLA count
+count SETA $cycles
+    WHILE count > 0
+    NOP
+count SETA count - 1
+    WEND
+    MEND
+
 ;******************************************************************************
 ; FLASH Segment
 ;******************************************************************************
@@ -40,12 +106,14 @@ wait_cnt         RN r10
 ; Parameters:
 ;   r0 - GPIO data register address
 ;   r1 - GPIO pin mask
-;   r2 - NeoPixel data array address
-;   r3 - Number of NeoPixels
+;   r2 - NeoPixel GRB byte array address, or 0 to send zeros
+;   r3 - Number of bytes, i.e. 3 times the number of NeoPixels
+;   [sp] - Output curve address: 256 bytes, each byte is sent as curve[byte]
 ;******************************************************************************
 send_neopixels_data PROC
-    ; Save R4 through R10
+    ; Save R4 through R10, then fetch 'curve', passed above them on the stack
     PUSH {r4-r10}
+    LDR curve, [sp, #28]
     
     ; Transmission beginning; disable interrupts
     CPSID i
@@ -54,24 +122,19 @@ send_neopixels_data PROC
     LDR gpio_data, [gpio_data_addr]
     MVN inv_gpio_pin_m, gpio_pin_m
     
-    ; In case 'num_neopixels' is 0 from the get-go, return from function
-    CMP num_neopixels, #0
+    ; In case 'num_bytes' is 0 from the get-go, return from function
+    CMP num_bytes, #0
     
-send_neopixels_data_led_loop_begin
+send_neopixels_data_byte_loop_begin
     BEQ send_neopixels_data_return
     
-    ; Begin data transfer for an LED
-    LDR rgb_code, [neopixel_data], #4
-    MOV color_loop_cnt, #3
-send_neopixels_data_color_loop_begin
-    ; Set 'color_mask' based on 'color_loop_cnt'
-    MOV color_mask, #GREEN_MASK
-    CMP color_loop_cnt, #2
-    MOVEQ color_mask, #RED_MASK
-    CMP color_loop_cnt, #1
-    MOVEQ color_mask, #BLUE_MASK
-    
-    ; Send 8 bits per color
+    ; Begin data transfer for a byte, mapped through the output curve; with 
+    ; no array, every byte is 0
+    MOVS grb_byte, neopixel_data
+    LDRBNE grb_byte, [neopixel_data], #1
+    LDRBNE grb_byte, [curve, grb_byte]
+    
+    ; Send 8 bits per byte
     MOV bits_loop_cnt, #8
 send_neopixels_data_bits_loop_begin
     ; Set appropriate bit high
@@ -79,93 +142,35 @@ send_neopixels_data_bits_loop_begin
     STR gpio_data, [gpio_data_addr]
     
     ; If next bit to transfer is 0, write 0 to bit in 'gpio_data'
-    TST rgb_code, color_mask
+    TST grb_byte, #BIT_MASK
     ANDEQ gpio_data, gpio_data, inv_gpio_pin_m
     
-    ; 'rgb_code' gets shifted, while 'color_mask' remains constant
-    LSL rgb_code, rgb_code, #1
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
+    ; 'grb_byte' gets shifted so that its next bit is tested
+    LSL grb_byte, grb_byte, #1
+    DELAY T0H_PAD
     
-    ; Assert value on pin, then put 0 in pin's bit in 'gpio_data'
+    ; Assert value on pin, then put 0 in the pin bit of 'gpio_data'
     STR gpio_data, [gpio_data_addr]
     AND gpio_data, inv_gpio_pin_m
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
+    DELAY T1H_PAD
     
     ; Unconditionally pull pin low
     STR gpio_data, [gpio_data_addr]
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
+    DELAY T1L_PAD
     
-    ; If branch taken, then still transmitting same color
+    ; If branch taken, then still transmitting same byte
     SUBS bits_loop_cnt, bits_loop_cnt, #1
     BGT send_neopixels_data_bits_loop_begin
     
-    ; If branch taken, then moving onto next color
-    SUBS color_loop_cnt, color_loop_cnt, #1
-    BGT send_neopixels_data_color_loop_begin
+    ; If branch taken, then moving onto next byte
+    SUBS num_bytes, num_bytes, #1
+    BGT send_neopixels_data_byte_loop_begin
     
-    ; If branch taken, then moving onto next LED
-    SUBS num_neopixels, num_neopixels, #1
-    BGT send_neopixels_data_led_loop_begin
-
-    ; Wait >50 microseconds, i.e., 250 * 0.2 microseconds
-    MOV wait_cnt, #250
+    ; Wait RESET_US microseconds
+    LDR wait_cnt, =WAIT_LOOPS
     
 send_neopixels_data_wait
-    ; 10 NOPs = 0.2 microseconds, and branching takes some time too
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
-    NOP
+    DELAY WAIT_PAD
     
     SUBS wait_cnt, wait_cnt, #1
     BGT send_neopixels_data_wait
@@ -180,5 +185,67 @@ send_neopixels_data_return
     BX LR
     ENDP
     ALIGN
+
+;******************************************************************************
+; EABI compliant function that sends one bit to each of up to 8 NeoPixel 
+; strips on the same GPIO port per bit slot, so every strip takes as long as 
+; a single one. Each slot byte holds the bits for all pins (see 
+; lanes_transpose()). Timing matches send_neopixels_data().
+; Parameters:
+;   r0 - GPIO data register address masked to the lane pins
+;   r1 - GPIO pin mask of the lanes
+;   r2 - Slot array address
+;   r3 - Number of slots, i.e. 24 times the number of NeoPixels per strip
+;******************************************************************************
+send_neopixels_slots PROC
+    ; Save R4 and R10
+    PUSH {r4, r10}
+    
+    ; Transmission beginning; disable interrupts
+    CPSID i
+    
+    ; In case 'num_slots' is 0 from the get-go, return from function
+    CMP num_slots, #0
+    BEQ send_neopixels_slots_wait_begin
+    
+send_neopixels_slots_loop_begin
+    ; Set every lane high; the address mask leaves other pins untouched
+    STR lane_pin_m, [slot_data_addr]
+    
+    ; Fetch the slot while the pins are high
+    LDRB slot, [slots], #1
+    DELAY SLOT_T0H_PAD
+    
+    ; Lanes sending a 0 go low, lanes sending a 1 stay high
+    STR slot, [slot_data_addr]
+    DELAY SLOT_T1H_PAD
+    
+    ; Unconditionally pull every lane low
+    MOV slot, #0
+    STR slot, [slot_data_addr]
+    DELAY SLOT_T1L_PAD
+    
+    SUBS num_slots, num_slots, #1
+    BGT send_neopixels_slots_loop_begin
+    
+send_neopixels_slots_wait_begin
+    ; Wait RESET_US microseconds
+    LDR wait_cnt, =WAIT_LOOPS
+    
+send_neopixels_slots_wait
+    DELAY WAIT_PAD
+    
+    SUBS wait_cnt, wait_cnt, #1
+    BGT send_neopixels_slots_wait
+    
+    ; Transmission completed; enable interrupts
+    CPSIE i
+    
+    ; Restore R4 and R10
+    POP     {r4, r10}
+    
+    BX LR
+    ENDP
+    ALIGN
     
     END
@@ -0,0 +1,30 @@
+//*****************************************************************************
+// NeoPixel GPIO Driver Timing
+// Usage: Preprocessor definitions only. neopixels.s (assembled with armasm 
+//   --cpreproc) derives its delays from these and CLOCK_HZ, and 
+//   tools/check_neopixel_timing.c repeats the derivation from the same 
+//   values for every supported clock.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __NEOPIXELS_TIMING_H__
+#define __NEOPIXELS_TIMING_H__
+
+// Phases the driver aims for, in ns: high time of a 0 and of a 1, and low 
+// time of a 1 (the low time of a 0 follows from the 1.25 microsecond bit)
+#define NEOPIXELS_T0H_NS 400
+#define NEOPIXELS_T1H_NS 800
+#define NEOPIXELS_T1L_NS 450
+
+// Reset wait in microseconds, above the datasheet minimum of 50
+#define NEOPIXELS_RESET_US 60
+
+// Cycles taken by the instructions between stores other than NOPs
+#define NEOPIXELS_STORE_CYCLES  2  // STR to a GPIO data register
+#define NEOPIXELS_LOAD_CYCLES   2  // LDRB
+#define NEOPIXELS_BRANCH_CYCLES 3  // Taken branch, including the pipeline refill
+
+// NOPs per iteration of the reset wait loop
+#define NEOPIXELS_WAIT_PAD 10
+
+#endif
@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Onset Detection Library
+// Usage: Initialize an onset_t with onset_init(), then call onset_update() 
+//   once per frame with the band powers already computed for band 
+//   selection. The detector takes the half-wave rectified spectral flux of 
+//   the log power in every band (how much each band got louder since the 
+//   last frame, ignoring bands that got quieter) and compares its sum with 
+//   a moving average of itself. 'beat' is set on frames where the flux 
+//   jumps well above that average, and 'strength' says by how much. No 
+//   extra transforms are needed and the cost is O(bands) per frame.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "onset.h"
+
+#if defined(__CC_ARM)
+#  define CLZ(x) __clz(x)
+#else
+#  define CLZ(x) __builtin_clz(x)
+#endif
+
+//*****************************************************************************
+// Approximate log2(x) in Q8, linear between powers of 2 (error below 0.09); 
+// log2(0) is taken to be 0.
+//*****************************************************************************
+static uint16_t log2_q8(uint32_t x) {
+    uint8_t msb;
+    
+    if (x == 0) return 0;
+    msb = 31 - CLZ(x);
+    
+    // The 8 bits below the leading 1 are the fraction
+    return (uint16_t) ((msb << 8) | (((x << (31 - msb)) >> 23) & 0xFF));
+}
+
+//*****************************************************************************
+// Clears the detector.
+//*****************************************************************************
+void onset_init(onset_t *onset) {
+    onset->mean = 0;
+    onset->holdoff = 0;
+    onset->primed = false;
+    onset->beat = false;
+    onset->strength = 0;
+}
+
+//*****************************************************************************
+// Processes one frame of 'power'.
+//*****************************************************************************
+void onset_update(onset_t *onset, const uint32_t *power, uint16_t *log_power, uint16_t num_bands) {
+    uint32_t flux = 0;
+    uint32_t threshold;
+    uint16_t i;
+    
+    for (i = 1; i < num_bands; i++) {
+        uint16_t level = log2_q8(power[i]);
+        if (level > log_power[i]) flux += level - log_power[i];
+        log_power[i] = level;
+    }
+    
+    onset->beat = false;
+    onset->strength = 0;
+    if (!onset->primed) {
+        onset->primed = true;
+        return;
+    }
+    
+    // The first flux seeds the average, so the detector does not start out 
+    // with every frame looking like a beat
+    if (onset->mean == 0) onset->mean = flux << ONSET_MEAN_SHIFT;
+    
+    // Compare against the average of previous frames, then fold this one in
+    threshold = (uint32_t) (((uint64_t) onset->mean * ONSET_THRESHOLD_Q8) >> (ONSET_MEAN_SHIFT + 8));
+    if (threshold < ONSET_MIN_FLUX) threshold = ONSET_MIN_FLUX;
+    onset->mean += flux - (onset->mean >> ONSET_MEAN_SHIFT);
+    
+    if (onset->holdoff > 0) {
+        onset->holdoff--;
+    }
+    else if (flux > threshold) {
+        uint32_t strength = ((uint64_t) flux << 8) / threshold;
+        onset->beat = true;
+        onset->strength = (strength > 0xFFFF) ? 0xFFFF : (uint16_t) strength;
+        onset->holdoff = ONSET_HOLDOFF_FRAMES;
+    }
+}
@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Onset Detection Library
+// Usage: Initialize an onset_t with onset_init(), then call onset_update() 
+//   once per frame with the band powers already computed for band 
+//   selection. The detector takes the half-wave rectified spectral flux of 
+//   the log power in every band (how much each band got louder since the 
+//   last frame, ignoring bands that got quieter) and compares its sum with 
+//   a moving average of itself. 'beat' is set on frames where the flux 
+//   jumps well above that average, and 'strength' says by how much. No 
+//   extra transforms are needed and the cost is O(bands) per frame.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __ONSET_H__
+#define __ONSET_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The flux average weighs each new frame by 2^-ONSET_MEAN_SHIFT, a time 
+// constant of 256 frames. The firmware analyses one frame per ANALYSIS_HOP 
+// (32 samples at 10 kHz, 3.2 ms, in every mode), so about 0.8 s
+#define ONSET_MEAN_SHIFT 8
+
+// A beat needs the flux to exceed the average times ONSET_THRESHOLD_Q8/256, 
+// and to be at least ONSET_MIN_FLUX (1/256ths of an octave of power summed 
+// over bands) so that noise in a quiet passage does not count
+#define ONSET_THRESHOLD_Q8 512
+#define ONSET_MIN_FLUX     1024
+
+// Frames after a beat during which no other beat is reported (about 100 ms 
+// at one frame per 3.2 ms hop)
+#define ONSET_HOLDOFF_FRAMES 32
+
+typedef struct {
+    uint32_t mean;     // Flux average, scaled by 2^ONSET_MEAN_SHIFT
+    uint8_t holdoff;   // Frames left before another beat can be reported
+    bool primed;       // Whether the previous log powers are valid
+    bool beat;         // Whether the last frame was an onset
+    uint16_t strength; // Last frame's flux over the threshold, Q8 (0 if no beat)
+} onset_t;
+
+//*****************************************************************************
+// Clears the detector; the next frame only records the band powers.
+//*****************************************************************************
+void onset_init(onset_t *onset);
+
+//*****************************************************************************
+// Processes one frame of 'power' (indices 1 to num_bands - 1). 'log_power' 
+// is caller-owned storage of the same size that carries each band's log 
+// power from one frame to the next. Sets 'beat' and 'strength'.
+//*****************************************************************************
+void onset_update(onset_t *onset, const uint32_t *power, uint16_t *log_power, uint16_t num_bands);
+
+#endif
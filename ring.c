@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Sample Ring Buffer Library
+// Usage: A ring_t carries 32-bit items (e.g. a stereo pair of samples) from 
+//   exactly one producer (e.g. an ISR) to exactly one consumer (e.g. the 
+//   main loop). Initialize it with ring_init(), then call ring_push() only 
+//   from the producer and ring_pop() only from the consumer. Neither side 
+//   ever waits or masks interrupts: each index is written by one side only, 
+//   and a barrier orders the data against the index that publishes it. A 
+//   push onto a full ring drops the item and counts an overrun. Plain C, so 
+//   it also builds on Linux, where a thread can stand in for the ISR (see 
+//   tools/check_ring.c).
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "ring.h"
+
+// Keeps the compiler (and, on multi-core hosts, the CPU) from moving memory 
+// accesses across it
+#if defined(__CC_ARM)
+#  define BARRIER() __dmb(0xF)
+#else
+#  define BARRIER() __sync_synchronize()
+#endif
+
+//*****************************************************************************
+// Empties a ring and clears its counters.
+//*****************************************************************************
+void ring_init(ring_t *ring) {
+    ring->head = 0;
+    ring->tail = 0;
+    ring->overruns = 0;
+    ring->high_water = 0;
+}
+
+//*****************************************************************************
+// Producer side. The indices run freely and wrap at 2^32; since RING_SIZE 
+// divides 2^32, masking them still finds the right slot and their 
+// difference is always the number of items held.
+//*****************************************************************************
+bool ring_push(ring_t *ring, uint32_t item) {
+    uint32_t head = ring->head;
+    uint32_t count = head - ring->tail;
+    
+    if (count >= RING_SIZE) {
+        ring->overruns++;
+        return false;
+    }
+    
+    ring->items[head & (RING_SIZE - 1)] = item;
+    
+    // The item must be in place before the consumer can see the new head
+    BARRIER();
+    ring->head = head + 1;
+    
+    if (count + 1 > ring->high_water) ring->high_water = count + 1;
+    return true;
+}
+
+//*****************************************************************************
+// Consumer side.
+//*****************************************************************************
+bool ring_pop(ring_t *ring, uint32_t *item) {
+    uint32_t tail = ring->tail;
+    
+    if (ring->head == tail) return false;
+    
+    // Read the item only after seeing the head that published it, and 
+    // release the slot only after reading it
+    BARRIER();
+    *item = ring->items[tail & (RING_SIZE - 1)];
+    BARRIER();
+    ring->tail = tail + 1;
+    return true;
+}
+
+//*****************************************************************************
+// Number of items currently held.
+//*****************************************************************************
+uint32_t ring_count(const ring_t *ring) {
+    return ring->head - ring->tail;
+}
@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Sample Ring Buffer Library
+// Usage: A ring_t carries 32-bit items (e.g. a stereo pair of samples) from 
+//   exactly one producer (e.g. an ISR) to exactly one consumer (e.g. the 
+//   main loop). Initialize it with ring_init(), then call ring_push() only 
+//   from the producer and ring_pop() only from the consumer. Neither side 
+//   ever waits or masks interrupts: each index is written by one side only, 
+//   and a barrier orders the data against the index that publishes it. A 
+//   push onto a full ring drops the item and counts an overrun. Plain C, so 
+//   it also builds on Linux, where a thread can stand in for the ISR (see 
+//   tools/check_ring.c).
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __RING_H__
+#define __RING_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Capacity in items; must be a power of 2
+#define RING_SIZE 1024
+
+#if RING_SIZE & (RING_SIZE - 1)
+#  error "RING_SIZE must be a power of 2"
+#endif
+
+typedef struct {
+    volatile uint32_t head;        // Items pushed so far; written by the producer only
+    volatile uint32_t tail;        // Items popped so far; written by the consumer only
+    volatile uint32_t overruns;    // Items dropped because the ring was full
+    volatile uint32_t high_water;  // Most items ever held at once
+    uint32_t items[RING_SIZE];
+} ring_t;
+
+//*****************************************************************************
+// Empties a ring and clears its counters.
+//*****************************************************************************
+void ring_init(ring_t *ring);
+
+//*****************************************************************************
+// Producer side: appends 'item', or counts an overrun and returns false if 
+// the ring is full.
+//*****************************************************************************
+bool ring_push(ring_t *ring, uint32_t item);
+
+//*****************************************************************************
+// Consumer side: removes the oldest item into 'item', or returns false if 
+// the ring is empty.
+//*****************************************************************************
+bool ring_pop(ring_t *ring, uint32_t *item);
+
+//*****************************************************************************
+// Number of items currently held. Exact on either side; from anywhere else 
+// it is a snapshot.
+//*****************************************************************************
+uint32_t ring_count(const ring_t *ring);
+
+#endif
@@ -0,0 +1,184 @@
+//*****************************************************************************
+// Cooperative Scheduler Library
+// Usage: Register each task with sched_add(), giving it a priority (0 runs 
+//   first), an optional deadline and an optional period, then call 
+//   sched_run(), which never returns. ISRs (and tasks) request a run with 
+//   sched_post(); a timer ISR calls sched_tick() SCHED_TICK_HZ times a 
+//   second to advance time and post periodic tasks. Tasks run to 
+//   completion, highest priority first, and the CPU sleeps in WFI whenever 
+//   nothing is pending. A task that starts more than its deadline after 
+//   being posted counts a miss. Everything but the sleep is plain C, so 
+//   sched_run_once() and sched_tick() can be driven on a host.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "sched.h"
+
+// WFI wakes on a pending interrupt even with interrupts masked, so masking 
+// them around the final check closes the window in which a post could 
+// arrive just before the CPU goes to sleep
+#if defined(__CC_ARM)
+#  define DISABLE_INTERRUPTS() __disable_irq()
+#  define ENABLE_INTERRUPTS()  __enable_irq()
+#  define WAIT_FOR_INTERRUPT() __wfi()
+#elif defined(__GNUC__) && defined(__ARM_ARCH)
+#  define DISABLE_INTERRUPTS() __asm volatile ("cpsid i" ::: "memory")
+#  define ENABLE_INTERRUPTS()  __asm volatile ("cpsie i" ::: "memory")
+#  define WAIT_FOR_INTERRUPT() __asm volatile ("wfi")
+#else
+// Host builds have nothing to wait for
+#  define DISABLE_INTERRUPTS() ((void) 0)
+#  define ENABLE_INTERRUPTS()  ((void) 0)
+#  define WAIT_FOR_INTERRUPT() ((void) 0)
+#endif
+
+typedef struct {
+    sched_task_t task;
+    uint8_t priority;
+    uint32_t deadline;            // Ticks; 0 for none
+    uint32_t period;              // Ticks; 0 for none
+    uint32_t countdown;           // Ticks until the next periodic post
+    volatile bool pending;        // Set by sched_post(), cleared before running
+    volatile uint32_t posted_at;  // Tick of the post that set 'pending'
+    uint32_t misses;
+} task_entry_t;
+
+static task_entry_t tasks[SCHED_MAX_TASKS];
+
+// Task IDs sorted by priority
+static uint8_t order[SCHED_MAX_TASKS];
+static uint8_t num_tasks;
+
+static volatile uint32_t ticks;
+
+//*****************************************************************************
+// Removes every task and resets the tick count.
+//*****************************************************************************
+void sched_init(void) {
+    num_tasks = 0;
+    ticks = 0;
+}
+
+//*****************************************************************************
+// Registers 'task' and returns its ID.
+//*****************************************************************************
+uint8_t sched_add(sched_task_t task, uint8_t priority, uint32_t deadline, uint32_t period) {
+    task_entry_t *entry;
+    uint8_t id = num_tasks;
+    uint8_t i;
+    
+    if (num_tasks == SCHED_MAX_TASKS) return SCHED_INVALID;
+    
+    entry = &tasks[id];
+    entry->task = task;
+    entry->priority = priority;
+    entry->deadline = deadline;
+    entry->period = period;
+    entry->countdown = period;
+    entry->pending = false;
+    entry->posted_at = 0;
+    entry->misses = 0;
+    
+    // Insert after every task of the same or higher priority
+    for (i = num_tasks; (i > 0) && (tasks[order[i - 1]].priority > priority); i--) {
+        order[i] = order[i - 1];
+    }
+    order[i] = id;
+    num_tasks++;
+    
+    return id;
+}
+
+//*****************************************************************************
+// Marks task 'id' as ready to run. 'posted_at' is written before 'pending', 
+// so the consumer never pairs a new post with a stale time.
+//*****************************************************************************
+void sched_post(uint8_t id) {
+    task_entry_t *entry;
+    
+    if (id >= num_tasks) return;
+    entry = &tasks[id];
+    if (!entry->pending) {
+        entry->posted_at = ticks;
+        entry->pending = true;
+    }
+}
+
+//*****************************************************************************
+// Advances time by one tick and posts any periodic task that is due.
+//*****************************************************************************
+void sched_tick(void) {
+    uint8_t id;
+    
+    ticks++;
+    for (id = 0; id < num_tasks; id++) {
+        if (tasks[id].period == 0) continue;
+        if (--tasks[id].countdown == 0) {
+            tasks[id].countdown = tasks[id].period;
+            sched_post(id);
+        }
+    }
+}
+
+//*****************************************************************************
+// Runs the highest-priority pending task, if any. 'pending' is cleared 
+// before the task runs, so a post that arrives meanwhile runs it again 
+// rather than being lost.
+//*****************************************************************************
+bool sched_run_once(void) {
+    uint8_t i;
+    
+    for (i = 0; i < num_tasks; i++) {
+        task_entry_t *entry = &tasks[order[i]];
+        uint32_t posted_at;
+        
+        if (!entry->pending) continue;
+        
+        posted_at = entry->posted_at;
+        entry->pending = false;
+        if ((entry->deadline != 0) && (ticks - posted_at > entry->deadline)) entry->misses++;
+        
+        entry->task();
+        return true;
+    }
+    return false;
+}
+
+//*****************************************************************************
+// Returns whether any task is pending.
+//*****************************************************************************
+static bool any_pending(void) {
+    uint8_t id;
+    
+    for (id = 0; id < num_tasks; id++) {
+        if (tasks[id].pending) return true;
+    }
+    return false;
+}
+
+//*****************************************************************************
+// Runs tasks forever, sleeping whenever none is pending.
+//*****************************************************************************
+void sched_run(void) {
+    while (1) {
+        if (sched_run_once()) continue;
+        
+        DISABLE_INTERRUPTS();
+        if (!any_pending()) WAIT_FOR_INTERRUPT();
+        ENABLE_INTERRUPTS();
+    }
+}
+
+//*****************************************************************************
+// Ticks since sched_init().
+//*****************************************************************************
+uint32_t sched_now(void) {
+    return ticks;
+}
+
+//*****************************************************************************
+// Number of times task 'id' started later than its deadline.
+//*****************************************************************************
+uint32_t sched_misses(uint8_t id) {
+    return (id < num_tasks) ? tasks[id].misses : 0;
+}
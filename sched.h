@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Cooperative Scheduler Library
+// Usage: Register each task with sched_add(), giving it a priority (0 runs 
+//   first), an optional deadline and an optional period, then call 
+//   sched_run(), which never returns. ISRs (and tasks) request a run with 
+//   sched_post(); a timer ISR calls sched_tick() SCHED_TICK_HZ times a 
+//   second to advance time and post periodic tasks. Tasks run to 
+//   completion, highest priority first, and the CPU sleeps in WFI whenever 
+//   nothing is pending. A task that starts more than its deadline after 
+//   being posted counts a miss. Everything but the sleep is plain C, so 
+//   sched_run_once() and sched_tick() can be driven on a host.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __SCHED_H__
+#define __SCHED_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SCHED_MAX_TASKS 8
+
+// Rate at which sched_tick() is called; a multiple of the LED refresh rate in 
+// main.h, so that rendering runs at exactly that rate
+#define SCHED_TICK_HZ 1200
+
+#define SCHED_INVALID 0xFF  // Returned by sched_add() when the table is full
+
+typedef void (*sched_task_t)(void);
+
+//*****************************************************************************
+// Removes every task and resets the tick count.
+//*****************************************************************************
+void sched_init(void);
+
+//*****************************************************************************
+// Registers 'task' and returns its ID. Lower 'priority' values run first; 
+// tasks of equal priority run in the order they were added. 'deadline' is 
+// the most ticks a posted task may wait before it starts (0 for none), and 
+// 'period' posts the task every that many ticks (0 for none).
+//*****************************************************************************
+uint8_t sched_add(sched_task_t task, uint8_t priority, uint32_t deadline, uint32_t period);
+
+//*****************************************************************************
+// Marks task 'id' as ready to run; safe to call from ISRs. Posting a task 
+// that is already pending does nothing, so it runs once for both posts and 
+// its deadline counts from the first.
+//*****************************************************************************
+void sched_post(uint8_t id);
+
+//*****************************************************************************
+// Advances time by one tick and posts any periodic task that is due.
+//*****************************************************************************
+void sched_tick(void);
+
+//*****************************************************************************
+// Runs the highest-priority pending task, if any; returns whether one ran.
+//*****************************************************************************
+bool sched_run_once(void);
+
+//*****************************************************************************
+// Runs tasks forever, sleeping until the next interrupt whenever none is 
+// pending.
+//*****************************************************************************
+void sched_run(void);
+
+//*****************************************************************************
+// Ticks since sched_init().
+//*****************************************************************************
+uint32_t sched_now(void);
+
+//*****************************************************************************
+// Number of times task 'id' started later than its deadline.
+//*****************************************************************************
+uint32_t sched_misses(uint8_t id);
+
+#endif
@@ -0,0 +1,48 @@
+//*****************************************************************************
+// Sliding Discrete Fourier Transform Library
+// Usage: Initialize one sdft_t per channel with sdft_init(), then feed every 
+//   new sample to sdft_update(). The 'bins' member always holds the DFT of 
+//   the most recent NUM_SAMPLES samples (bins 0 to NUM_SAMPLES/2 - 1), so a 
+//   spectrum can be read at any time instead of once per block.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "sdft.h"
+#include "fft_tables.h"
+
+//*****************************************************************************
+// Clears the sample history and spectrum.
+//*****************************************************************************
+void sdft_init(sdft_t *sdft) {
+    uint16_t i;
+    
+    for (i = 0; i < NUM_SAMPLES; i++) sdft->history[i] = 0.0f;
+    for (i = 0; i < SDFT_NUM_BINS; i++) sdft->bins[i] = 0.0f;
+    sdft->oldest = 0;
+    
+    sdft->comb_gain = 1.0f;
+    for (i = 0; i < NUM_SAMPLES; i++) sdft->comb_gain *= SDFT_DAMPING;
+}
+
+//*****************************************************************************
+// Slides the window forward by one sample and updates every bin; O(bins).
+// Each bin is a comb filter followed by a resonator:
+//   S[k] = r*e^(2*pi*i*k/N) * (S[k] + x[n] - r^N * x[n - N])
+//*****************************************************************************
+void sdft_update(sdft_t *sdft, float sample) {
+    float delta = sample - sdft->comb_gain * sdft->history[sdft->oldest];
+    uint16_t k;
+    
+    sdft->history[sdft->oldest] = sample;
+    sdft->oldest = (sdft->oldest + 1) & (NUM_SAMPLES - 1);
+    
+    for (k = 0; k < SDFT_NUM_BINS; k++) {
+        // The table holds e^(-2*pi*i*k/N); the resonator rotates the other way
+        float w_re = SDFT_DAMPING * fft_twiddles[k][0];
+        float w_im = -SDFT_DAMPING * fft_twiddles[k][1];
+        float s_re = crealf(sdft->bins[k]) + delta;
+        float s_im = cimagf(sdft->bins[k]);
+        
+        sdft->bins[k] = (w_re*s_re - w_im*s_im) + (w_re*s_im + w_im*s_re)*I;
+    }
+}
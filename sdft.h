@@ -0,0 +1,41 @@
+//*****************************************************************************
+// Sliding Discrete Fourier Transform Library
+// Usage: Initialize one sdft_t per channel with sdft_init(), then feed every 
+//   new sample to sdft_update(). The 'bins' member always holds the DFT of 
+//   the most recent NUM_SAMPLES samples (bins 0 to NUM_SAMPLES/2 - 1), so a 
+//   spectrum can be read at any time instead of once per block.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __SDFT_H__
+#define __SDFT_H__
+
+#include <complex.h>
+#include <stdint.h>
+#include "fft.h"
+
+#define SDFT_NUM_BINS (NUM_SAMPLES/2)
+
+// Pole radius of the resonators. 1.0f is the textbook sliding DFT, which sits 
+// on the unit circle and slowly accumulates rounding error; a radius slightly 
+// below 1 keeps it stable at the cost of a tiny amount of spectral leakage.
+#define SDFT_DAMPING 0.9999f
+
+typedef struct {
+    float history[NUM_SAMPLES];         // Last NUM_SAMPLES samples, circular
+    uint16_t oldest;                    // Index of the oldest sample
+    float comb_gain;                    // SDFT_DAMPING^NUM_SAMPLES
+    float complex bins[SDFT_NUM_BINS];  // Current spectrum
+} sdft_t;
+
+//*****************************************************************************
+// Clears the sample history and spectrum.
+//*****************************************************************************
+void sdft_init(sdft_t *sdft);
+
+//*****************************************************************************
+// Slides the window forward by one sample and updates every bin; O(bins).
+//*****************************************************************************
+void sdft_update(sdft_t *sdft, float sample);
+
+#endif
@@ -0,0 +1,270 @@
+//*****************************************************************************
+// Packed Effects Checker
+// Usage: Host program; build and run it after changing effects.c, e.g.
+//     cc -O2 -I. -o check_effects tools/check_effects.c effects.c
+//     ./check_effects
+//   Checks both builds of the packed layer functions byte for byte against
+//   a scalar reference: the portable SWAR build linked from effects.c, and
+//   the Cortex-M4 build (EFFECTS_USE_SIMD), compiled here from the same
+//   source with UQADD8 and UQSUB8 replaced by C models of the instructions
+//   as the ARM Architecture Reference Manual defines them. Then times the
+//   render task's four passes on the host with the SWAR build and the scalar
+//   reference. The host compiler may vectorize the scalar loops, so the SWAR
+//   build can come out slower here; neither time says anything about
+//   UQADD8 and UQSUB8 on the Cortex-M4, which only the target can measure.
+//   Exits with status 1 if any output differs.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "effects.h"
+
+//*****************************************************************************
+// Models of UQADD8 and UQSUB8: each byte lane saturates on its own, to 255
+// and to 0 respectively.
+//*****************************************************************************
+static uint32_t model_uqadd8(uint32_t a, uint32_t b) {
+    uint32_t result = 0;
+    uint8_t lane;
+    
+    for (lane = 0; lane < 32; lane += 8) {
+        uint32_t sum = ((a >> lane) & 0xFF) + ((b >> lane) & 0xFF);
+        result |= ((sum > 0xFF) ? 0xFF : sum) << lane;
+    }
+    return result;
+}
+
+static uint32_t model_uqsub8(uint32_t a, uint32_t b) {
+    uint32_t result = 0;
+    uint8_t lane;
+    
+    for (lane = 0; lane < 32; lane += 8) {
+        uint32_t x = (a >> lane) & 0xFF;
+        uint32_t y = (b >> lane) & 0xFF;
+        result |= ((x > y) ? x - y : 0) << lane;
+    }
+    return result;
+}
+
+// Compile the Cortex-M4 build of effects.c under other names, so that it
+// sits alongside the SWAR build linked in
+#define __UQADD8 model_uqadd8
+#define __UQSUB8 model_uqsub8
+#define EFFECTS_USE_SIMD
+#define effects_fade         simd_effects_fade
+#define effects_add          simd_effects_add
+#define effects_peak_hold    simd_effects_peak_hold
+#define effects_ripple_start simd_effects_ripple_start
+#define effects_ripple_step  simd_effects_ripple_step
+#include "effects.c"
+#undef effects_fade
+#undef effects_add
+#undef effects_peak_hold
+#undef effects_ripple_start
+#undef effects_ripple_step
+
+// LEDs per layer, as NUM_NEOPIXELS in neopixels.h
+#define NUM_LEDS 150
+
+// Random layers per correctness check, and frames per timing run
+#define TEST_LAYERS   2000
+#define TIMING_FRAMES 200000
+
+// Shifts used by the render task in main.h
+#define FADE_SHIFT  2
+#define TRAIL_SHIFT 3
+
+typedef struct {
+    const char *name;
+    void (*fade)(uint8_t *layer, uint16_t num_bytes, uint8_t shift);
+    void (*add)(uint8_t *dst, const uint8_t *src, uint16_t num_bytes);
+    void (*peak_hold)(uint8_t *peaks, const uint8_t *levels, uint16_t num_bytes, uint8_t shift);
+} build_t;
+
+static uint8_t layer[EFFECTS_PADDED(NUM_LEDS)] __attribute__((aligned(4)));
+static uint8_t other[EFFECTS_PADDED(NUM_LEDS)] __attribute__((aligned(4)));
+static uint8_t expected[EFFECTS_PADDED(NUM_LEDS)];
+
+// Render task layers for the timing runs
+static uint8_t levels[EFFECTS_PADDED(NUM_LEDS)] __attribute__((aligned(4)));
+static uint8_t trails[EFFECTS_PADDED(NUM_LEDS)] __attribute__((aligned(4)));
+static uint8_t ripples[EFFECTS_PADDED(NUM_LEDS)] __attribute__((aligned(4)));
+static uint8_t display[EFFECTS_PADDED(NUM_LEDS)] __attribute__((aligned(4)));
+
+// Folded from every output so the timed loops cannot be optimized away
+static volatile uint8_t sink;
+
+static bool passed = true;
+
+//*****************************************************************************
+// Scalar reference, one byte at a time.
+//*****************************************************************************
+static uint8_t reference_fade_byte(uint8_t x, uint8_t shift) {
+    uint8_t step = (x >> shift) ? (x >> shift) : 1;
+    return (x > step) ? x - step : 0;
+}
+
+static void reference_fade(uint8_t *layer, uint16_t num_bytes, uint8_t shift) {
+    uint16_t i;
+    
+    for (i = 0; i < num_bytes; i++) layer[i] = reference_fade_byte(layer[i], shift);
+}
+
+static void reference_add(uint8_t *dst, const uint8_t *src, uint16_t num_bytes) {
+    uint16_t i;
+    
+    for (i = 0; i < num_bytes; i++) dst[i] = (dst[i] + src[i] > 0xFF) ? 0xFF : dst[i] + src[i];
+}
+
+static void reference_peak_hold(uint8_t *peaks, const uint8_t *levels, uint16_t num_bytes, uint8_t shift) {
+    uint16_t i;
+    
+    for (i = 0; i < num_bytes; i++) {
+        uint8_t faded = reference_fade_byte(peaks[i], shift);
+        peaks[i] = (faded > levels[i]) ? faded : levels[i];
+    }
+}
+
+static const build_t REFERENCE = {"Scalar reference", reference_fade, reference_add, reference_peak_hold};
+static const build_t SWAR = {"SWAR build", effects_fade, effects_add, effects_peak_hold};
+static const build_t SIMD = {"Cortex-M4 build (modelled)", simd_effects_fade, simd_effects_add, simd_effects_peak_hold};
+
+//*****************************************************************************
+// Deterministic pseudo-random byte, so every run sees the same input. Every
+// fourth layer is filled from the ends of the range, where saturation and
+// the minimum fade step of 1 are decided.
+//*****************************************************************************
+static uint8_t next_byte(uint32_t n) {
+    static const uint8_t EDGES[] = {0, 1, 2, 7, 8, 15, 16, 127, 128, 129, 254, 255};
+    static uint32_t state = 1;
+    
+    state = state * 1664525 + 1013904223;
+    if (n % 4 == 0) return EDGES[(state >> 24) % sizeof(EDGES)];
+    return (uint8_t) (state >> 24);
+}
+
+//*****************************************************************************
+// Fills 'layer' and 'other' with random bytes for test layer 'n'.
+//*****************************************************************************
+static void fill_layers(uint32_t n) {
+    uint16_t i;
+    
+    for (i = 0; i < sizeof(layer); i++) {
+        layer[i] = next_byte(n);
+        other[i] = next_byte(n);
+    }
+}
+
+//*****************************************************************************
+// Counts the bytes where 'layer' differs from 'expected'.
+//*****************************************************************************
+static uint32_t count_mismatches(void) {
+    uint32_t mismatches = 0;
+    uint16_t i;
+    
+    for (i = 0; i < sizeof(layer); i++) {
+        if (layer[i] != expected[i]) mismatches++;
+    }
+    return mismatches;
+}
+
+//*****************************************************************************
+// Prints one result and whether it passed.
+//*****************************************************************************
+static void report(const char *name, uint32_t mismatches) {
+    printf("  %-24s %8u mismatches  %s\n", name, (unsigned) mismatches, (mismatches == 0) ? "ok" : "FAIL");
+    if (mismatches != 0) passed = false;
+}
+
+//*****************************************************************************
+// Compares every function of 'build' with the reference on TEST_LAYERS
+// random padded layers, for every shift.
+//*****************************************************************************
+static void check_build(const build_t *build) {
+    uint32_t fade = 0, add = 0, peak_hold = 0;
+    uint32_t n;
+    uint8_t shift;
+    
+    printf("%s\n", build->name);
+    for (n = 0; n < TEST_LAYERS; n++) {
+        shift = n % 8;
+        
+        fill_layers(n);
+        memcpy(expected, layer, sizeof(layer));
+        reference_fade(expected, sizeof(expected), shift);
+        build->fade(layer, NUM_LEDS, shift);
+        fade += count_mismatches();
+        
+        fill_layers(n);
+        memcpy(expected, layer, sizeof(layer));
+        reference_add(expected, other, sizeof(expected));
+        build->add(layer, other, NUM_LEDS);
+        add += count_mismatches();
+        
+        fill_layers(n);
+        memcpy(expected, layer, sizeof(layer));
+        reference_peak_hold(expected, other, sizeof(expected), shift);
+        build->peak_hold(layer, other, NUM_LEDS, shift);
+        peak_hold += count_mismatches();
+    }
+    report("effects_fade()", fade);
+    report("effects_add()", add);
+    report("effects_peak_hold()", peak_hold);
+}
+
+//*****************************************************************************
+// Seconds on a monotonic clock.
+//*****************************************************************************
+static double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+//*****************************************************************************
+// Times the passes render_task() in main.c makes each frame with 'build',
+// in microseconds per frame.
+//*****************************************************************************
+static double time_frame(const build_t *build) {
+    double start;
+    uint32_t f;
+    
+    memset(trails, 0, sizeof(trails));
+    memset(ripples, 0, sizeof(ripples));
+    
+    start = now();
+    for (f = 0; f < TIMING_FRAMES; f++) {
+        // A new level on one LED each frame, as the mapping would write
+        levels[f % NUM_LEDS] = (uint8_t) f;
+        ripples[(f*7) % NUM_LEDS] = 0xC0;
+        
+        build->fade(levels, NUM_LEDS, FADE_SHIFT);
+        build->peak_hold(trails, levels, NUM_LEDS, TRAIL_SHIFT);
+        build->fade(ripples, NUM_LEDS, FADE_SHIFT);
+        memcpy(display, trails, sizeof(display));
+        build->add(display, ripples, NUM_LEDS);
+        sink ^= display[f % NUM_LEDS];
+    }
+    return (now() - start) / TIMING_FRAMES * 1e6;
+}
+
+int main(void) {
+    double swar_us, reference_us;
+    
+    check_build(&SWAR);
+    check_build(&SIMD);
+    
+    swar_us = time_frame(&SWAR);
+    reference_us = time_frame(&REFERENCE);
+    printf("Host time per frame, render passes on %d LEDs\n", NUM_LEDS);
+    printf("  (not indicative of UQADD8 and UQSUB8 on the Cortex-M4)\n");
+    printf("  SWAR build        %8.3f us\n", swar_us);
+    printf("  Scalar reference  %8.3f us\n", reference_us);
+    
+    printf("%s\n", passed ? "All effects checks passed" : "Effects checks failed");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,181 @@
+//*****************************************************************************
+// Q15 FFT Checker
+// Usage: Host program; build and run it after changing fft_q15.c, once per
+//   supported NUM_SAMPLES, e.g.
+//     SOURCES="tools/check_fft_q15.c fft_q15.c fft.c fft_tables.c"
+//     for n in 64 128 256 512 1024 2048; do
+//         cc -O2 -I. -DNUM_SAMPLES=$n -o check_fft_q15 $SOURCES -lm
+//         ./check_fft_q15 || break
+//     done
+//   Transforms test signals with fft_q15() and with the floating-point fft()
+//   and reports the error over all bins: the RMS difference as a fraction of
+//   the RMS of the reference spectrum, and the largest difference in any bin
+//   as a fraction of the largest bin. Full-scale inputs force the most
+//   scaling; low-level ones show the precision lost to the fixed input scale.
+//   Then times both on the host; the portable C butterflies say little about
+//   the DSP instructions on the target, so the times are for reference only.
+//   Exits with status 1 if any error exceeds MAX_RMS_ERROR or MAX_PEAK_ERROR.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include <complex.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include "fft.h"
+#include "fft_q15.h"
+
+// Errors tolerated: the RMS error relative to the RMS of the spectrum, and
+// the error in any bin relative to the largest bin. The worst measured are
+// 0.0029 and 0.030, both on the -36 dB noise at 2048 points; the fixed
+// input scale leaves low-level signals with fewer bits.
+#define MAX_RMS_ERROR  0.005
+#define MAX_PEAK_ERROR 0.05
+
+// Transforms per timing run
+#define TIMING_RUNS 20000
+
+static float complex reference[NUM_SAMPLES];
+static q15_complex_t packed[NUM_SAMPLES];
+static int16_t input_re[NUM_SAMPLES];
+static int16_t input_im[NUM_SAMPLES];
+
+// Folded from every output so the timed loops cannot be optimized away
+static volatile uint32_t sink;
+
+static bool passed = true;
+
+//*****************************************************************************
+// Deterministic pseudo-random sample from -32768 to 32767, so every run sees
+// the same input.
+//*****************************************************************************
+static int16_t next_random(void) {
+    static uint32_t state = 1;
+    state = state * 1664525 + 1013904223;
+    return (int16_t) (state >> 16);
+}
+
+//*****************************************************************************
+// Loads 'input_re' and 'input_im' into both transforms' buffers, as Q15 and
+// as fractions of full scale.
+//*****************************************************************************
+static void load_input(void) {
+    uint16_t i;
+    
+    for (i = 0; i < NUM_SAMPLES; i++) {
+        reference[i] = input_re[i] / 32768.0f + I*(input_im[i] / 32768.0f);
+        packed[i] = Q15_COMPLEX(input_re[i], input_im[i]);
+    }
+}
+
+//*****************************************************************************
+// Transforms the input both ways, then prints the RMS error relative to the
+// RMS of the reference spectrum and the worst bin's error relative to the
+// largest bin, and whether both are within bounds.
+//*****************************************************************************
+static void check_signal(const char *name) {
+    double error_energy = 0, energy = 0;
+    double peak = 0, worst = 0;
+    double scale, rms_error, peak_error;
+    bool ok;
+    uint16_t i;
+    
+    load_input();
+    fft(reference);
+    scale = ldexp(1.0, fft_q15(packed)) / 32768.0;
+    
+    for (i = 0; i < NUM_SAMPLES; i++) {
+        double re = Q15_REAL(packed[i])*scale - crealf(reference[i]);
+        double im = Q15_IMAG(packed[i])*scale - cimagf(reference[i]);
+        double magnitude = cabsf(reference[i]);
+        
+        error_energy += re*re + im*im;
+        energy += magnitude*magnitude;
+        if (sqrt(re*re + im*im) > worst) worst = sqrt(re*re + im*im);
+        if (magnitude > peak) peak = magnitude;
+    }
+    rms_error = sqrt(error_energy / energy);
+    peak_error = worst / peak;
+    
+    ok = (rms_error <= MAX_RMS_ERROR) && (peak_error <= MAX_PEAK_ERROR);
+    printf("  %-28s %10.6f %10.6f  %s\n", name, rms_error, peak_error, ok ? "ok" : "FAIL");
+    if (!ok) passed = false;
+}
+
+//*****************************************************************************
+// Seconds on a monotonic clock.
+//*****************************************************************************
+static double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+int main(void) {
+    double start, q15_us, float_us;
+    uint32_t r;
+    uint16_t i;
+    
+    printf("Error against fft(), %d points\n", NUM_SAMPLES);
+    printf("  %-28s %10s %10s\n", "", "RMS", "Worst bin");
+    printf("  %-28s %10.6f %10.6f\n", "Bound", MAX_RMS_ERROR, MAX_PEAK_ERROR);
+    
+    for (i = 0; i < NUM_SAMPLES; i++) {
+        input_re[i] = next_random();
+        input_im[i] = next_random();
+    }
+    check_signal("Full-scale noise");
+    
+    for (i = 0; i < NUM_SAMPLES; i++) {
+        input_re[i] = next_random() / 64;
+        input_im[i] = next_random() / 64;
+    }
+    check_signal("Noise at -36 dB");
+    
+    // Everything adds up in one bin, the most growth a transform can have
+    for (i = 0; i < NUM_SAMPLES; i++) {
+        input_re[i] = 32767;
+        input_im[i] = -32768;
+    }
+    check_signal("Full-scale DC");
+    
+    for (i = 0; i < NUM_SAMPLES; i++) {
+        double phase = 2*PI*5*i/NUM_SAMPLES;
+        input_re[i] = (int16_t) lround(32767*cos(phase));
+        input_im[i] = (int16_t) lround(32767*sin(phase));
+    }
+    check_signal("Full-scale tone in bin 5");
+    
+    for (i = 0; i < NUM_SAMPLES; i++) {
+        double phase = 2*PI*10.3*i/NUM_SAMPLES;
+        input_re[i] = (int16_t) lround(16000*cos(phase) + next_random()/256);
+        input_im[i] = (int16_t) lround(16000*sin(2.1*phase) + next_random()/256);
+    }
+    check_signal("Off-bin tones with noise");
+    
+    // Each run reloads the last signal, so both times include loading both
+    // buffers
+    start = now();
+    for (r = 0; r < TIMING_RUNS; r++) {
+        load_input();
+        sink ^= fft_q15(packed) + packed[r % NUM_SAMPLES];
+    }
+    q15_us = (now() - start) / TIMING_RUNS * 1e6;
+    
+    start = now();
+    for (r = 0; r < TIMING_RUNS; r++) {
+        load_input();
+        fft(reference);
+        sink ^= (uint32_t) (crealf(reference[r % NUM_SAMPLES]) * 1024);
+    }
+    float_us = (now() - start) / TIMING_RUNS * 1e6;
+    
+    printf("Host time per transform (not indicative of the target)\n");
+    printf("  fft_q15()  %8.2f us\n", q15_us);
+    printf("  fft()      %8.2f us\n", float_us);
+    
+    printf("%s\n", passed ? "All Q15 FFT checks passed" : "Q15 FFT checks failed");
+    return passed ? 0 : 1;
+}
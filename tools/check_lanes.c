@@ -0,0 +1,138 @@
+//*****************************************************************************
+// Lane Transpose Checker
+// Usage: Host program; build and run it after changing lanes.c, e.g.
+//     cc -O2 -I. -o check_lanes tools/check_lanes.c lanes.c
+//     ./check_lanes
+//   Compares lanes_transpose() with a bit-by-bit reference for several
+//   lane layouts, then times both on full frames. Exits with status 1 if
+//   any output differs or the transpose is not faster than the reference.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "lanes.h"
+
+// LEDs per strip in the timed frames
+#define NUM_LEDS 150
+
+// Frames per timing run
+#define TIMING_FRAMES 20000
+
+static uint8_t framebuffers[LANES_MAX][3*NUM_LEDS];
+static uint8_t slots[24*NUM_LEDS];
+static uint8_t reference_slots[24*NUM_LEDS];
+
+// Folded from every output so the timed loops cannot be optimized away
+static volatile uint8_t sink;
+
+static bool passed = true;
+
+//*****************************************************************************
+// Reference: builds every slot one bit at a time, MSB of each colour byte
+// first, with bit p taken from lane p.
+//*****************************************************************************
+static void reference_transpose(const uint8_t *const lanes[LANES_MAX], uint16_t num_leds, uint8_t *out) {
+    uint32_t i;
+    int8_t bit;
+    uint8_t lane;
+    
+    for (i = 0; i < 3u*num_leds; i++) {
+        for (bit = 7; bit >= 0; bit--) {
+            uint8_t slot = 0;
+            for (lane = 0; lane < LANES_MAX; lane++) {
+                if (lanes[lane] && ((lanes[lane][i] >> bit) & 1)) slot |= 1 << lane;
+            }
+            *out++ = slot;
+        }
+    }
+}
+
+//*****************************************************************************
+// Checks lanes_transpose() against the reference for the lanes in 'mask'
+// (bit p set if pin p has a strip) and 'num_leds' LEDs.
+//*****************************************************************************
+static void check_layout(const char *name, uint8_t mask, uint16_t num_leds) {
+    const uint8_t *lanes[LANES_MAX];
+    uint32_t mismatches = 0;
+    uint32_t i;
+    uint8_t lane;
+    
+    for (lane = 0; lane < LANES_MAX; lane++) {
+        lanes[lane] = ((mask >> lane) & 1) ? framebuffers[lane] : NULL;
+    }
+    
+    memset(slots, 0xEE, sizeof(slots));
+    lanes_transpose(lanes, num_leds, slots);
+    reference_transpose(lanes, num_leds, reference_slots);
+    
+    for (i = 0; i < 24u*num_leds; i++) {
+        if (slots[i] != reference_slots[i]) mismatches++;
+    }
+    
+    // Nothing past the last slot is written
+    for (i = 24u*num_leds; i < sizeof(slots); i++) {
+        if (slots[i] != 0xEE) mismatches++;
+    }
+    
+    printf("  %-32s %6u mismatches  %s\n", name, (unsigned) mismatches, (mismatches == 0) ? "ok" : "FAIL");
+    if (mismatches != 0) passed = false;
+}
+
+//*****************************************************************************
+// Seconds on a monotonic clock.
+//*****************************************************************************
+static double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+int main(void) {
+    const uint8_t *lanes[LANES_MAX];
+    uint32_t state = 1;
+    double start, transpose_us, reference_us;
+    uint32_t i, f;
+    uint8_t lane;
+    
+    for (lane = 0; lane < LANES_MAX; lane++) {
+        for (i = 0; i < 3*NUM_LEDS; i++) {
+            state = state * 1664525 + 1013904223;
+            framebuffers[lane][i] = (uint8_t) (state >> 24);
+        }
+        lanes[lane] = framebuffers[lane];
+    }
+    
+    printf("Correctness against the bit-by-bit reference\n");
+    check_layout("All 8 lanes", 0xFF, NUM_LEDS);
+    check_layout("Lanes 0, 3 and 7", 0x89, NUM_LEDS);
+    check_layout("Lane 5 only", 0x20, NUM_LEDS);
+    check_layout("No lanes", 0x00, NUM_LEDS);
+    check_layout("All 8 lanes, 1 LED", 0xFF, 1);
+    check_layout("All 8 lanes, 0 LEDs", 0xFF, 0);
+    
+    start = now();
+    for (f = 0; f < TIMING_FRAMES; f++) {
+        lanes_transpose(lanes, NUM_LEDS, slots);
+        sink ^= slots[f % sizeof(slots)];
+    }
+    transpose_us = (now() - start) / TIMING_FRAMES * 1e6;
+    
+    start = now();
+    for (f = 0; f < TIMING_FRAMES; f++) {
+        reference_transpose(lanes, NUM_LEDS, reference_slots);
+        sink ^= reference_slots[f % sizeof(reference_slots)];
+    }
+    reference_us = (now() - start) / TIMING_FRAMES * 1e6;
+    
+    printf("Host time per frame, 8 lanes x %d LEDs\n", NUM_LEDS);
+    printf("  lanes_transpose()  %8.2f us\n", transpose_us);
+    printf("  Bit-by-bit         %8.2f us  (%.1fx)\n", reference_us, reference_us / transpose_us);
+    if (transpose_us >= reference_us) passed = false;
+    
+    printf("%s\n", passed ? "All lane checks passed" : "Lane checks failed");
+    return passed ? 0 : 1;
+}
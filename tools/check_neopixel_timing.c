@@ -0,0 +1,116 @@
+//*****************************************************************************
+// NeoPixel Timing Checker
+// Usage: Host program; build and run it after changing neopixels_timing.h, 
+//   the delay calculations in neopixels.s or the supported clocks in 
+//   clock_hz.h, e.g.
+//     cc -I. -o check_neopixel_timing tools/check_neopixel_timing.c
+//     ./check_neopixel_timing
+//   For every supported clock it repeats the delay calculations of 
+//   neopixels.s, and the SSI divisor TivaWare picks for WS2812_BIT_RATE, and 
+//   checks the resulting pulses against the WS2812B datasheet. Exits with 
+//   status 1 if any check fails.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "neopixels_timing.h"
+#include "ws2812.h"
+
+// Datasheet bit period and minimum reset in addition to those in ws2812.h
+#define BIT_NS       1250
+#define BIT_TOLERANCE_NS 600
+#define RESET_MIN_US 50
+
+// A low phase stretched at a byte boundary must stay far below the reset 
+// time; the LEDs tolerate several microseconds in practice
+#define MAX_LOW_NS 5000
+
+// Clocks clock_hz.h allows
+static const uint32_t CLOCKS[] = {16000000, 40000000, 50000000, 80000000};
+
+static bool passed = true;
+
+//*****************************************************************************
+// Prints one measurement and whether it lies within [low, high].
+//*****************************************************************************
+static void check(const char *name, double value, double low, double high) {
+    bool ok = (value >= low) && (value <= high);
+    printf("  %-24s %8.1f  (%.0f to %.0f)  %s\n", name, value, low, high, ok ? "ok" : "FAIL");
+    if (!ok) passed = false;
+}
+
+//*****************************************************************************
+// Checks a phase's NOP padding, which neopixels.s asserts is non-negative.
+//*****************************************************************************
+static void check_pad(const char *name, long pad) {
+    printf("  %-24s %8ld  %s\n", name, pad, (pad >= 0) ? "ok" : "FAIL");
+    if (pad < 0) passed = false;
+}
+
+//*****************************************************************************
+// Mirrors neopixels.s for one clock.
+//*****************************************************************************
+static void check_gpio(uint32_t clock_hz) {
+    long mhz = clock_hz / 1000000;
+    double ns = 1000.0 / mhz;
+    long t0h = (NEOPIXELS_T0H_NS*mhz + 500)/1000;
+    long t1h = (NEOPIXELS_T1H_NS*mhz + 500)/1000;
+    long t1l = (NEOPIXELS_T1L_NS*mhz + 500)/1000;
+    long wait_cycles = NEOPIXELS_WAIT_PAD + 1 + NEOPIXELS_BRANCH_CYCLES;
+    long wait_loops = (NEOPIXELS_RESET_US*mhz + wait_cycles - 1)/wait_cycles;
+    
+    // Extra low time at a byte boundary: an untaken BGT, then SUBS, BEQ, 
+    // MOVS, two LDRBNE (the byte and its output curve entry) and MOV
+    long boundary = 5 + 2*NEOPIXELS_LOAD_CYCLES;
+    
+    printf("GPIO driver (cycles of %.2f ns)\n", ns);
+    check_pad("T0H_PAD", t0h - (3 + NEOPIXELS_STORE_CYCLES));
+    check_pad("T1H_PAD", t1h - t0h - (1 + NEOPIXELS_STORE_CYCLES));
+    check_pad("T1L_PAD", t1l - (2 + NEOPIXELS_BRANCH_CYCLES + NEOPIXELS_STORE_CYCLES));
+    check_pad("SLOT_T0H_PAD", t0h - (NEOPIXELS_LOAD_CYCLES + NEOPIXELS_STORE_CYCLES));
+    check_pad("SLOT_T1L_PAD", t1l - (1 + NEOPIXELS_BRANCH_CYCLES + NEOPIXELS_STORE_CYCLES));
+    check("T0H (ns)", t0h*ns, WS2812_T0H_NS - WS2812_TOLERANCE_NS, WS2812_T0H_NS + WS2812_TOLERANCE_NS);
+    check("T0L (ns)", (t1h - t0h + t1l)*ns, WS2812_T0L_NS - WS2812_TOLERANCE_NS, WS2812_T0L_NS + WS2812_TOLERANCE_NS);
+    check("T1H (ns)", t1h*ns, WS2812_T1H_NS - WS2812_TOLERANCE_NS, WS2812_T1H_NS + WS2812_TOLERANCE_NS);
+    check("T1L (ns)", t1l*ns, WS2812_T1L_NS - WS2812_TOLERANCE_NS, WS2812_T1L_NS + WS2812_TOLERANCE_NS);
+    check("Bit period (ns)", (t1h + t1l)*ns, BIT_NS - BIT_TOLERANCE_NS, BIT_NS + BIT_TOLERANCE_NS);
+    check("Byte boundary low (ns)", (t1h - t0h + t1l + boundary)*ns, 0, MAX_LOW_NS);
+    check("Reset (us)", wait_loops*wait_cycles*ns/1000, RESET_MIN_US, 1000);
+}
+
+//*****************************************************************************
+// Repeats TivaWare's SSIConfigSetExpClk() divisor search, then checks the 
+// 100/110 symbols of ws2812.c at the resulting rate.
+//*****************************************************************************
+static void check_ssi(uint32_t clock_hz) {
+    uint32_t max_ratio = clock_hz / WS2812_BIT_RATE;
+    uint32_t prescale = 0, scr;
+    double bit_ns;
+    
+    do {
+        prescale += 2;
+        scr = (max_ratio / prescale) - 1;
+    } while (scr > 255);
+    bit_ns = 1e9 * prescale * (scr + 1) / clock_hz;
+    
+    printf("SSI driver (symbol bit of %.1f ns)\n", bit_ns);
+    check("T0H (ns)", bit_ns, WS2812_T0H_NS - WS2812_TOLERANCE_NS, WS2812_T0H_NS + WS2812_TOLERANCE_NS);
+    check("T0L (ns)", 2*bit_ns, WS2812_T0L_NS - WS2812_TOLERANCE_NS, WS2812_T0L_NS + WS2812_TOLERANCE_NS);
+    check("T1H (ns)", 2*bit_ns, WS2812_T1H_NS - WS2812_TOLERANCE_NS, WS2812_T1H_NS + WS2812_TOLERANCE_NS);
+    check("T1L (ns)", bit_ns, WS2812_T1L_NS - WS2812_TOLERANCE_NS, WS2812_T1L_NS + WS2812_TOLERANCE_NS);
+}
+
+int main(void) {
+    unsigned i;
+    
+    for (i = 0; i < sizeof(CLOCKS)/sizeof(CLOCKS[0]); i++) {
+        printf("=== %lu MHz ===\n", (unsigned long) (CLOCKS[i] / 1000000));
+        check_gpio(CLOCKS[i]);
+        check_ssi(CLOCKS[i]);
+    }
+    
+    printf("%s\n", passed ? "All timing within tolerance" : "Timing out of tolerance");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,158 @@
+//*****************************************************************************
+// Onset Detector Checker
+// Usage: Host program; build and run it after changing onset.c or its
+//   thresholds in onset.h, e.g.
+//     cc -O2 -I. -o check_onset tools/check_onset.c onset.c
+//     ./check_onset
+//   Feeds the detector steady noise with periodic kicks in the bass bands.
+//   Checks that every kick is reported as a beat, that no frame between
+//   kicks is, and that noise alone rarely produces one. Then times
+//   onset_update() for the band counts the firmware uses and checks the
+//   cost per frame against a small fraction of the hop. Exits with status 1
+//   if any check fails.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include "filterbank.h"
+#include "goertzel.h"
+#include "onset.h"
+
+// Time between frames at the defaults in main.h and audio.h: a hop of 32
+// samples at 10 kHz
+#define HOP_US 3200
+
+// Host time allowed per frame, as a fraction of the hop; the target is
+// roughly an order of magnitude slower than a desktop CPU
+#define BUDGET_FRACTION 0.01
+
+// Detection test: frames simulated, frames between kicks, bass bands hit by
+// each kick and how much louder they get
+#define TEST_FRAMES   3000
+#define KICK_INTERVAL 150
+#define KICK_BANDS    8
+#define KICK_GAIN     16
+
+// Beats tolerated on noise alone over TEST_FRAMES frames (about one per
+// 3 s at the default hop); a steady spectrum still has random flux
+#define MAX_FALSE_BEATS 3
+
+// Frames per timing run
+#define TIMING_FRAMES 2000000
+
+// Largest band count checked, including the unused index 0
+#define MAX_BANDS (GOERTZEL_NUM_NOTES + 1)
+
+static bool passed = true;
+
+//*****************************************************************************
+// Deterministic pseudo-random number, so every run sees the same input.
+//*****************************************************************************
+static uint32_t next_random(void) {
+    static uint32_t state = 1;
+    state = state * 1664525 + 1013904223;
+    return state >> 8;
+}
+
+//*****************************************************************************
+// Prints one result and whether it passed.
+//*****************************************************************************
+static void report(const char *name, double value, bool ok) {
+    printf("  %-36s %10.1f  %s\n", name, value, ok ? "ok" : "FAIL");
+    if (!ok) passed = false;
+}
+
+//*****************************************************************************
+// Simulates TEST_FRAMES frames of 'num_bands' bands (index 0 unused) of
+// noise, with a kick every KICK_INTERVAL frames if 'kicks' is set. Returns
+// the number of beats reported; 'missed' counts kicks without a beat and
+// 'spurious' beats without a kick.
+//*****************************************************************************
+static uint32_t simulate(uint16_t num_bands, bool kicks, uint32_t *missed, uint32_t *spurious) {
+    uint32_t power[MAX_BANDS];
+    uint16_t log_power[MAX_BANDS];
+    onset_t onset;
+    uint32_t beats = 0;
+    uint32_t f;
+    uint16_t i;
+    
+    *missed = 0;
+    *spurious = 0;
+    onset_init(&onset);
+    
+    for (f = 0; f < TEST_FRAMES; f++) {
+        // The first kick comes after the average has settled
+        bool kick = kicks && (f > 0) && (f % KICK_INTERVAL == 0);
+        
+        for (i = 1; i < num_bands; i++) {
+            power[i] = 100000 + next_random() % 30000;
+            if (kick && (i <= KICK_BANDS)) power[i] *= KICK_GAIN;
+        }
+        onset_update(&onset, power, log_power, num_bands);
+        
+        if (onset.beat) beats++;
+        if (kick && !onset.beat) (*missed)++;
+        if (!kick && onset.beat) (*spurious)++;
+    }
+    
+    return beats;
+}
+
+//*****************************************************************************
+// Checks detection for 'num_bands' bands.
+//*****************************************************************************
+static void check_detection(uint16_t num_bands) {
+    uint32_t missed, spurious;
+    uint32_t beats;
+    
+    printf("Detection with %u bands\n", num_bands - 1);
+    beats = simulate(num_bands, true, &missed, &spurious);
+    report("Beats on kicks", beats, (missed == 0) && (spurious == 0));
+    beats = simulate(num_bands, false, &missed, &spurious);
+    report("Beats on noise alone", beats, beats <= MAX_FALSE_BEATS);
+}
+
+//*****************************************************************************
+// Times onset_update() for 'num_bands' bands.
+//*****************************************************************************
+static void check_cost(uint16_t num_bands) {
+    uint32_t power[MAX_BANDS];
+    uint16_t log_power[MAX_BANDS];
+    struct timespec start, end;
+    onset_t onset;
+    double ns;
+    uint32_t f;
+    uint16_t i;
+    
+    for (i = 1; i < num_bands; i++) power[i] = 100000 + next_random() % 30000;
+    onset_init(&onset);
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (f = 0; f < TIMING_FRAMES; f++) {
+        // Change one band per frame so the work cannot be hoisted
+        power[1 + f % (num_bands - 1)] ^= f;
+        onset_update(&onset, power, log_power, num_bands);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns = ((end.tv_sec - start.tv_sec)*1e9 + (end.tv_nsec - start.tv_nsec)) / TIMING_FRAMES;
+    
+    printf("Cost with %u bands (budget %.0f ns)\n", num_bands - 1, HOP_US*1000.0*BUDGET_FRACTION);
+    report("Host time per frame (ns)", ns, ns <= HOP_US*1000.0*BUDGET_FRACTION);
+}
+
+int main(void) {
+    // Filterbank bands in the FFT modes, notes in the Goertzel mode
+    const uint16_t BAND_COUNTS[] = {FILTERBANK_NUM_BANDS + 1, GOERTZEL_NUM_NOTES + 1};
+    unsigned i;
+    
+    for (i = 0; i < sizeof(BAND_COUNTS)/sizeof(BAND_COUNTS[0]); i++) {
+        check_detection(BAND_COUNTS[i]);
+        check_cost(BAND_COUNTS[i]);
+    }
+    
+    printf("%s\n", passed ? "All onset checks passed" : "Onset checks failed");
+    return passed ? 0 : 1;
+}
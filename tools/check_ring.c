@@ -0,0 +1,134 @@
+//*****************************************************************************
+// Ring Buffer Stress Test
+// Usage: Host program; build and run it after changing ring.c, e.g.
+//     cc -O2 -pthread -iquote . -o check_ring tools/check_ring.c ring.c
+//   (-iquote, as the scheduler's sched.h would hide the system one)
+//     ./check_ring
+//   A producer thread stands in for the capture ISR and pushes numbered
+//   stereo pairs, packed as audio.c packs them, in blocks; the main thread
+//   stands in for the capture task and pops them, stalling now and then so
+//   that the ring overflows. Both threads yield rather than spin, so the
+//   test also overflows the ring on a single-core host. Every popped pair must be intact and in order,
+//   and the pairs missing from the sequence must match the overrun count.
+//   Exits with status 1 if any check fails.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "ring.h"
+
+// Pairs the producer attempts to push, and pairs per block (as in audio.h)
+#define NUM_PAIRS  20000000
+#define BLOCK_SIZE 128
+
+// Once every STALL_INTERVAL pairs it pops, the consumer stalls by yielding
+// STALL_YIELDS times; the producer pushes up to a block per yield, so this
+// is enough to overflow the ring
+#define STALL_INTERVAL 20000
+#define STALL_YIELDS   (4*RING_SIZE/BLOCK_SIZE)
+
+static ring_t ring;
+static volatile bool producer_done;
+
+// Pairs the producer gave up on; at most RING_SIZE in a row, so that the
+// consumer can always tell from a 16-bit sequence number how many it missed
+static uint32_t producer_drops;
+
+//*****************************************************************************
+// Packs pair number 'n' as audio.c does (left in the lower halfword). The
+// right sample is the complement of the left, so a pair assembled from two
+// different pushes cannot pass as intact.
+//*****************************************************************************
+static uint32_t make_pair(uint32_t n) {
+    uint16_t left = (uint16_t) n;
+    uint16_t right = (uint16_t) ~n;
+    return ((uint32_t) right << 16) | left;
+}
+
+//*****************************************************************************
+// Producer thread: pushes NUM_PAIRS pairs in blocks, dropping those that do
+// not fit; after RING_SIZE drops in a row it waits for room instead.
+//*****************************************************************************
+static void *producer(void *arg) {
+    uint32_t dropped_in_row = 0;
+    uint32_t n = 0;
+    
+    (void) arg;
+    while (n < NUM_PAIRS) {
+        uint32_t end = n + BLOCK_SIZE;
+        
+        while (n < end) {
+            if (dropped_in_row == RING_SIZE) {
+                while (ring_count(&ring) == RING_SIZE) sched_yield();
+                dropped_in_row = 0;
+            }
+            
+            if (ring_push(&ring, make_pair(n))) {
+                dropped_in_row = 0;
+            }
+            else {
+                dropped_in_row++;
+                producer_drops++;
+            }
+            n++;
+        }
+        sched_yield();
+    }
+    
+    producer_done = true;
+    return NULL;
+}
+
+int main(void) {
+    pthread_t thread;
+    uint32_t expected = 0;
+    uint32_t popped = 0;
+    uint32_t missing = 0;
+    uint32_t torn = 0;
+    uint32_t out_of_order = 0;
+    uint32_t pair;
+    bool passed;
+    
+    ring_init(&ring);
+    pthread_create(&thread, NULL, producer, NULL);
+    
+    while (!producer_done || (ring_count(&ring) > 0)) {
+        uint16_t left, right, gap;
+        
+        if (!ring_pop(&ring, &pair)) {
+            sched_yield();
+            continue;
+        }
+        left = (uint16_t) pair;
+        right = (uint16_t) (pair >> 16);
+        
+        if ((uint16_t) (left ^ right) != 0xFFFF) torn++;
+        
+        // A forward gap is pairs dropped while the ring was full
+        gap = (uint16_t) (left - (uint16_t) expected);
+        if (gap > RING_SIZE) out_of_order++;
+        missing += gap;
+        expected += gap + 1;
+        
+        if (++popped % STALL_INTERVAL == 0) {
+            uint32_t i;
+            for (i = 0; i < STALL_YIELDS; i++) sched_yield();
+        }
+    }
+    pthread_join(thread, NULL);
+    
+    // Every pair was either popped or dropped, and the ring counted each drop
+    passed = (torn == 0) && (out_of_order == 0) && (missing == ring.overruns) &&
+             (missing == producer_drops) && (popped + missing == NUM_PAIRS);
+    
+    printf("pushed %u, popped %u, overruns %u, missing %u, high water %u\n",
+           (unsigned) NUM_PAIRS, (unsigned) popped, (unsigned) ring.overruns,
+           (unsigned) missing, (unsigned) ring.high_water);
+    printf("torn pairs %u, out of order %u\n", (unsigned) torn, (unsigned) out_of_order);
+    printf("%s\n", passed ? "Ring stress test passed" : "Ring stress test failed");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,251 @@
+//*****************************************************************************
+// Scheduler Checker
+// Usage: Host program; build and run it after changing sched.c, e.g.
+//     cc -I. -o check_sched tools/check_sched.c sched.c
+//     ./check_sched
+//   Drives the scheduler with a simulated tick, calling sched_tick(),
+//   sched_post() and sched_run_once() directly, and checks priority order,
+//   coalesced posts, deadline misses and periodic posting. Exits with
+//   status 1 if any check fails.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "sched.h"
+
+// Letters of the tasks that have run, in order
+static char run_log[64];
+static uint8_t log_len;
+
+// Task that task_a posts the next time it runs, or SCHED_INVALID
+static uint8_t repost_id = SCHED_INVALID;
+
+static bool passed = true;
+
+//*****************************************************************************
+// Appends 'name' to the log.
+//*****************************************************************************
+static void log_run(char name) {
+    if (log_len < sizeof(run_log) - 1) run_log[log_len++] = name;
+    run_log[log_len] = '\0';
+}
+
+//*****************************************************************************
+// Tasks under test; each logs its letter.
+//*****************************************************************************
+static void task_a(void) {
+    log_run('A');
+    if (repost_id != SCHED_INVALID) {
+        sched_post(repost_id);
+        repost_id = SCHED_INVALID;
+    }
+}
+
+static void task_b(void) { log_run('B'); }
+static void task_c(void) { log_run('C'); }
+static void task_d(void) { log_run('D'); }
+
+//*****************************************************************************
+// Clears the log.
+//*****************************************************************************
+static void clear_log(void) {
+    log_len = 0;
+    run_log[0] = '\0';
+}
+
+//*****************************************************************************
+// Runs every pending task, as sched_run() does between interrupts.
+//*****************************************************************************
+static void run_all(void) {
+    while (sched_run_once());
+}
+
+//*****************************************************************************
+// Advances the simulated clock by 'num_ticks' ticks, running whatever is
+// pending after each one.
+//*****************************************************************************
+static void advance(uint32_t num_ticks) {
+    while (num_ticks--) {
+        sched_tick();
+        run_all();
+    }
+}
+
+//*****************************************************************************
+// Prints the log and whether it matched.
+//*****************************************************************************
+static void check_log(const char *name, const char *expected) {
+    bool ok = strcmp(run_log, expected) == 0;
+    printf("  %-40s %-10s (expected %s)  %s\n", name, run_log, expected, ok ? "ok" : "FAIL");
+    if (!ok) passed = false;
+}
+
+//*****************************************************************************
+// Prints a count and whether it matched.
+//*****************************************************************************
+static void check_count(const char *name, uint32_t value, uint32_t expected) {
+    bool ok = value == expected;
+    printf("  %-40s %-10u (expected %u)  %s\n", name, (unsigned) value, (unsigned) expected, ok ? "ok" : "FAIL");
+    if (!ok) passed = false;
+}
+
+//*****************************************************************************
+// Pending tasks run highest priority first whatever order they were posted
+// in; equal priorities run in the order they were added.
+//*****************************************************************************
+static void check_priority(void) {
+    uint8_t a, b, c, d;
+    
+    printf("Priority order\n");
+    sched_init();
+    c = sched_add(task_c, 2, 0, 0);
+    a = sched_add(task_a, 0, 0, 0);
+    b = sched_add(task_b, 1, 0, 0);
+    d = sched_add(task_d, 2, 0, 0);
+    
+    clear_log();
+    sched_post(d);
+    sched_post(c);
+    sched_post(b);
+    sched_post(a);
+    run_all();
+    check_log("Posted lowest priority first", "ABCD");
+    
+    // A post made by a running task is served before anything of lower
+    // priority that was already pending
+    clear_log();
+    sched_post(c);
+    sched_post(a);
+    repost_id = b;
+    run_all();
+    check_log("Posted from inside a task", "ABC");
+    
+    check_count("sched_run_once() with nothing pending", sched_run_once(), false);
+}
+
+//*****************************************************************************
+// A task posted again before it runs runs once, and its deadline counts
+// from the first post; a post made while it runs runs it again.
+//*****************************************************************************
+static void check_coalescing(void) {
+    uint8_t a, b;
+    
+    printf("Coalesced posts\n");
+    sched_init();
+    a = sched_add(task_a, 0, 2, 0);
+    b = sched_add(task_b, 1, 0, 0);
+    
+    clear_log();
+    sched_post(b);
+    sched_post(b);
+    sched_post(b);
+    run_all();
+    check_log("Three posts before running", "B");
+    
+    clear_log();
+    sched_post(a);
+    sched_tick();
+    sched_tick();
+    sched_post(a);
+    sched_tick();
+    run_all();
+    check_log("Reposted while waiting", "A");
+    check_count("Misses (waited 3 ticks from first post)", sched_misses(a), 1);
+    
+    clear_log();
+    sched_post(a);
+    repost_id = a;
+    run_all();
+    check_log("Posted while running", "AA");
+}
+
+//*****************************************************************************
+// A task that starts more than its deadline after being posted counts a
+// miss; one that starts exactly at its deadline, or has none, does not.
+//*****************************************************************************
+static void check_deadlines(void) {
+    uint8_t a, b;
+    
+    printf("Deadline misses\n");
+    sched_init();
+    a = sched_add(task_a, 0, 3, 0);
+    b = sched_add(task_b, 1, 0, 0);
+    
+    sched_post(a);
+    run_all();
+    check_count("Started at once", sched_misses(a), 0);
+    
+    sched_post(a);
+    sched_tick();
+    sched_tick();
+    sched_tick();
+    run_all();
+    check_count("Started at the deadline", sched_misses(a), 0);
+    
+    sched_post(a);
+    sched_tick();
+    sched_tick();
+    sched_tick();
+    sched_tick();
+    run_all();
+    check_count("Started one tick late", sched_misses(a), 1);
+    
+    sched_post(b);
+    sched_tick();
+    sched_tick();
+    sched_tick();
+    sched_tick();
+    sched_tick();
+    run_all();
+    check_count("No deadline, started late", sched_misses(b), 0);
+    
+    sched_init();
+    a = sched_add(task_a, 0, 3, 0);
+    check_count("Cleared by sched_init()", sched_misses(a), 0);
+}
+
+//*****************************************************************************
+// Periodic tasks are posted every 'period' ticks, starting one period after
+// being added, alongside tasks posted from elsewhere.
+//*****************************************************************************
+static void check_periodic(void) {
+    uint8_t a;
+    
+    printf("Periodic posting\n");
+    sched_init();
+    sched_add(task_c, 1, 0, 5);
+    sched_add(task_d, 2, 0, 2);
+    a = sched_add(task_a, 0, 0, 0);
+    
+    clear_log();
+    advance(4);
+    check_log("First 4 ticks", "DD");
+    
+    clear_log();
+    advance(6);
+    check_log("Next 6 ticks", "CDDCD");
+    check_count("Ticks elapsed", sched_now(), 10);
+    
+    // D falls due at ticks 12 and 14 while the loop is busy: one run, not two
+    clear_log();
+    sched_tick();
+    sched_tick();
+    sched_tick();
+    sched_tick();
+    sched_post(a);
+    run_all();
+    check_log("Four ticks without running", "AD");
+}
+
+int main(void) {
+    check_priority();
+    check_coalescing();
+    check_deadlines();
+    check_periodic();
+    
+    printf("%s\n", passed ? "All scheduler checks passed" : "Scheduler checks failed");
+    return passed ? 0 : 1;
+}
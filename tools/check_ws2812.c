@@ -0,0 +1,186 @@
+//*****************************************************************************
+// WS2812B Encoder Checker
+// Usage: Host program; build and run it after changing ws2812.c or the
+//   symbol constants in ws2812.h, e.g.
+//     cc -I. -o check_ws2812 tools/check_ws2812.c ws2812.c
+//     ./check_ws2812
+//   Encodes test frames with ws2812_encode() and checks the output in two
+//   ways: symbol by symbol against the 100/110 patterns, and as an LED
+//   would see it, by measuring every high and low pulse at WS2812_BIT_RATE
+//   against the WS2812B datasheet and decoding the colours back. Also
+//   checks the output curve, the reset, the word count and the null (all
+//   off) frame. Exits with status 1 if any check fails.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ws2812.h"
+
+// Largest frame encoded; odd sizes leave a partial last data word
+#define MAX_LEDS 150
+
+// Written after the encoder's output to catch it running past the end
+#define GUARD_WORD  0xA5A5
+#define GUARD_WORDS 4
+
+static bool passed = true;
+
+//*****************************************************************************
+// Prints one result and whether it passed.
+//*****************************************************************************
+static void report(const char *name, uint32_t errors) {
+    printf("  %-40s %6u errors  %s\n", name, (unsigned) errors, (errors == 0) ? "ok" : "FAIL");
+    if (errors != 0) passed = false;
+}
+
+//*****************************************************************************
+// Symbol bit 'pos' of the stream, counting from bit 15 of the first word.
+//*****************************************************************************
+static uint8_t stream_bit(const uint16_t *words, uint32_t pos) {
+    return (words[pos / 16] >> (15 - pos % 16)) & 1;
+}
+
+//*****************************************************************************
+// Whether 'ns' lies within the datasheet tolerance of 'spec_ns'.
+//*****************************************************************************
+static bool within_spec(double ns, double spec_ns) {
+    return (ns >= spec_ns - WS2812_TOLERANCE_NS) && (ns <= spec_ns + WS2812_TOLERANCE_NS);
+}
+
+//*****************************************************************************
+// Compares every data bit's symbol with the 100/110 pattern, bit by bit.
+//*****************************************************************************
+static uint32_t check_symbols(const uint8_t *grb, uint16_t num_leds, const uint16_t *words) {
+    uint32_t errors = 0;
+    uint32_t pos = 0;
+    uint32_t i;
+    int8_t bit, s;
+    
+    for (i = 0; i < 3u*num_leds; i++) {
+        for (bit = 7; bit >= 0; bit--) {
+            uint8_t symbol = ((grb[i] >> bit) & 1) ? WS2812_SYMBOL_1 : WS2812_SYMBOL_0;
+            for (s = WS2812_SYMBOL_BITS - 1; s >= 0; s--) {
+                if (stream_bit(words, pos++) != ((symbol >> s) & 1)) errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+//*****************************************************************************
+// Decodes the stream as an LED would, checking every pulse against the
+// datasheet, then checks the reset that follows and the word count.
+//*****************************************************************************
+static uint32_t check_pulses(const uint8_t *grb, uint16_t num_leds, const uint16_t *words) {
+    const double bit_ns = 1e9 / WS2812_BIT_RATE;
+    uint32_t num_words = WS2812_ENCODED_WORDS(num_leds);
+    uint32_t data_words = (num_leds*24*WS2812_SYMBOL_BITS + 15) / 16;
+    uint32_t num_bits = 16*num_words;
+    uint32_t errors = 0;
+    uint32_t pos = 0;
+    uint32_t i;
+    
+    for (i = 0; i < 24u*num_leds; i++) {
+        uint32_t high = 0, low = 0;
+        bool last = (i == 24u*num_leds - 1);
+        bool one;
+        
+        while ((pos < num_bits) && stream_bit(words, pos)) { high++; pos++; }
+        
+        // The last bit's low phase runs on into the reset
+        while ((pos < num_bits) && !stream_bit(words, pos) && (last || (low < 8))) { low++; pos++; }
+        
+        if (within_spec(high*bit_ns, WS2812_T1H_NS)) {
+            one = true;
+            if (!last && !within_spec(low*bit_ns, WS2812_T1L_NS)) errors++;
+        }
+        else if (within_spec(high*bit_ns, WS2812_T0H_NS)) {
+            one = false;
+            if (!last && !within_spec(low*bit_ns, WS2812_T0L_NS)) errors++;
+        }
+        else {
+            errors++;
+            continue;
+        }
+        
+        if (one != (((grb[i / 8] >> (7 - i % 8)) & 1) != 0)) errors++;
+        if (last && (low*bit_ns < WS2812_RESET_US*1000.0)) errors++;
+    }
+    
+    // Everything from the end of the data to the end of the output is low
+    if (pos != num_bits) errors++;
+    
+    // The reset is exactly WS2812_RESET_WORDS zero words after the data
+    if (num_words - data_words != WS2812_RESET_WORDS) errors++;
+    for (i = data_words; i < num_words; i++) {
+        if (words[i] != 0) errors++;
+    }
+    for (i = num_words; i < num_words + GUARD_WORDS; i++) {
+        if (words[i] != GUARD_WORD) errors++;
+    }
+    return errors;
+}
+
+//*****************************************************************************
+// Encodes 'grb' (or a null frame, if 'null_frame' is set) through 'curve' 
+// into a guarded buffer and checks the result against the mapped bytes; a 
+// null frame must match an all-zero one whatever the curve.
+//*****************************************************************************
+static uint32_t check_frame(const uint8_t *grb, const uint8_t *curve, uint16_t num_leds, bool null_frame) {
+    static uint16_t words[WS2812_ENCODED_WORDS(MAX_LEDS) + GUARD_WORDS];
+    static uint8_t expected[3*MAX_LEDS];
+    uint32_t i;
+    
+    for (i = 0; i < sizeof(words)/sizeof(words[0]); i++) words[i] = GUARD_WORD;
+    ws2812_encode(null_frame ? NULL : grb, curve, num_leds, words);
+    for (i = 0; i < 3u*num_leds; i++) {
+        expected[i] = null_frame ? 0 : (curve ? curve[grb[i]] : grb[i]);
+    }
+    
+    return check_symbols(expected, num_leds, words) + check_pulses(expected, num_leds, words);
+}
+
+int main(void) {
+    static uint8_t grb[3*MAX_LEDS];
+    uint8_t inverse[256];
+    const uint16_t SIZES[] = {1, 2, 3, 7, 60, MAX_LEDS};
+    uint32_t state = 1;
+    uint32_t errors;
+    unsigned i, s;
+    
+    printf("Symbol bit %.0f ns; datasheet T0H %d, T0L %d, T1H %d, T1L %d (+/- %d) ns\n",
+           1e9 / WS2812_BIT_RATE, WS2812_T0H_NS, WS2812_T0L_NS, WS2812_T1H_NS,
+           WS2812_T1L_NS, WS2812_TOLERANCE_NS);
+    
+    // Every byte value, then pseudo-random colours
+    for (i = 0; i < sizeof(grb); i++) {
+        state = state * 1664525 + 1013904223;
+        grb[i] = (i < 256) ? (uint8_t) i : (uint8_t) (state >> 24);
+    }
+    
+    // A curve that changes every byte, so a skipped lookup cannot pass
+    for (i = 0; i < 256; i++) inverse[i] = (uint8_t) (255 - i);
+    
+    errors = 0;
+    for (s = 0; s < sizeof(SIZES)/sizeof(SIZES[0]); s++) errors += check_frame(grb, NULL, SIZES[s], false);
+    report("Mixed frames, 1 to 150 LEDs", errors);
+    
+    errors = 0;
+    for (s = 0; s < sizeof(SIZES)/sizeof(SIZES[0]); s++) errors += check_frame(grb, inverse, SIZES[s], false);
+    report("Mixed frames through a curve", errors);
+    
+    memset(grb, 0xFF, sizeof(grb));
+    errors = 0;
+    for (s = 0; s < sizeof(SIZES)/sizeof(SIZES[0]); s++) errors += check_frame(grb, NULL, SIZES[s], false);
+    report("All on", errors);
+    
+    errors = 0;
+    for (s = 0; s < sizeof(SIZES)/sizeof(SIZES[0]); s++) errors += check_frame(NULL, inverse, SIZES[s], true);
+    report("Null frame (all off)", errors);
+    
+    printf("%s\n", passed ? "All encoder checks passed" : "Encoder checks failed");
+    return passed ? 0 : 1;
+}
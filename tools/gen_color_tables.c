@@ -0,0 +1,164 @@
+//*****************************************************************************
+// Colour Table Generator
+// Usage: Host program; build and run it whenever the palette, the number of 
+//   NeoPixels or the output curves need to change, e.g.
+//     cc -o gen_color_tables tools/gen_color_tables.c -lm
+//     ./gen_color_tables 150 > color_tables.c
+//   The argument is NUM_NEOPIXELS (150 if omitted); the output refuses to 
+//   compile against any other value.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MIN_WAVELENGTH 380  // nm
+#define MAX_WAVELENGTH 780  // nm
+
+// Output curve applied to every channel as it is sent: gamma, then global 
+// brightness. The palettes already carry Bruton's 0.8 gamma; a gamma of 1.0 
+// and full brightness send every colour unchanged.
+#define COLOR_GAMMA      1.0
+#define COLOR_BRIGHTNESS 255  // 0 to 255
+
+//*****************************************************************************
+// Converts a wavelength in nanometers to its corresponding 24-bit RGB code. 
+// Algorithm based on Dan Bruton's; identical to the original runtime version.
+//*****************************************************************************
+static uint32_t wavelength_to_rgb(double wavelength) {
+    const double GAMMA = 0.8;
+    double red, green, blue, factor;
+    
+    if (wavelength < 380.0) {
+        red = 0.0;
+        green = 0.0;
+        blue = 0.0;
+    }
+    else if (wavelength < 440.0) {
+        red = (440.0 - wavelength)/(440.0 - 380.0);
+        green = 0.0;
+        blue = 1.0;
+    }
+    else if (wavelength < 490.0) {
+        red = 0.0;
+        green = (wavelength - 440.0)/(490.0 - 440.0);
+        blue = 1.0;
+    }
+    else if (wavelength < 510.0) {
+        red = 0.0;
+        green = 1.0;
+        blue = (510.0 - wavelength)/(510.0 - 490.0);
+    }
+    else if (wavelength < 580.0) {
+        red = (wavelength - 510.0)/(580.0 - 510.0);
+        green = 1.0;
+        blue = 0.0;
+    }
+    else if (wavelength < 645.0) {
+        red = 1.0;
+        green = (645.0 - wavelength)/(645.0 - 580.0);
+        blue = 0.0;
+    }
+    else if (wavelength <= 780.0) {
+        red = 1.0;
+        green = 0.0;
+        blue = 0.0;
+    }
+    else {
+        red = 0.0;
+        green = 0.0;
+        blue = 0.0;
+    }
+    
+    if (wavelength < 380.0)
+        factor = 0.0;
+    else if (wavelength < 420.0)
+        factor = 0.3 + 0.7*(wavelength - 380.0)/(420.0 - 380.0);
+    else if (wavelength < 700.0)
+        factor = 1.0;
+    else if (wavelength <= 780.0)
+        factor = 0.3 + 0.7*(780.0 - wavelength)/(780.0 - 700.0);
+    else
+        factor = 0.0;
+    
+    return (((uint8_t) (pow(factor * red, GAMMA)*0xFF)) << 16) |
+            (((uint8_t) (pow(factor * green, GAMMA)*0xFF)) << 8) |
+            ((uint8_t) (pow(factor * blue, GAMMA)*0xFF));
+}
+
+//*****************************************************************************
+// Prints 'num' 24-bit codes, six per line.
+//*****************************************************************************
+static void print_codes(const uint32_t *codes, unsigned num) {
+    unsigned k;
+    for (k = 0; k < num; k++) {
+        printf("%s0x%06X,%s", (k % 6 == 0) ? "    " : " ", (unsigned) codes[k],
+               (k % 6 == 5 || k == num - 1) ? "\n" : "");
+    }
+}
+
+//*****************************************************************************
+// Prints 256 bytes, twelve per line.
+//*****************************************************************************
+static void print_curve(const uint8_t *curve) {
+    unsigned k;
+    for (k = 0; k < 256; k++) {
+        printf("%s%3u,%s", (k % 12 == 0) ? "    " : " ", curve[k],
+               (k % 12 == 11 || k == 255) ? "\n" : "");
+    }
+}
+
+int main(int argc, char **argv) {
+    unsigned num_neopixels = (argc > 1) ? (unsigned) atoi(argv[1]) : 150;
+    uint32_t palette[MAX_WAVELENGTH - MIN_WAVELENGTH + 1];
+    uint32_t *led_palette;
+    uint8_t curve[256];
+    unsigned k;
+    
+    if (num_neopixels == 0) {
+        fprintf(stderr, "usage: %s [NUM_NEOPIXELS]\n", argv[0]);
+        return 1;
+    }
+    led_palette = malloc(num_neopixels * sizeof(uint32_t));
+    if (!led_palette) return 1;
+    
+    printf("//*****************************************************************************\n");
+    printf("// Colour Lookup Tables\n");
+    printf("// Generated by tools/gen_color_tables.c; do not edit by hand.\n");
+    printf("// Author: Zachary Zhou\n");
+    printf("//*****************************************************************************\n\n");
+    printf("#include \"neopixels.h\"\n\n");
+    printf("#if NUM_NEOPIXELS != %u\n", num_neopixels);
+    printf("#  error \"Regenerate color_tables.c for NUM_NEOPIXELS\"\n");
+    printf("#endif\n\n");
+    
+    // Whole nanometers; the original runtime lookup rounded to these too
+    for (k = 0; k <= MAX_WAVELENGTH - MIN_WAVELENGTH; k++) {
+        palette[k] = wavelength_to_rgb(MIN_WAVELENGTH + k);
+    }
+    printf("const uint32_t color_wavelength_palette[COLOR_NUM_WAVELENGTHS] = {\n");
+    print_codes(palette, MAX_WAVELENGTH - MIN_WAVELENGTH + 1);
+    printf("};\n\n");
+    
+    // LEDs span the visible spectrum from violet at index 0
+    for (k = 0; k < num_neopixels; k++) {
+        double wavelength = MIN_WAVELENGTH + (double) (MAX_WAVELENGTH - MIN_WAVELENGTH)*k/num_neopixels;
+        led_palette[k] = palette[lround(wavelength) - MIN_WAVELENGTH];
+    }
+    printf("const uint32_t color_led_palette[NUM_NEOPIXELS] = {\n");
+    print_codes(led_palette, num_neopixels);
+    printf("};\n\n");
+    
+    for (k = 0; k < 256; k++) {
+        long corrected = lround(255.0 * pow(k / 255.0, COLOR_GAMMA));
+        curve[k] = (uint8_t) ((corrected * COLOR_BRIGHTNESS + 127) / 255);
+    }
+    printf("const uint8_t color_output[256] = {\n");
+    print_curve(curve);
+    printf("};\n");
+    
+    free(led_palette);
+    return 0;
+}
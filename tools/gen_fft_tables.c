@@ -0,0 +1,108 @@
+//*****************************************************************************
+// FFT Table Generator
+// Usage: Host program; build and run it whenever the twiddle, window or
+//   bit-reversal tables need to change, e.g.
+//     cc -o gen_fft_tables tools/gen_fft_tables.c -lm
+//     ./gen_fft_tables > fft_tables.c
+//   The output holds tables for every power-of-two size from FFT_MIN_SIZE to
+//   FFT_MAX_SIZE; NUM_SAMPLES selects which ones are compiled.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifndef PI
+#  define PI 3.14159265358979323846
+#endif
+
+#define FFT_MIN_SIZE 64
+#define FFT_MAX_SIZE 2048
+
+//*****************************************************************************
+// Rounds to Q15, saturating +1.0 to 0x7FFF.
+//*****************************************************************************
+static int16_t to_q15(double x) {
+    long value = lround(x * 32768.0);
+    if (value > 0x7FFF) value = 0x7FFF;
+    if (value < -0x8000) value = -0x8000;
+    return (int16_t) value;
+}
+
+//*****************************************************************************
+// Reverses the lowest 'num_bits' bits of 'x'.
+//*****************************************************************************
+static unsigned reverse(unsigned x, unsigned num_bits) {
+    unsigned x_reversed = 0;
+    while (num_bits--) {
+        x_reversed = (x_reversed << 1) | (x & 1);
+        x >>= 1;
+    }
+    return x_reversed;
+}
+
+//*****************************************************************************
+// Prints the tables for an 'n'-point FFT, guarded by NUM_SAMPLES == n.
+//*****************************************************************************
+static void print_tables(unsigned n) {
+    unsigned log2_n = 0;
+    unsigned k;
+    
+    while ((1u << log2_n) < n) log2_n++;
+    
+    printf("#%s NUM_SAMPLES == %u\n\n", (n == FFT_MIN_SIZE) ? "if" : "elif", n);
+    
+    // Radix-4 stages index up to three times the radix-2 stride
+    printf("const float fft_twiddles[3*NUM_SAMPLES/4][2] = {\n");
+    for (k = 0; k < 3*n/4; k++) {
+        double angle = -2 * PI * k / n;
+        printf("    { %.9ff, %.9ff },\n", cos(angle), sin(angle));
+    }
+    printf("};\n\n");
+    
+    printf("const uint32_t fft_q15_twiddles[NUM_SAMPLES/2] = {\n");
+    for (k = 0; k < n/2; k++) {
+        double angle = -2 * PI * k / n;
+        uint16_t re = (uint16_t) to_q15(cos(angle));
+        uint16_t im = (uint16_t) to_q15(sin(angle));
+        printf("%s0x%04X%04X,%s", (k % 6 == 0) ? "    " : " ", im, re,
+               (k % 6 == 5 || k == n/2 - 1) ? "\n" : "");
+    }
+    printf("};\n\n");
+    
+    // Periodic Hann window scaled by 2 so that its coherent gain is 1
+    printf("const float fft_window[NUM_SAMPLES] = {\n");
+    for (k = 0; k < n; k++) {
+        printf("%s%.9ff,%s", (k % 5 == 0) ? "    " : " ", 1 - cos(2 * PI * k / n),
+               (k % 5 == 4 || k == n - 1) ? "\n" : "");
+    }
+    printf("};\n\n");
+    
+    printf("const uint16_t fft_bit_reverse[NUM_SAMPLES] = {\n");
+    for (k = 0; k < n; k++) {
+        printf("%s%4u,%s", (k % 12 == 0) ? "    " : " ", reverse(k, log2_n),
+               (k % 12 == 11 || k == n - 1) ? "\n" : "");
+    }
+    printf("};\n\n");
+}
+
+int main(void) {
+    unsigned n;
+    
+    printf("//*****************************************************************************\n");
+    printf("// FFT Lookup Tables\n");
+    printf("// Generated by tools/gen_fft_tables.c; do not edit by hand.\n");
+    printf("// Author: Zachary Zhou\n");
+    printf("//*****************************************************************************\n\n");
+    printf("#include \"fft_tables.h\"\n\n");
+    
+    for (n = FFT_MIN_SIZE; n <= FFT_MAX_SIZE; n <<= 1) print_tables(n);
+    
+    printf("#else\n");
+    printf("#  error \"NUM_SAMPLES must be a power of 2 from %d to %d\"\n",
+           FFT_MIN_SIZE, FFT_MAX_SIZE);
+    printf("#endif\n");
+    
+    return 0;
+}
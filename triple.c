@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Triple Buffer Library
+// Usage: Keep three slots of any type alongside a triple_t initialized with 
+//   triple_init(). The producer fills slot triple_write_slot() and calls 
+//   triple_publish(); the consumer calls triple_acquire() and reads slot 
+//   triple_read_slot(). Each side always owns a slot of its own, so neither 
+//   ever waits for the other: the producer may publish many times between 
+//   acquisitions (only the newest survives), and the consumer may re-read 
+//   its slot as often as it likes. Publishing and acquiring exchange slot 
+//   indices without locking, so both must be called from the same 
+//   execution level (e.g. two scheduler tasks), not from an ISR.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "triple.h"
+
+//*****************************************************************************
+// Hands slots 0, 1 and 2 to the producer, the exchange and the consumer.
+//*****************************************************************************
+void triple_init(triple_t *triple) {
+    triple->write = 0;
+    triple->ready = 1;
+    triple->read = 2;
+    triple->fresh = false;
+}
+
+//*****************************************************************************
+// Slot the producer should fill next.
+//*****************************************************************************
+uint8_t triple_write_slot(const triple_t *triple) {
+    return triple->write;
+}
+
+//*****************************************************************************
+// Swaps the producer's slot with the newest one.
+//*****************************************************************************
+void triple_publish(triple_t *triple) {
+    uint8_t temp = triple->ready;
+    
+    triple->ready = triple->write;
+    triple->write = temp;
+    triple->fresh = true;
+}
+
+//*****************************************************************************
+// Swaps the consumer's slot with the newest one if it is fresh.
+//*****************************************************************************
+bool triple_acquire(triple_t *triple) {
+    uint8_t temp;
+    
+    if (!triple->fresh) return false;
+    
+    temp = triple->read;
+    triple->read = triple->ready;
+    triple->ready = temp;
+    triple->fresh = false;
+    return true;
+}
+
+//*****************************************************************************
+// Slot the consumer should read.
+//*****************************************************************************
+uint8_t triple_read_slot(const triple_t *triple) {
+    return triple->read;
+}
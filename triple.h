@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Triple Buffer Library
+// Usage: Keep three slots of any type alongside a triple_t initialized with 
+//   triple_init(). The producer fills slot triple_write_slot() and calls 
+//   triple_publish(); the consumer calls triple_acquire() and reads slot 
+//   triple_read_slot(). Each side always owns a slot of its own, so neither 
+//   ever waits for the other: the producer may publish many times between 
+//   acquisitions (only the newest survives), and the consumer may re-read 
+//   its slot as often as it likes. Publishing and acquiring exchange slot 
+//   indices without locking, so both must be called from the same 
+//   execution level (e.g. two scheduler tasks), not from an ISR.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __TRIPLE_H__
+#define __TRIPLE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    uint8_t write;  // Slot owned by the producer
+    uint8_t ready;  // Newest published slot
+    uint8_t read;   // Slot owned by the consumer
+    bool fresh;     // Whether 'ready' holds data the consumer has not seen
+} triple_t;
+
+//*****************************************************************************
+// Hands slots 0, 1 and 2 to the producer, the exchange and the consumer.
+//*****************************************************************************
+void triple_init(triple_t *triple);
+
+//*****************************************************************************
+// Slot the producer should fill next.
+//*****************************************************************************
+uint8_t triple_write_slot(const triple_t *triple);
+
+//*****************************************************************************
+// Makes the producer's slot the newest one; the producer gets the previous 
+// newest slot back to fill next.
+//*****************************************************************************
+void triple_publish(triple_t *triple);
+
+//*****************************************************************************
+// Takes the newest slot for the consumer if one was published since the 
+// last call; returns whether the consumer's slot changed.
+//*****************************************************************************
+bool triple_acquire(triple_t *triple);
+
+//*****************************************************************************
+// Slot the consumer should read.
+//*****************************************************************************
+uint8_t triple_read_slot(const triple_t *triple);
+
+#endif
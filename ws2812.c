@@ -0,0 +1,54 @@
+//*****************************************************************************
+// WS2812B Bitstream Encoder Library
+// Usage: ws2812_encode() expands GRB bytes (wire order) into the bit pattern 
+//   a serial port must shift out, MSB first, at WS2812_BIT_RATE for the LEDs 
+//   to see them. Every data bit becomes a WS2812_SYMBOL_BITS-bit symbol 
+//   that starts high: 100 for a 0 and 110 for a 1. The output is packed 
+//   into 16-bit words (first symbol bit in bit 15) and ends with enough 
+//   zero words to latch the colours. Each byte can be mapped through an 
+//   output curve as it is encoded. Plain C with no hardware dependencies.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#include "ws2812.h"
+
+//*****************************************************************************
+// Symbols of one byte's 8 bits, MSB first, in the low 24 bits.
+//*****************************************************************************
+static uint32_t encode_byte(uint8_t byte) {
+    uint32_t symbols = 0;
+    uint8_t bit;
+    
+    for (bit = 0x80; bit; bit >>= 1) {
+        symbols = (symbols << WS2812_SYMBOL_BITS) | ((byte & bit) ? WS2812_SYMBOL_1 : WS2812_SYMBOL_0);
+    }
+    return symbols;
+}
+
+//*****************************************************************************
+// Encodes 'num_leds' LEDs' GRB bytes.
+//*****************************************************************************
+void ws2812_encode(const uint8_t *grb, const uint8_t *curve, uint16_t num_leds, uint16_t *words) {
+    // Symbol bits not yet written out, left-aligned in a 64-bit accumulator 
+    // so that a whole byte's symbols always fit behind a partial word
+    uint64_t pending = 0;
+    uint8_t num_pending = 0;
+    uint16_t i;
+    
+    for (i = 0; i < 3*num_leds; i++) {
+        uint8_t byte = grb ? grb[i] : 0;
+        if (grb && curve) byte = curve[byte];
+        
+        pending |= (uint64_t) encode_byte(byte) << (64 - 8*WS2812_SYMBOL_BITS - num_pending);
+        num_pending += 8*WS2812_SYMBOL_BITS;
+        while (num_pending >= 16) {
+            *words++ = (uint16_t) (pending >> 48);
+            pending <<= 16;
+            num_pending -= 16;
+        }
+    }
+    
+    // A final partial word is padded with zeros, which the reset extends
+    if (num_pending > 0) *words++ = (uint16_t) (pending >> 48);
+    for (i = 0; i < WS2812_RESET_WORDS; i++) *words++ = 0;
+}
@@ -0,0 +1,62 @@
+//*****************************************************************************
+// WS2812B Bitstream Encoder Library
+// Usage: ws2812_encode() expands GRB bytes (wire order) into the bit pattern 
+//   a serial port must shift out, MSB first, at WS2812_BIT_RATE for the LEDs 
+//   to see them. Every data bit becomes a WS2812_SYMBOL_BITS-bit symbol 
+//   that starts high: 100 for a 0 and 110 for a 1. The output is packed 
+//   into 16-bit words (first symbol bit in bit 15) and ends with enough 
+//   zero words to latch the colours. Each byte can be mapped through an 
+//   output curve as it is encoded. Plain C with no hardware dependencies.
+// Author: Zachary Zhou
+//*****************************************************************************
+
+#ifndef __WS2812_H__
+#define __WS2812_H__
+
+#include <stdint.h>
+
+#define WS2812_BIT_RATE    2500000  // Symbol bits per second (400 ns each)
+#define WS2812_SYMBOL_BITS 3        // Symbol bits per data bit
+#define WS2812_SYMBOL_0    0x4      // 100: high for 1 bit time, low for 2
+#define WS2812_SYMBOL_1    0x6      // 110: high for 2 bit times, low for 1
+#define WS2812_RESET_US    80       // Low time that latches the data (> 50)
+
+// Datasheet timing in ns: nominal value and tolerance of each phase
+#define WS2812_T0H_NS 400
+#define WS2812_T0L_NS 850
+#define WS2812_T1H_NS 800
+#define WS2812_T1L_NS 450
+#define WS2812_TOLERANCE_NS 150
+
+// Duration of one symbol bit, and of each phase as produced by the symbols
+#define WS2812_SYMBOL_BIT_NS (1000000000 / WS2812_BIT_RATE)
+#define WS2812_OUT_T0H_NS (1*WS2812_SYMBOL_BIT_NS)
+#define WS2812_OUT_T0L_NS (2*WS2812_SYMBOL_BIT_NS)
+#define WS2812_OUT_T1H_NS (2*WS2812_SYMBOL_BIT_NS)
+#define WS2812_OUT_T1L_NS (1*WS2812_SYMBOL_BIT_NS)
+
+#define WS2812_WITHIN_SPEC(out, spec) \
+    (((out) >= (spec) - WS2812_TOLERANCE_NS) && ((out) <= (spec) + WS2812_TOLERANCE_NS))
+
+#if !WS2812_WITHIN_SPEC(WS2812_OUT_T0H_NS, WS2812_T0H_NS) || \
+    !WS2812_WITHIN_SPEC(WS2812_OUT_T0L_NS, WS2812_T0L_NS) || \
+    !WS2812_WITHIN_SPEC(WS2812_OUT_T1H_NS, WS2812_T1H_NS) || \
+    !WS2812_WITHIN_SPEC(WS2812_OUT_T1L_NS, WS2812_T1L_NS)
+#  error "WS2812_BIT_RATE does not meet the WS2812B timing spec"
+#endif
+
+// Zero words appended to latch the data
+#define WS2812_RESET_WORDS ((WS2812_RESET_US * (WS2812_BIT_RATE / 1000) / 1000 + 15) / 16)
+
+// Words needed to encode 'n' LEDs, including the reset
+#define WS2812_ENCODED_WORDS(n) (((n)*24*WS2812_SYMBOL_BITS + 15) / 16 + WS2812_RESET_WORDS)
+
+//*****************************************************************************
+// Encodes the 3*num_leds bytes of 'grb', each mapped through the 256-entry 
+// 'curve' (NULL to encode them as they are), writing 
+// WS2812_ENCODED_WORDS(num_leds) words to 'words'. A null 'grb' encodes every 
+// LED as off, whatever the curve.
+//*****************************************************************************
+void ws2812_encode(const uint8_t *grb, const uint8_t *curve, uint16_t num_leds, uint16_t *words);
+
+#endif